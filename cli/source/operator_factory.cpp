@@ -154,6 +154,34 @@ auto ParseEvaluator(std::string const& str, Problem& problem, ScalarDispatch& dt
         throw std::runtime_error(fmt::format("--nonfinite-penalty-weight must be a finite, non-negative value (got {})\n", nonFinitePenaltyWeight));
     }
 
+    // cv:<metric>[:<folds>] - mean out-of-fold error of k-fold cross-validation
+    if (auto tok = Split(str, ':'); tok.size() > 1 && tok[0] == "cv") {
+        if (skipNonFinite) {
+            throw std::runtime_error(fmt::format("--skip-nonfinite is not supported with objective '{}'\n", str));
+        }
+        auto [metric, metricScale] = ParseErrorMetric(tok[1]);
+        constexpr size_t defaultFolds{5};
+        size_t folds{defaultFolds};
+        if (tok.size() > 2) {
+            auto result = scn::scan<std::size_t>(tok[2], "{}");
+            ENSURE(result);
+            folds = result->value();
+        }
+        return std::make_unique<Operon::CrossValidationEvaluator<T>>(&problem, &dtable, folds, *metric, scale && metricScale, /*reportDeviation=*/false);
+    }
+
+    // sample:<metric>:<rows> - error on a stratified row sample redrawn every
+    // generation, growing as the population converges
+    if (auto tok = Split(str, ':'); tok.size() == 3 && tok[0] == "sample") {
+        if (skipNonFinite) {
+            throw std::runtime_error(fmt::format("--skip-nonfinite is not supported with objective '{}'\n", str));
+        }
+        auto [metric, metricScale] = ParseErrorMetric(tok[1]);
+        auto result = scn::scan<std::size_t>(tok[2], "{}");
+        ENSURE(result);
+        return std::make_unique<Operon::SubsampledEvaluator<T>>(&problem, &dtable, result->value(), *metric, scale && metricScale);
+    }
+
     std::unique_ptr<EvaluatorBase> evaluator;
     if (str == "r2") {
         evaluator = std::make_unique<Operon::Evaluator<T>>(&problem, &dtable, Operon::R2{}, scale);
@@ -241,6 +269,28 @@ auto ParseGenerator(std::string const& str, EvaluatorBase& eval, CrossoverBase&
     return generator;
 }
 
+auto ParseRobustLoss(std::string const& str) -> RobustLossFunction
+{
+    auto tok = Split(str, ':');
+    if (tok.empty()) { throw std::invalid_argument(GetErrorString("robust loss", str)); }
+    RobustLossFunction loss;
+    if (tok[0] == "huber") {
+        loss.Loss = RobustLoss::Huber;
+    } else if (tok[0] == "cauchy") {
+        loss.Loss = RobustLoss::Cauchy;
+    } else if (tok[0] == "tukey") {
+        loss.Loss = RobustLoss::Tukey;
+    } else {
+        throw std::invalid_argument(GetErrorString("robust loss", str));
+    }
+    if (tok.size() > 1 && !tok[1].empty()) {
+        auto res = scn::scan<double>(tok[1], "{}");
+        if (!res || !(res->value() > 0)) { throw std::invalid_argument(GetErrorString("robust loss", str)); }
+        loss.Tuning = res->value();
+    }
+    return loss;
+}
+
 auto ParseOptimizer(std::string const& /*str*/, Problem const& /*problem*/, ScalarDispatch const& /*dtable*/) -> std::unique_ptr<OptimizerBase> {
     throw std::runtime_error("not implemented");
 }
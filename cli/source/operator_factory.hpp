@@ -74,6 +74,10 @@ auto ParseGenerator(std::string const& str, EvaluatorBase& eval, CrossoverBase&
 
 auto ParseOptimizer(std::string const& str, Problem const& problem, ScalarDispatch const& dtable) -> std::unique_ptr<OptimizerBase>;
 
+// Parses "name[:c]" (huber, cauchy or tukey, with an optional tuning
+// constant) for RobustLevenbergMarquardtOptimizer.
+auto ParseRobustLoss(std::string const& str) -> RobustLossFunction;
+
 } // namespace Operon
 
 #endif
@@ -14,6 +14,8 @@
 #include <thread>
 
 #include "operon/algorithms/gp.hpp"
+#include "operon/algorithms/numa_pinning.hpp"
+#include "operon/hash/semantic.hpp"
 #include "operon/hash/zobrist.hpp"
 #include "operon/core/problem.hpp"
 #include "operon/core/version.hpp"
@@ -24,9 +26,11 @@
 #include "operon/operators/evaluator.hpp"
 #include "operon/operators/generator.hpp"
 #include "operon/operators/initializer.hpp"
+#include "operon/operators/local_search.hpp"
 #include "operon/operators/mutation.hpp"
 #include "operon/operators/reinserter.hpp"
 #include "operon/operators/selector.hpp"
+#include "operon/operators/surrogate.hpp"
 #include "operon/optimizer/optimizer.hpp"
 
 #include "jit_setup.hpp"
@@ -92,7 +96,7 @@ auto main(int argc, char** argv) -> int // NOLINT(bugprone-exception-escape)
     auto const symbolic = result["symbolic"].as<bool>();
 
     // Apply overrides from parsed options
-    dataset = std::make_unique<Operon::Dataset>(result["dataset"].as<std::string>(), /*hasHeader=*/true);
+    dataset = Operon::LoadDataset(result, result["dataset"].as<std::string>());
     if (result.contains("seed"))             { config.Seed = result["seed"].as<size_t>(); }
     if (result.contains("train"))            { trainingRange = Operon::ParseRange(result["train"].as<std::string>()); }
     if (result.contains("test"))             { testRange = Operon::ParseRange(result["test"].as<std::string>()); }
@@ -180,6 +184,9 @@ auto main(int argc, char** argv) -> int // NOLINT(bugprone-exception-escape)
         if (jitMode == "all" && result["skip-nonfinite"].as<bool>()) {
             throw std::invalid_argument("--skip-nonfinite is not supported with --jit=all");
         }
+        if (!jitMode.empty() && !result["robust-loss"].as<std::string>().empty()) {
+            throw std::invalid_argument("--robust-loss is not supported with --jit");
+        }
 
         std::unique_ptr<Operon::Zobrist>       zobrist;
         std::unique_ptr<Operon::EvaluatorBase> evaluator;
@@ -190,12 +197,22 @@ auto main(int argc, char** argv) -> int // NOLINT(bugprone-exception-escape)
         if (jitMode.empty()) {
             if (result["transposition-cache"].as<bool>()) {
                 Operon::RandomGenerator cacheRng(config.Seed);
-                zobrist = std::make_unique<Operon::Zobrist>(cacheRng, static_cast<int>(maxLength), problem.GetInputs(), result["cache-max-age"].as<size_t>());
+                zobrist = std::make_unique<Operon::Zobrist>(cacheRng, static_cast<int>(maxLength), problem.GetInputs(), result["cache-max-age"].as<size_t>(), result["cache-coefficients"].as<bool>());
                 config.Cache = zobrist.get();
             }
             evaluator = Operon::ParseEvaluator(result["objective"].as<std::string>(), problem, dtable, scale,
                 result["skip-nonfinite"].as<bool>(), result["nonfinite-penalty-weight"].as<double>());
-            optimizer = std::make_unique<Operon::LevenbergMarquardtOptimizer<decltype(dtable), Operon::OptimizerType::Eigen>>(&dtable, &problem);
+            if (result["batched-lm"].as<bool>()) {
+                optimizer = std::make_unique<Operon::BatchedLevenbergMarquardtOptimizer<decltype(dtable)>>(&dtable, &problem);
+            } else if (result["varpro"].as<bool>()) {
+                optimizer = std::make_unique<Operon::VariableProjectionOptimizer<decltype(dtable)>>(&dtable, &problem);
+            } else if (result["newton"].as<bool>()) {
+                optimizer = std::make_unique<Operon::NewtonOptimizer<decltype(dtable)>>(&dtable, &problem);
+            } else if (auto const loss = result["robust-loss"].as<std::string>(); !loss.empty()) {
+                optimizer = std::make_unique<Operon::RobustLevenbergMarquardtOptimizer<decltype(dtable)>>(&dtable, &problem, Operon::ParseRobustLoss(loss));
+            } else {
+                optimizer = std::make_unique<Operon::LevenbergMarquardtOptimizer<decltype(dtable), Operon::OptimizerType::Eigen>>(&dtable, &problem);
+            }
         } else {
             auto jobj = Operon::CLI::MakeJitObjects(
                 jitMode, problem, dtable,
@@ -221,8 +238,24 @@ auto main(int argc, char** argv) -> int // NOLINT(bugprone-exception-escape)
                 optimizer = std::make_unique<Operon::LevenbergMarquardtOptimizer<decltype(dtable), Operon::OptimizerType::Eigen>>(&dtable, &problem);
             }
         }
+        if (auto const rows = result["early-abort"].as<size_t>(); rows > 0) {
+            auto* e = dynamic_cast<Operon::Evaluator<decltype(dtable)>*>(evaluator.get());
+            if (e == nullptr) { throw std::invalid_argument("--early-abort requires an interpreter-based error metric evaluator"); }
+            e->SetEarlyAbortRows(rows);
+        }
+        std::unique_ptr<Operon::SemanticCache> semantic;
+        if (auto const rows = result["semantic-cache"].as<size_t>(); rows > 0) {
+            Operon::RandomGenerator probeRng(config.Seed);
+            semantic = std::make_unique<Operon::SemanticCache>(probeRng, problem, dtable, rows, result["cache-max-age"].as<size_t>());
+            config.Semantic = semantic.get();
+        }
         evaluator->SetBudget(config.Evaluations);
         optimizer->SetIterations(config.Iterations);
+        optimizer->SetStopping({ .RelativeImprovement = result["stop-relative-improvement"].as<double>(),
+                                 .GradientNorm = result["stop-gradient-norm"].as<double>() });
+        if (auto const& stopping = optimizer->Stopping(); (stopping.RelativeImprovement > 0 || stopping.GradientNorm > 0) && !optimizer->StoppingSupported()) {
+            fmt::print(stderr, "warning: the selected optimizer ignores --stop-relative-improvement and --stop-gradient-norm, only the iteration budget applies\n");
+        }
 
         Operon::CoefficientOptimizer const cOpt { optimizer.get() };
 
@@ -234,6 +267,26 @@ auto main(int argc, char** argv) -> int // NOLINT(bugprone-exception-escape)
         auto maleSelector = Operon::ParseSelector(result["male-selector"].as<std::string>(), comp);
 
         auto generator = Operon::ParseGenerator(result["offspring-generator"].as<std::string>(), *evaluator, crossover, mutator, *femaleSelector, *maleSelector, &cOpt);
+        if (result["inherit-coefficients"].as<bool>()) {
+            generator->SetCoefficientInheritance(true);
+            optimizer->SetLinearWarmStart(true);
+            if (!optimizer->LinearWarmStartSupported()) {
+                fmt::print(stderr, "warning: --inherit-coefficients: the selected optimizer has no linear warm start, only the inherited coefficients are used\n");
+            }
+        }
+        std::unique_ptr<Operon::LocalSearchBudget> localSearchBudget;
+        if (result["adaptive-iterations"].as<bool>() && config.Iterations > 0) {
+            localSearchBudget = std::make_unique<Operon::LocalSearchBudget>(optimizer.get());
+            generator->SetLocalSearchBudget(localSearchBudget.get());
+        }
+        if (auto const rows = result["racing"].as<size_t>(); rows > 0) {
+            generator->SetRacing({ .InitialRows = rows, .HalvingRatio = result["racing-ratio"].as<double>() });
+        }
+        std::unique_ptr<Operon::FitnessSurrogate> surrogate;
+        if (auto const warmup = result["surrogate"].as<size_t>(); warmup > 0) {
+            surrogate = std::make_unique<Operon::FitnessSurrogate>(Operon::SurrogateConfig{ .Warmup = warmup });
+            generator->SetSurrogate(surrogate.get());
+        }
         // Default 1: preserves GP's historical single-elite behavior (previously
         // a hardcoded offspring[0] overwrite in gp.cpp, now handled uniformly by
         // ReinserterBase - see reinserter.hpp).
@@ -243,8 +296,12 @@ auto main(int argc, char** argv) -> int // NOLINT(bugprone-exception-escape)
         Operon::RandomGenerator random(config.Seed);
         if (result["shuffle"].as<bool>()) { problem.GetDataset()->Shuffle(random); }
         if (result["standardize"].as<bool>()) { problem.StandardizeData(problem.TrainingRange()); }
+        auto const numa = result["numa"].as<bool>() && problem.GetDataset()->EnableNumaReplication() > 0;
 
-        tf::Executor executor(threads);
+        tf::Executor executor(threads, numa ? Operon::NumaWorkerPinning::Make(threads) : nullptr);
+        if (auto const rows = result["row-parallel"].as<size_t>(); rows > 0) {
+            optimizer->SetRowParallelism({ .Executor = &executor, .MinBlockRows = rows });
+        }
         Operon::GeneticProgrammingAlgorithm gp { config, &problem, &treeInitializer, coeffInitializer.get(), generator.get(), reinserter.get() };
 
         auto const warmStart = Operon::ResumeFromCheckpoint(gp, random, result);
@@ -271,6 +328,9 @@ auto main(int argc, char** argv) -> int // NOLINT(bugprone-exception-escape)
         if (probes) { probes->Finish(); }
         Operon::MaybeSaveCheckpoint(gp, random, result, /*force=*/true);
         jitReport();
+        if (localSearchBudget) {
+            fmt::print(stderr, "local search iterations: {} allotted, {} at the static budget\n", localSearchBudget->Allotted(), localSearchBudget->Baseline());
+        }
         auto best = reporter.GetBest();
         fmt::print("{}\n", Operon::InfixFormatter::Format(best.Genotype, *problem.GetDataset(), 6));
     } catch (std::exception& e) {
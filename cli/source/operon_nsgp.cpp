@@ -14,6 +14,8 @@
 #include <thread>
 
 #include "operon/algorithms/nsga2.hpp"
+#include "operon/algorithms/numa_pinning.hpp"
+#include "operon/hash/semantic.hpp"
 #include "operon/hash/zobrist.hpp"
 #include "operon/core/problem.hpp"
 #include "operon/core/version.hpp"
@@ -25,6 +27,7 @@
 #include "operon/operators/evaluator.hpp"
 #include "operon/operators/generator.hpp"
 #include "operon/operators/initializer.hpp"
+#include "operon/operators/local_search.hpp"
 #include "operon/operators/mutation.hpp"
 #include "operon/operators/non_dominated_sorter.hpp"
 #include "operon/operators/reinserter.hpp"
@@ -102,7 +105,7 @@ auto main(int argc, char** argv) -> int
             const auto& value = kv.value();
 
             if (key == "dataset") {
-                dataset = std::make_unique<Operon::Dataset>(value, true);
+                dataset = Operon::LoadDataset(result, value);
             }
             if (key == "seed") {
                 config.Seed = kv.as<size_t>();
@@ -246,7 +249,7 @@ auto main(int argc, char** argv) -> int
         if (jitMode.empty()) {
             if (result["transposition-cache"].as<bool>()) {
                 Operon::RandomGenerator cacheRng(config.Seed);
-                zobrist = std::make_unique<Operon::Zobrist>(cacheRng, static_cast<int>(maxLength), problem.GetInputs(), result["cache-max-age"].as<size_t>());
+                zobrist = std::make_unique<Operon::Zobrist>(cacheRng, static_cast<int>(maxLength), problem.GetInputs(), result["cache-max-age"].as<size_t>(), result["cache-coefficients"].as<bool>());
                 config.Cache = zobrist.get();
             }
             errorEvaluator = Operon::ParseEvaluator(result["objective"].as<std::string>(), problem, dtable, scale,
@@ -277,8 +280,19 @@ auto main(int argc, char** argv) -> int
                 optimizer = std::make_unique<Operon::LevenbergMarquardtOptimizer<decltype(dtable), Operon::OptimizerType::Eigen>>(&dtable, &problem);
             }
         }
+        std::unique_ptr<Operon::SemanticCache> semantic;
+        if (auto const rows = result["semantic-cache"].as<size_t>(); rows > 0) {
+            Operon::RandomGenerator probeRng(config.Seed);
+            semantic = std::make_unique<Operon::SemanticCache>(probeRng, problem, dtable, rows, result["cache-max-age"].as<size_t>());
+            config.Semantic = semantic.get();
+        }
         errorEvaluator->SetBudget(config.Evaluations);
         optimizer->SetIterations(config.Iterations);
+        optimizer->SetStopping({ .RelativeImprovement = result["stop-relative-improvement"].as<double>(),
+                                 .GradientNorm = result["stop-gradient-norm"].as<double>() });
+        if (auto const& stopping = optimizer->Stopping(); (stopping.RelativeImprovement > 0 || stopping.GradientNorm > 0) && !optimizer->StoppingSupported()) {
+            fmt::print(stderr, "warning: the selected optimizer ignores --stop-relative-improvement and --stop-gradient-norm, only the iteration budget applies\n");
+        }
 
         Operon::LengthEvaluator lengthEvaluator(&problem, maxLength);
         // Operon::EntropyEvaluator entropyEvaluator(&problem);
@@ -298,6 +312,18 @@ auto main(int argc, char** argv) -> int
         Operon::CoefficientOptimizer cOpt { optimizer.get() };
 
         auto generator = Operon::ParseGenerator(result["offspring-generator"].as<std::string>(), evaluator, crossover, mutator, *femaleSelector, *maleSelector, &cOpt);
+        if (result["inherit-coefficients"].as<bool>()) {
+            generator->SetCoefficientInheritance(true);
+            optimizer->SetLinearWarmStart(true);
+            if (!optimizer->LinearWarmStartSupported()) {
+                fmt::print(stderr, "warning: --inherit-coefficients: the selected optimizer has no linear warm start, only the inherited coefficients are used\n");
+            }
+        }
+        std::unique_ptr<Operon::LocalSearchBudget> localSearchBudget;
+        if (result["adaptive-iterations"].as<bool>() && config.Iterations > 0) {
+            localSearchBudget = std::make_unique<Operon::LocalSearchBudget>(optimizer.get());
+            generator->SetLocalSearchBudget(localSearchBudget.get());
+        }
         // Default 0: NSGA2 had no elitism before this option existed, so an
         // unspecified --elitism preserves that. Opt in explicitly to enable it.
         auto const eliteCount = result.count("elitism") ? result["elitism"].as<size_t>() : size_t{0};
@@ -310,7 +336,11 @@ auto main(int argc, char** argv) -> int
         if (result["standardize"].as<bool>()) {
             problem.StandardizeData(problem.TrainingRange());
         }
-        tf::Executor executor(threads);
+        auto const numa = result["numa"].as<bool>() && problem.GetDataset()->EnableNumaReplication() > 0;
+        tf::Executor executor(threads, numa ? Operon::NumaWorkerPinning::Make(threads) : nullptr);
+        if (auto const rows = result["row-parallel"].as<size_t>(); rows > 0) {
+            optimizer->SetRowParallelism({ .Executor = &executor, .MinBlockRows = rows });
+        }
         auto const sorterName = result["sorter"].as<std::string>();
         Operon::RankIntersectSorter rsSorter;
         Operon::MergeSorter msSorter;
@@ -369,6 +399,9 @@ auto main(int argc, char** argv) -> int
         if (probes) { probes->Finish(); }
         Operon::MaybeSaveCheckpoint(gp, random, result, /*force=*/true);
         jitReport();
+        if (localSearchBudget) {
+            fmt::print(stderr, "local search iterations: {} allotted, {} at the static budget\n", localSearchBudget->Allotted(), localSearchBudget->Baseline());
+        }
         auto best = reporter.GetBest();
         fmt::print("{}\n", Operon::InfixFormatter::Format(best.Genotype, *problem.GetDataset(), std::numeric_limits<Operon::Scalar>::digits));
         if (result.contains("pareto-front")) {
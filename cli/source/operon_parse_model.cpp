@@ -17,6 +17,7 @@
 #include "operon/parser/infix.hpp"
 #include "operon/interpreter/interpreter.hpp"
 #include "operon/operators/evaluator.hpp"
+#include "operator_factory.hpp"
 #include "reporter.hpp"
 
 #include <cxxopts.hpp>
@@ -40,8 +41,8 @@ namespace {
             ("target", "Name of the target variable (if none provided, model output will be printed)", cxxopts::value<std::string>())
             ("range", "Data range [A:B)", cxxopts::value<std::string>())
             ("scale", "Linear scaling slope:intercept", cxxopts::value<std::string>())
-            ("optimizer", "Optimizer for model coefficients (lm, lbfgs, sgd)", cxxopts::value<std::string>()->default_value("lm"))
-            ("likelihood", "Optimizer loss function (gaussian, poisson)", cxxopts::value<std::string>()->default_value("gaussian"))
+            ("optimizer", "Optimizer for model coefficients (lm, lbfgs, sgd, irls)", cxxopts::value<std::string>()->default_value("lm"))
+            ("likelihood", "Optimizer loss function (gaussian, poisson; huber, cauchy or tukey[:c] for irls)", cxxopts::value<std::string>()->default_value("gaussian"))
             ("iterations", "Optimizer iterations (0 disables refitting; reported stats are the model's own coefficients as given)", cxxopts::value<int>()->default_value("0"))
             ("debug", "Show some debugging information", cxxopts::value<bool>()->default_value("false"))
             ("format", "Format string (see https://fmt.dev/latest/syntax.html)", cxxopts::value<std::string>()->default_value(":>#8.4g"))
@@ -94,6 +95,10 @@ namespace {
             } else if (likelihood == "poisson") {
                 opt = std::make_unique<Operon::SGDOptimizer<Operon::ScalarDispatch, Operon::PoissonLoss<Operon::Scalar>>>(dtable, problem);
             }
+        } else if (optimizer == "irls") {
+            // the default likelihood means the default robust loss
+            auto const loss = likelihood == "gaussian" ? Operon::RobustLossFunction{} : Operon::ParseRobustLoss(likelihood);
+            opt = std::make_unique<Operon::RobustLevenbergMarquardtOptimizer<Operon::ScalarDispatch>>(dtable, problem, loss);
         }
         return opt;
     }
@@ -181,7 +181,7 @@ public:
         using T = std::tuple<std::string, double, std::string>;
         auto const* format = ":>#8.3g"; // see https://fmt.dev/latest/syntax.html
 
-        auto [resEval, jacEval, callCount, cfTime ] = statsSource_ ? statsSource_->Stats() : evaluator_->Stats();
+        auto const counters = statsSource_ ? statsSource_->Stats() : evaluator_->Stats();
         std::array stats {
             T{ "iteration", gp.Generation(), ":>" },
             T{ "r2_tr", r2Train, format },
@@ -194,10 +194,11 @@ public:
             T{ "avg_fit", avgQuality, format },
             T{ "best_len", best_.Genotype.Length(), format },
             T{ "avg_len", avgLength, format },
-            T{ "eval_cnt", callCount, ":>" },
-            T{ "res_eval", resEval, ":>" },
-            T{ "jac_eval", jacEval, ":>" },
-            T{ "opt_time", cfTime / 1e6, format },
+            T{ "eval_cnt", counters.CallCount, ":>" },
+            T{ "res_eval", counters.ResidualEvaluations, ":>" },
+            T{ "jac_eval", counters.JacobianEvaluations, ":>" },
+            T{ "rows_saved", counters.SavedRowEvaluations, ":>" },
+            T{ "opt_time", counters.CostFunctionTime / 1e6, format },
             T{ "seed", config.Seed, ":>10" },
             T{ "sort_ms", [&]{ auto const& t = gp.Timings(); auto it = t.find(std::string{SortTaskName}); return it != t.end() ? it->second * 1e3 : 0.0; }(), format },
             T{ "elapsed", gp.Elapsed(), ":>"},
@@ -154,7 +154,7 @@ auto InitOptions(std::string const& name, std::string const& desc, int width) ->
         ("target", "Name of the target variable (required)", cxxopts::value<std::string>())
         ("inputs", "Comma-separated list of input variables", cxxopts::value<std::string>())
         ("epsilon", "Tolerance for fitness comparison (needed e.g. for eps-dominance)", cxxopts::value<Operon::Scalar>()->default_value("1e-6"))
-        ("objective", "The error metric used for calculating fitness", cxxopts::value<std::string>()->default_value("r2"))
+        ("objective", "The error metric used for calculating fitness (cv:<metric>[:<folds>] for its k-fold cross-validated mean, sample:<metric>:<rows> for its value on a per-generation stratified row sample)", cxxopts::value<std::string>()->default_value("r2"))
         ("linear-scaling", "Apply linear scaling on model predictions", cxxopts::value<bool>()->default_value("true"))
         ("skip-nonfinite", "Skip non-finite rows instead of clamping fitness to ErrMax on any non-finite prediction (SSE/MSE/NMSE/RMSE/MAE objectives only)", cxxopts::value<bool>()->default_value("false"))
         ("nonfinite-penalty-weight", "Penalty weight applied to the non-finite row fraction when --skip-nonfinite is set (scaled by target variance for non-normalized metrics)", cxxopts::value<double>()->default_value("1.0"))
@@ -167,6 +167,15 @@ auto InitOptions(std::string const& name, std::string const& desc, int width) ->
         ("generations", "Number of generations", cxxopts::value<size_t>()->default_value("1000"))
         ("evaluations", "Evaluation budget", cxxopts::value<size_t>()->default_value("1000000"))
         ("iterations", "Local optimization iterations", cxxopts::value<size_t>()->default_value("0"))
+        ("adaptive-iterations", "Scale the local optimization budget of each offspring by its better parent's rank in the population: offspring of the best parents get up to 1.75x --iterations, those of the worst 0.25x, averaging to --iterations", cxxopts::value<bool>()->default_value("false"))
+        ("stop-relative-improvement", "Stop local optimization once an accepted step improves the cost by less than this fraction (0 = off)", cxxopts::value<double>()->default_value("0"))
+        ("stop-gradient-norm", "Stop local optimization once the max-norm of the cost gradient drops below this value (0 = off)", cxxopts::value<double>()->default_value("0"))
+        ("row-parallel", "Split the rows of a Levenberg-Marquardt fit into blocks of at least this many rows across idle worker threads, e.g. for the last fits of a generation on a huge training set (0 = off)", cxxopts::value<size_t>()->default_value("0"))
+        ("inherit-coefficients", "Start local optimization of each offspring from the coefficients its subtrees had in its parents, and from least-squares values for the coefficients entering the model linearly (least-squares optimizers only, not --robust-loss)", cxxopts::value<bool>()->default_value("false"))
+        ("batched-lm", "Optimize coefficients with the batched Levenberg-Marquardt solver, which fits blocks of individuals (initial population and offspring) in lockstep (operon_gp only)", cxxopts::value<bool>()->default_value("false"))
+        ("varpro", "Optimize coefficients by variable projection: linearly entering coefficients are solved for in closed form and Levenberg-Marquardt only iterates on the rest (operon_gp only)", cxxopts::value<bool>()->default_value("false"))
+        ("newton", "Optimize coefficients with a trust-region Newton method using the exact symbolic Hessian of the loss (operon_gp only)", cxxopts::value<bool>()->default_value("false"))
+        ("robust-loss", "Optimize coefficients under a robust loss (huber, cauchy or tukey, optionally with a tuning constant, e.g. huber:2) by iteratively reweighted Levenberg-Marquardt, for targets with outliers or heavy-tailed noise (operon_gp only, not with --jit)", cxxopts::value<std::string>()->default_value(""))
         ("selection-pressure", "Selection pressure", cxxopts::value<size_t>()->default_value("100"))
         ("maxlength", "Maximum length", cxxopts::value<size_t>()->default_value("50"))
         ("maxdepth", "Maximum depth", cxxopts::value<size_t>()->default_value("10"))
@@ -189,9 +198,17 @@ auto InitOptions(std::string const& name, std::string const& desc, int width) ->
         ("symbolic", "Operate in symbolic mode - no coefficient tuning or coefficient mutation", cxxopts::value<bool>()->default_value("false"))
         ("show-primitives", "Display the primitive set used by the algorithm")
         ("threads", "Number of threads to use for parallelism", cxxopts::value<size_t>()->default_value("0"))
+        ("float64-tolerance", "Read the dataset as float64 and keep a 64-bit copy of columns whose float32 narrowing error exceeds this fraction of the column's range (e.g. 1e-6)", cxxopts::value<double>())
+        ("early-abort", "Reject offspring that offspring selection would discard after interpreting blocks of this many rows (doubling), once a bound on their error proves it (0 = off)", cxxopts::value<size_t>()->default_value("0"))
+        ("racing", "Race offspring candidates (brood and offspring selection generators) on random row windows of this size, growing by --racing-ratio per round, before fully scoring the finalists (0 = off)", cxxopts::value<size_t>()->default_value("0"))
+        ("racing-ratio", "Successive-halving ratio for --racing: the fraction 1/ratio of candidates survives each round", cxxopts::value<double>()->default_value("2"))
+        ("surrogate", "Skip the evaluation of offspring that a learned fitness predictor confidently expects offspring selection to discard, once it has seen this many scored offspring; its safety margin adapts to keep missed acceptances rare (0 = off)", cxxopts::value<size_t>()->default_value("0"))
+        ("numa", "Replicate the dataset on every NUMA node and pin worker threads per node (no effect on single-socket machines)", cxxopts::value<bool>()->default_value("false"))
         ("timelimit", "Time limit after which the algorithm will terminate", cxxopts::value<size_t>()->default_value(std::to_string(std::numeric_limits<size_t>::max())))
         ("transposition-cache", "Cache fitness values keyed by Zobrist hash of tree structure; most effective with coefficient optimization enabled", cxxopts::value<bool>()->default_value("false"))
         ("cache-max-age", "Expire transposition cache entries older than this many generations (0 = never expire); only effective with --transposition-cache", cxxopts::value<size_t>()->default_value("0"))
+        ("cache-coefficients", "Keep the coefficients each cached fitness was computed with in the transposition cache and restore them on a (Lamarckian) hit, at the cost of the extra memory per entry; only effective with --transposition-cache", cxxopts::value<bool>()->default_value("false"))
+        ("semantic-cache", "Reuse the fitness (and, when Lamarckian, the optimized coefficients) of offspring whose outputs on this many probe rows match an already scored model, skipping local search (0 = off); entries expire with --cache-max-age", cxxopts::value<size_t>()->default_value("0"))
         ("pareto-front", "Write rank-0 Pareto front to this JSON file after the run (only effective with Pareto-based algorithms, e.g. operon_nsgp)", cxxopts::value<std::string>())
         ("model-selection", "Pareto front model selection: obj0 (lowest first objective), mdl, bic, aic", cxxopts::value<std::string>()->default_value("obj0"))
         ("mdl-likelihood", "Likelihood for MDL/BIC/AIC model selection: gaussian or poisson", cxxopts::value<std::string>()->default_value("gaussian"))
@@ -232,6 +249,7 @@ auto ResumeFromCheckpoint(GeneticAlgorithmBase& algo, RandomGenerator& rng,
     // every entry read as ancient (and get evicted) the moment the loop
     // advances the clock past the checkpoint's generation.
     if (auto* cache = config.Cache) { cache->SetGeneration(cp->Generation); }
+    if (auto* semantic = config.Semantic) { semantic->SetGeneration(cp->Generation); }
     auto parents = algo.Parents();
     for (std::size_t i = 0; i < cp->Population.size(); ++i) {
         parents[i] = std::move(cp->Population[i]);
@@ -316,6 +334,20 @@ auto ResolveVariable(Dataset const& dataset, std::string const& name, std::strin
 }
 } // namespace
 
+auto LoadDataset(cxxopts::ParseResult const& result, std::string const& path) -> std::unique_ptr<Dataset>
+{
+    if (!result.contains("float64-tolerance")) {
+        return std::make_unique<Dataset>(path, /*hasHeader=*/true);
+    }
+    auto [dataset, reports] = Dataset::ReadFloat64(path, /*hasHeader=*/true, result["float64-tolerance"].as<double>());
+    for (auto const& r : reports) {
+        if (r.Precision != ColumnPrecision::Float64) { continue; }
+        fmt::print(stderr, "float64 column {}: narrowing error {:.3g} of range, {} overflow(s)\n",
+            dataset.GetVariable(r.Hash)->Name, r.RangeRelError, r.Overflow);
+    }
+    return std::make_unique<Dataset>(std::move(dataset));
+}
+
 auto ResolveTarget(Dataset const& dataset, std::string const& targetName) -> Variable
 {
     return ResolveVariable(dataset, targetName, "target variable");
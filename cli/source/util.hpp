@@ -13,6 +13,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cxxopts.hpp>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -29,6 +30,10 @@ auto PrintPrimitives(PrimitiveSetConfig config) -> void;
 auto InitOptions(std::string const& name, std::string const& desc, int width = optionsWidth) -> cxxopts::Options;
 auto ParseOptions(cxxopts::Options&& opts, int argc, char** argv) -> cxxopts::ParseResult;
 
+// Load a CSV dataset (with header). With --float64-tolerance set, goes
+// through Dataset::ReadFloat64 and reports the columns kept at 64-bit.
+auto LoadDataset(cxxopts::ParseResult const& result, std::string const& path) -> std::unique_ptr<Dataset>;
+
 // Set trainingRange and testRange from CLI options, inferring defaults from dataset if not provided.
 auto SetupRanges(cxxopts::ParseResult const& result, Dataset const& dataset,
                  Range& trainingRange, Range& testRange) -> void;
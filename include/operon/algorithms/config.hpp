@@ -10,6 +10,7 @@
 namespace Operon {
 
 class Zobrist; // forward declaration — include operon/hash/zobrist.hpp to use
+class SemanticCache; // forward declaration — include operon/hash/semantic.hpp to use
 
 struct GeneticAlgorithmConfig {
     size_t Generations; // generation limit
@@ -25,6 +26,7 @@ struct GeneticAlgorithmConfig {
     double LamarckianProbability{1.0};
     double Epsilon{0};     // used when comparing fitness values
     Zobrist* Cache{nullptr}; // optional transposition cache; null = disabled
+    SemanticCache* Semantic{nullptr}; // optional semantic fingerprint cache; null = disabled
 };
 } // namespace Operon
 
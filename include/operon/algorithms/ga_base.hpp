@@ -86,6 +86,7 @@ public:
         , offspring_(individuals_.data() + config.PopulationSize, config.PoolSize)
     {
         generator_->SetCache(config.Cache);
+        generator_->SetFingerprintCache(config.Semantic);
     }
 
     // Parents()/Offspring() genuinely change *type* between const and
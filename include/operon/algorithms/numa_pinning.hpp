@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright 2019-2025 Heal Research
+// SPDX-FileCopyrightText: Copyright 2025-present Bogdan Burlacu and contributors
+
+#ifndef OPERON_ALGORITHMS_NUMA_PINNING_HPP
+#define OPERON_ALGORITHMS_NUMA_PINNING_HPP
+
+#include <cstddef>
+#include <exception>
+#include <memory>
+
+// NOLINTBEGIN(misc-include-cleaner)
+#include <taskflow/core/executor.hpp>
+// NOLINTEND(misc-include-cleaner)
+
+#include "operon/core/numa.hpp"
+
+namespace Operon {
+
+// Taskflow worker hook that pins each executor worker to a NUMA node
+// (contiguous blocks of worker ids per node, see Numa::WorkerNode) before it
+// starts scheduling. Pairs with Dataset::EnableNumaReplication: a pinned
+// worker's GetValues/GetPaddedValues calls resolve to its node-local
+// replica. Harmless on single-node machines (pinning is skipped).
+//
+//   tf::Executor executor(threads, Operon::NumaWorkerPinning::Make(threads));
+class NumaWorkerPinning : public tf::WorkerInterface {
+public:
+    explicit NumaWorkerPinning(std::size_t workers) noexcept
+        : workers_(workers), nodes_(Numa::NodeCount()) { }
+
+    static auto Make(std::size_t workers) -> std::shared_ptr<NumaWorkerPinning>
+    {
+        return std::make_shared<NumaWorkerPinning>(workers);
+    }
+
+    void scheduler_prologue(tf::Worker& worker) override // NOLINT(readability-identifier-naming)
+    {
+        if (nodes_ > 1) {
+            (void)Numa::PinCurrentThread(Numa::WorkerNode(worker.id(), workers_, nodes_));
+        }
+    }
+
+    void scheduler_epilogue(tf::Worker& /*worker*/, std::exception_ptr /*ptr*/) override { } // NOLINT(readability-identifier-naming)
+
+private:
+    std::size_t workers_;
+    int nodes_;
+};
+
+} // namespace Operon
+
+#endif
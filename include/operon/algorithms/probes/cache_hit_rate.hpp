@@ -6,42 +6,56 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <string>
 
 #include "operon/algorithms/probes/probe.hpp"
+#include "operon/hash/semantic.hpp"
 #include "operon/hash/zobrist.hpp"
 
 namespace Operon {
 
 // Reports per-generation deltas of the algorithm's Zobrist transposition
 // cache (GeneticAlgorithmConfig::Cache): hits, lookups, hit rate, and the
-// cache's cumulative size. Emits nothing if no cache is configured.
+// cache's cumulative size. The semantic fingerprint cache
+// (GeneticAlgorithmConfig::Semantic) is reported the same way under a
+// `semantic_` prefix; its lookups are the transposition cache's misses when
+// both are enabled. Emits nothing for a cache that is not configured.
 class CacheHitRateProbe final : public GenerationProbe {
 public:
     auto operator()(ProbeContext& ctx) -> void override
     {
-        auto const* cache = ctx.Config().Cache;
-        if (cache == nullptr) { return; }
+        if (auto const* cache = ctx.Config().Cache; cache != nullptr) {
+            Report(ctx, "cache", cache->Hits(), cache->Lookups(), cache->Size(), zobrist_);
+        }
+        if (auto const* semantic = ctx.Config().Semantic; semantic != nullptr) {
+            Report(ctx, "semantic", semantic->Hits(), semantic->Lookups(), semantic->Size(), semantic_);
+        }
+    }
+
+private:
+    struct Counters {
+        std::size_t Hits{0};
+        std::size_t Lookups{0};
+    };
 
-        auto const hits = cache->Hits();
-        auto const lookups = cache->Lookups();
+    static auto Report(ProbeContext& ctx, std::string const& prefix, std::size_t hits, std::size_t lookups, std::size_t size, Counters& prev) -> void
+    {
         // A caller may Clear() the cache between generations (resetting its
         // counters to 0), which would otherwise underflow these unsigned
         // deltas into a huge value; treat a backward jump as "counting
         // resumed from zero" instead.
-        auto const deltaHits = hits >= prevHits_ ? hits - prevHits_ : hits;
-        auto const deltaLookups = lookups >= prevLookups_ ? lookups - prevLookups_ : lookups;
-        prevHits_ = hits;
-        prevLookups_ = lookups;
-
-        ctx.Emit("cache_hits", static_cast<std::int64_t>(deltaHits));
-        ctx.Emit("cache_lookups", static_cast<std::int64_t>(deltaLookups));
-        ctx.Emit("cache_hit_rate", deltaLookups != 0 ? static_cast<double>(deltaHits) / static_cast<double>(deltaLookups) : 0.0);
-        ctx.Emit("cache_size", static_cast<std::int64_t>(cache->Size()));
+        auto const deltaHits = hits >= prev.Hits ? hits - prev.Hits : hits;
+        auto const deltaLookups = lookups >= prev.Lookups ? lookups - prev.Lookups : lookups;
+        prev = { hits, lookups };
+
+        ctx.Emit(prefix + "_hits", static_cast<std::int64_t>(deltaHits));
+        ctx.Emit(prefix + "_lookups", static_cast<std::int64_t>(deltaLookups));
+        ctx.Emit(prefix + "_hit_rate", deltaLookups != 0 ? static_cast<double>(deltaHits) / static_cast<double>(deltaLookups) : 0.0);
+        ctx.Emit(prefix + "_size", static_cast<std::int64_t>(size));
     }
 
-private:
-    std::size_t prevHits_{0};
-    std::size_t prevLookups_{0};
+    Counters zobrist_;
+    Counters semantic_;
 };
 
 } // namespace Operon
@@ -54,6 +54,8 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <new>
+#include <type_traits>
 
 #include "Eigen/Core"
 #include "Eigen/Dense"
@@ -142,6 +144,15 @@ class TinySolver {
   // fixed-size Eigen types.
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
+  // Operon: the members may view pool_ (see below), which a copy would
+  // alias, so solvers are neither copied nor moved.
+  TinySolver() = default;
+  TinySolver(const TinySolver&) = delete;
+  TinySolver(TinySolver&&) = delete;
+  TinySolver& operator=(const TinySolver&) = delete;
+  TinySolver& operator=(TinySolver&&) = delete;
+  ~TinySolver() = default;
+
   enum {
     NUM_RESIDUALS = Function::NUM_RESIDUALS,
     NUM_PARAMETERS = Function::NUM_PARAMETERS,
@@ -202,6 +213,12 @@ class TinySolver {
     // (new_cost - old_cost) < function_tolerance * old_cost
     Scalar function_tolerance = 1e-6;
 
+    // Stop once an accepted step improves the cost by less than this
+    // fraction of it (Operon addition; 0, the default, never stops). Unlike
+    // function_tolerance, which the loop below applies to the absolute
+    // cost change despite its comment, this one is relative.
+    Scalar relative_function_tolerance = 0;
+
     // cost_threshold > ||f(x)||^2 / 2
     Scalar cost_threshold = std::numeric_limits<Scalar>::epsilon();
 
@@ -242,8 +259,8 @@ class TinySolver {
     // TODO(sameeragarwal): Refactor this to allow for DenseQR
     // factorization.
     jacobian_ = jacobian_ * jacobi_scaling_.asDiagonal();
-    jtj_ = jacobian_.transpose() * jacobian_;
-    g_ = jacobian_.transpose() * residuals_;
+    jtj_.noalias() = jacobian_.transpose() * jacobian_;
+    g_.noalias() = jacobian_.transpose() * residuals_;
     summary.gradient_max_norm = g_.array().abs().maxCoeff();
     cost_ = residuals_.squaredNorm() / 2;
     return true;
@@ -308,7 +325,10 @@ class TinySolver {
 
       const Scalar cost_change = (2 * cost_ - f_x_new_.squaredNorm());
       // TODO(sameeragarwal): Better more numerically stable evaluation.
-      const Scalar model_cost_change = lm_step_.dot(2 * g_ - jtj_ * lm_step_);
+      // Operon: J'J * step goes to preallocated storage, the expression
+      // form allocated a temporary on every attempt.
+      jtj_step_.noalias() = jtj_ * lm_step_;
+      const Scalar model_cost_change = lm_step_.dot(2 * g_ - jtj_step_);
 
       // rho is the ratio of the actual reduction in error to the reduction
       // in error that would be obtained if the problem was linear. See [1]
@@ -319,10 +339,12 @@ class TinySolver {
         // model fits well.
         x = x_new_;
         ++summary.iterations;
+        const Scalar previous_cost = cost_;
 
         // TODO(sameeragarwal): Deal with failure.
         Update(function, x);
-        if (std::abs(cost_change) < options.function_tolerance) {
+        if (std::abs(cost_change) < options.function_tolerance ||
+            cost_change < 2 * options.relative_function_tolerance * previous_cost) {
           summary.status = COST_CHANGE_TOO_SMALL;
           break;
         }
@@ -379,12 +401,43 @@ class TinySolver {
  private:
   // Preallocate everything, including temporary storage needed for solving the
   // linear system. This allows reusing the intermediate storage across solves.
+  //
+  // Operon: with both sizes dynamic a solver reused across problems of
+  // different size would reallocate every member on each size change
+  // (Eigen's resize() frees unless the size is unchanged). In that case the
+  // members are maps into one buffer that only grows, re-seated by
+  // Initialize(), so a reused solver stops allocating once it has seen its
+  // largest problem. Only the linear solver's own O(p) scratch still follows
+  // the parameter count.
+  static constexpr bool kPooled =
+      NUM_RESIDUALS == Eigen::Dynamic && NUM_PARAMETERS == Eigen::Dynamic;
+  template <typename M>
+  using Storage = std::conditional_t<kPooled, Eigen::Map<M>, M>;
+
+  template <typename M>
+  static auto Unseated() -> Storage<M> {
+    if constexpr (kPooled) {
+      return Storage<M>(nullptr, M::RowsAtCompileTime == 1 ? 1 : 0,
+                        M::ColsAtCompileTime == 1 ? 1 : 0);
+    } else {
+      return M{};
+    }
+  }
+
   LinearSolver linear_solver_;
   Scalar cost_;
-  ParameterVector dx_, x_new_, g_, jacobi_scaling_, lm_step_;
-  ResidualVector residuals_, f_x_new_;
-  JacobianMatrix jacobian_;
-  HessianMatrix jtj_, jtj_regularized_;
+  Storage<ParameterVector> dx_ = Unseated<ParameterVector>();
+  Storage<ParameterVector> x_new_ = Unseated<ParameterVector>();
+  Storage<ParameterVector> g_ = Unseated<ParameterVector>();
+  Storage<ParameterVector> jacobi_scaling_ = Unseated<ParameterVector>();
+  Storage<ParameterVector> lm_step_ = Unseated<ParameterVector>();
+  Storage<ParameterVector> jtj_step_ = Unseated<ParameterVector>();
+  Storage<ResidualVector> residuals_ = Unseated<ResidualVector>();
+  Storage<ResidualVector> f_x_new_ = Unseated<ResidualVector>();
+  Storage<JacobianMatrix> jacobian_ = Unseated<JacobianMatrix>();
+  Storage<HessianMatrix> jtj_ = Unseated<HessianMatrix>();
+  Storage<HessianMatrix> jtj_regularized_ = Unseated<HessianMatrix>();
+  Eigen::Matrix<Scalar, Eigen::Dynamic, 1> pool_;
 
   template <int R, int P>
   void Initialize(const Function& function) {
@@ -398,11 +451,35 @@ class TinySolver {
   }
 
   void Initialize(int num_residuals, int num_parameters) {
+    if constexpr (kPooled) {
+      const Eigen::Index n = num_residuals;
+      const Eigen::Index p = num_parameters;
+      const Eigen::Index size = 6 * p + 2 * n + n * p + 2 * p * p;
+      if (pool_.size() < size) {
+        pool_.resize(size);
+      }
+      Scalar* next = pool_.data();
+      auto seat = [&next](auto& member, Eigen::Index rows, Eigen::Index cols) {
+        using Map = std::remove_reference_t<decltype(member)>;
+        new (&member) Map(next, rows, cols);
+        next += rows * cols;
+      };
+      for (auto* v : {&dx_, &x_new_, &g_, &jacobi_scaling_, &lm_step_, &jtj_step_}) {
+        seat(*v, p, 1);
+      }
+      seat(residuals_, n, 1);
+      seat(f_x_new_, n, 1);
+      seat(jacobian_, n, p);
+      seat(jtj_, p, p);
+      seat(jtj_regularized_, p, p);
+      return;
+    }
     dx_.resize(num_parameters);
     x_new_.resize(num_parameters);
     g_.resize(num_parameters);
     jacobi_scaling_.resize(num_parameters);
     lm_step_.resize(num_parameters);
+    jtj_step_.resize(num_parameters);
     residuals_.resize(num_residuals);
     f_x_new_.resize(num_residuals);
     jacobian_.resize(num_residuals, num_parameters);
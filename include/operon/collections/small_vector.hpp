@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright 2019-2025 Heal Research
+// SPDX-FileCopyrightText: Copyright 2025-present Bogdan Burlacu and contributors
+#ifndef OPERON_SMALL_VECTOR_HPP
+#define OPERON_SMALL_VECTOR_HPP
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Operon {
+
+// Contiguous sequence that keeps up to N elements inline and only moves to
+// the heap beyond that. Restricted to trivially copyable element types, which
+// is all it is used for (fitness values): elements are copied bitwise and
+// never destroyed individually.
+//
+// The member names follow the standard containers so it is a contiguous
+// sized range (std::span, std::ranges algorithms, fmt and Catch printing all
+// work unchanged) and a drop-in for std::vector where only those operations
+// are used. Construction and assignment from a std::vector are implicit for
+// the same reason.
+template<typename T, std::size_t N>
+requires std::is_trivially_copyable_v<T>
+class SmallVector {
+    static_assert(N > 0, "SmallVector needs room for at least one inline element");
+
+public:
+    using value_type      = T;                     // NOLINT
+    using size_type       = std::size_t;           // NOLINT
+    using difference_type = std::ptrdiff_t;        // NOLINT
+    using reference       = T&;                    // NOLINT
+    using const_reference = T const&;              // NOLINT
+    using pointer         = T*;                    // NOLINT
+    using const_pointer   = T const*;              // NOLINT
+    using iterator        = T*;                    // NOLINT
+    using const_iterator  = T const*;              // NOLINT
+
+    static constexpr size_type InlineCapacity { N };
+
+    SmallVector() noexcept = default;
+    ~SmallVector() = default;
+
+    explicit SmallVector(size_type count, T const& value = T{}) { resize(count, value); }
+
+    SmallVector(std::initializer_list<T> values) { assign(values.begin(), values.end()); }
+
+    template<std::input_iterator It, std::sentinel_for<It> S>
+    SmallVector(It first, S last) { assign(first, last); }
+
+    template<typename Alloc>
+    SmallVector(std::vector<T, Alloc> const& values) { assign(values.begin(), values.end()); } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    SmallVector(SmallVector const& other) { assign(other.begin(), other.end()); }
+
+    SmallVector(SmallVector&& other) noexcept { Steal(other); }
+
+    auto operator=(SmallVector const& other) -> SmallVector& {
+        if (this != &other) { assign(other.begin(), other.end()); }
+        return *this;
+    }
+
+    auto operator=(SmallVector&& other) noexcept -> SmallVector& {
+        if (this != &other) { Steal(other); }
+        return *this;
+    }
+
+    auto operator=(std::initializer_list<T> values) -> SmallVector& {
+        assign(values.begin(), values.end());
+        return *this;
+    }
+
+    template<std::input_iterator It, std::sentinel_for<It> S>
+    auto assign(It first, S last) -> void { // NOLINT(readability-identifier-naming)
+        if constexpr (std::forward_iterator<It>) {
+            auto const count = static_cast<size_type>(std::ranges::distance(first, last));
+            reserve(count);
+            std::ranges::copy(first, last, data());
+            size_ = count;
+        } else {
+            clear();
+            for (; first != last; ++first) { push_back(*first); }
+        }
+    }
+
+    // capacity
+    [[nodiscard]] auto size() const noexcept -> size_type { return size_; } // NOLINT(readability-identifier-naming)
+    [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0; } // NOLINT(readability-identifier-naming)
+    [[nodiscard]] auto capacity() const noexcept -> size_type { return capacity_; } // NOLINT(readability-identifier-naming)
+    [[nodiscard]] auto is_inline() const noexcept -> bool { return heap_ == nullptr; } // NOLINT(readability-identifier-naming)
+
+    auto reserve(size_type count) -> void { // NOLINT(readability-identifier-naming)
+        if (count <= capacity_) { return; }
+        auto storage = std::make_unique_for_overwrite<T[]>(count); // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+        std::copy_n(data(), size_, storage.get());
+        heap_ = std::move(storage);
+        capacity_ = count;
+    }
+
+    auto resize(size_type count, T const& value = T{}) -> void { // NOLINT(readability-identifier-naming)
+        if (count > size_) {
+            auto const v = value; // `value` may alias an element moved by reserve
+            reserve(count);
+            std::fill(data() + size_, data() + count, v);
+        }
+        size_ = count;
+    }
+
+    auto push_back(T const& value) -> void { // NOLINT(readability-identifier-naming)
+        auto const v = value;
+        if (size_ == capacity_) { reserve(2 * capacity_); }
+        data()[size_++] = v;
+    }
+
+    auto clear() noexcept -> void { size_ = 0; } // NOLINT(readability-identifier-naming)
+
+    // element access
+    [[nodiscard]] auto data() noexcept -> pointer { return heap_ ? heap_.get() : inline_.data(); } // NOLINT(readability-identifier-naming)
+    [[nodiscard]] auto data() const noexcept -> const_pointer { return heap_ ? heap_.get() : inline_.data(); } // NOLINT(readability-identifier-naming)
+
+    auto operator[](size_type i) noexcept -> reference { return data()[i]; }
+    auto operator[](size_type i) const noexcept -> const_reference { return data()[i]; }
+
+    [[nodiscard]] auto front() noexcept -> reference { return (*this)[0]; } // NOLINT(readability-identifier-naming)
+    [[nodiscard]] auto front() const noexcept -> const_reference { return (*this)[0]; } // NOLINT(readability-identifier-naming)
+    [[nodiscard]] auto back() noexcept -> reference { return (*this)[size_ - 1]; } // NOLINT(readability-identifier-naming)
+    [[nodiscard]] auto back() const noexcept -> const_reference { return (*this)[size_ - 1]; } // NOLINT(readability-identifier-naming)
+
+    // iterators
+    [[nodiscard]] auto begin() noexcept -> iterator { return data(); } // NOLINT(readability-identifier-naming)
+    [[nodiscard]] auto begin() const noexcept -> const_iterator { return data(); } // NOLINT(readability-identifier-naming)
+    [[nodiscard]] auto end() noexcept -> iterator { return data() + size_; } // NOLINT(readability-identifier-naming)
+    [[nodiscard]] auto end() const noexcept -> const_iterator { return data() + size_; } // NOLINT(readability-identifier-naming)
+    [[nodiscard]] auto cbegin() const noexcept -> const_iterator { return begin(); } // NOLINT(readability-identifier-naming)
+    [[nodiscard]] auto cend() const noexcept -> const_iterator { return end(); } // NOLINT(readability-identifier-naming)
+
+    // comparison
+    friend auto operator==(SmallVector const& lhs, SmallVector const& rhs) -> bool {
+        return std::ranges::equal(lhs, rhs);
+    }
+
+    friend auto operator<=>(SmallVector const& lhs, SmallVector const& rhs) {
+        return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+private:
+    // heap storage changes hands; inline elements are copied
+    auto Steal(SmallVector& other) noexcept -> void {
+        if (other.heap_) {
+            heap_ = std::move(other.heap_);
+            capacity_ = other.capacity_;
+        } else {
+            heap_.reset();
+            capacity_ = N;
+            std::copy_n(other.inline_.data(), other.size_, inline_.data());
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+        other.capacity_ = N;
+    }
+
+    std::array<T, N> inline_{};
+    std::unique_ptr<T[]> heap_; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    size_type size_{0};
+    size_type capacity_{N};
+};
+
+} // namespace Operon
+
+#endif
@@ -5,8 +5,12 @@
 #ifndef DATASET_H
 #define DATASET_H
 
+#include <map>
+#include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include <gsl/pointers>
@@ -14,6 +18,7 @@
 
 #include "operon/operon_export.hpp"
 #include "contracts.hpp"
+#include "float16.hpp"
 #include "range.hpp"
 #include "types.hpp"
 #include "variable.hpp"
@@ -24,6 +29,47 @@ enum class DatasetError : std::uint8_t {
     VariableNotFound = 0,
 };
 
+// Non-owning view of a column's alternate-precision copy, spanning the
+// padded row count (same layout as GetPaddedValues). Values holds the 16-bit
+// encoding of Float16/BFloat16 columns, Wide the binary64 copy of Float64
+// columns; both are empty for columns stored at native precision only.
+struct CompressedColumn {
+    Span<std::uint16_t const> Values;
+    ColumnPrecision Precision { ColumnPrecision::Float32 };
+    Span<double const> Wide;
+};
+
+// Round-trip accuracy of a column under a given storage precision, computed
+// over the logical (unpadded) rows. Overflow counts finite inputs that became
+// +/-Inf (fp16, or float64 -> float32 narrowing). RangeRelError is
+// MaxAbsError relative to the column's spread (max - min): unlike the
+// per-value relative error, which is bounded by the format's epsilon for
+// any normal value, it exposes columns whose meaningful variation sits far
+// below their magnitude (timestamps, large offsets) and is what the float64
+// ingestion uses to decide which columns keep a 64-bit copy.
+struct ColumnPrecisionReport {
+    Operon::Hash Hash {};
+    ColumnPrecision Precision { ColumnPrecision::Float32 };
+    double MaxAbsError {};
+    double MaxRelError {};
+    double RangeRelError {};
+    double RootMeanSquaredError {};
+    std::size_t Overflow {};
+};
+
+// Univariate statistics of one column over one row range. Non-finite values
+// (and, for weighted statistics, rows with a non-finite or zero weight) are
+// excluded; Count is the number of rows that contributed. Variance is the
+// population (biased) variance, matching vstat. Min/Max are NaN when no row
+// contributed.
+struct ColumnStatistics {
+    double Mean {};
+    double Variance {};
+    double Min {};
+    double Max {};
+    std::size_t Count {};
+};
+
 class OPERON_EXPORT Dataset {
 public:
     using Variables = Operon::Map<Operon::Hash, Operon::Variable>;
@@ -39,11 +85,93 @@ private:
 
     std::optional<Vector<Scalar>> weights_;
 
+    // Per-column alternate-precision copies, indexed by column; empty for
+    // columns stored at native precision only. For Float64 columns, Wide is
+    // the source of truth and the native column holds its rounded values.
+    // See SetColumnPrecision and FromFloat64.
+    struct CompressedStorage {
+        Vector<std::uint16_t, AlignedAllocator<std::uint16_t, 32>> Values; // NOLINT(readability-magic-numbers)
+        ColumnPrecision Precision { ColumnPrecision::Float32 };
+        Vector<double, AlignedAllocator<double, 32>> Wide; // NOLINT(readability-magic-numbers)
+    };
+    std::vector<CompressedStorage> compressed_;
+
+    // Memoized GetColumnStatistics results keyed by (column, range start,
+    // range size, weighted). Read by every evaluator thread through a const
+    // Dataset, so lookups take a shared lock and only misses take the
+    // exclusive one. Copies carry the entries over; the mutex is never shared.
+    class StatisticsCache {
+    public:
+        using Key = std::tuple<int64_t, std::size_t, std::size_t, bool>;
+
+        StatisticsCache() = default;
+        StatisticsCache(StatisticsCache const& rhs) : entries_(rhs.Snapshot()) { }
+        StatisticsCache(StatisticsCache&& rhs) noexcept : entries_(std::move(rhs.entries_)) { }
+        ~StatisticsCache() = default;
+        auto operator=(StatisticsCache const& rhs) -> StatisticsCache& { if (this != &rhs) { entries_ = rhs.Snapshot(); } return *this; }
+        auto operator=(StatisticsCache&& rhs) noexcept -> StatisticsCache& { entries_ = std::move(rhs.entries_); return *this; }
+
+        void Swap(StatisticsCache& rhs) noexcept { entries_.swap(rhs.entries_); }
+
+        [[nodiscard]] auto Find(Key const& key) const -> std::optional<ColumnStatistics> {
+            std::shared_lock lock(mutex_);
+            auto it = entries_.find(key);
+            return it == entries_.end() ? std::nullopt : std::optional{it->second};
+        }
+
+        void Insert(Key const& key, ColumnStatistics const& stats) {
+            std::unique_lock lock(mutex_);
+            entries_.insert_or_assign(key, stats);
+        }
+
+        // Drops every entry for column `index`, or every entry when index < 0.
+        void Invalidate(int64_t index = -1) {
+            std::unique_lock lock(mutex_);
+            if (index < 0) { entries_.clear(); return; }
+            std::erase_if(entries_, [index](auto const& e) { return std::get<0>(e.first) == index; });
+        }
+
+        // Drops the weighted entries (the weights changed, the columns did not).
+        void InvalidateWeighted() {
+            std::unique_lock lock(mutex_);
+            std::erase_if(entries_, [](auto const& e) { return std::get<3>(e.first); });
+        }
+
+        [[nodiscard]] auto Size() const -> std::size_t {
+            std::shared_lock lock(mutex_);
+            return entries_.size();
+        }
+
+    private:
+        [[nodiscard]] auto Snapshot() const -> std::map<Key, ColumnStatistics> {
+            std::shared_lock lock(mutex_);
+            return entries_;
+        }
+
+        mutable std::shared_mutex mutex_;
+        std::map<Key, ColumnStatistics> entries_;
+    };
+    StatisticsCache statistics_;
+
+    // Per-NUMA-node copies of the padded column data (index = node), empty
+    // unless EnableNumaReplication was called. storage_/view_ stay the
+    // canonical copy that every mutation writes to; SyncReplicas propagates.
+    std::vector<Storage> replicas_;
+
     struct ViewTag {};
     Dataset(ViewTag, gsl::not_null<Scalar const*> data, int rows, int cols);
 
     auto ReadCsv(std::string const& path, bool hasHeader) -> std::pair<Storage, int>;
+    static auto FromFloat64Columns(Variables vars, std::vector<double> const& columns, int rows, double tolerance) -> std::pair<Dataset, std::vector<ColumnPrecisionReport>>;
+    auto AdoptFloat64(std::vector<double> const& columns, int rows, double tolerance) -> std::vector<ColumnPrecisionReport>;
+    [[nodiscard]] auto WideColumn(int64_t index) noexcept -> double*;
     void InitializeVariables(std::vector<std::string> const&);
+    void Recompress(int64_t index);
+    void SyncReplicas(int64_t index = -1);
+
+    // Base pointer of the padded column data closest to the calling thread:
+    // the replica of its NUMA node when replication is on, view_ otherwise.
+    [[nodiscard]] auto LocalData() const noexcept -> Scalar const*;
 
     [[nodiscard]] auto ColSpan(int idx) const noexcept -> Span<Scalar const> {
         return { view_.data_handle() + (static_cast<ptrdiff_t>(idx) * view_.extent(0)), static_cast<size_t>(rows_) };
@@ -58,6 +186,25 @@ public:
     Dataset(Dataset const& rhs);
     Dataset(Dataset&& rhs) noexcept;
 
+    // Float64 ingestion. Sources holding doubles are narrowed to Scalar as
+    // usual, but every column is audited first: a column whose narrowing
+    // error exceeds `tolerance` relative to its spread (RangeRelError), or
+    // that overflows, keeps its exact binary64 values as a Float64 column
+    // (see SetColumnPrecision) - the interpreter loads those through a
+    // mixed-precision path. A Float64 column is stored twice, as its Scalar
+    // narrowing plus the binary64 copy, so it costs 12 bytes per row in
+    // float builds instead of 4; only the columns that fail the audit pay
+    // this. The binary64 copy is the one that counts: column statistics,
+    // Normalize/Standardize, the interpreter and the linear scaling of a
+    // Float64 target all read it, and the JIT interprets any tree that
+    // reads such a column. Only GetValues, which returns Scalar spans,
+    // hands out the narrowing. Returns the
+    // dataset and one report per column (Precision says which way each
+    // column went). In double builds nothing is narrowed and the reports
+    // are all zero.
+    static auto FromFloat64(std::vector<std::string> const& vars, std::vector<std::vector<double>> const& vals, double tolerance = 1e-6) -> std::pair<Dataset, std::vector<ColumnPrecisionReport>>; // NOLINT(readability-magic-numbers)
+    static auto ReadFloat64(std::string const& path, bool hasHeader = false, double tolerance = 1e-6) -> std::pair<Dataset, std::vector<ColumnPrecisionReport>>; // NOLINT(readability-magic-numbers)
+
     ~Dataset() = default;
 
     auto operator=(Dataset rhs) -> Dataset& { Swap(rhs); return *this; }
@@ -116,10 +263,16 @@ public:
     void SetWeights(Span<Scalar const> w);
     [[nodiscard]] auto Weights() const noexcept -> std::optional<Span<Scalar const>>;
 
-    void Shuffle(Operon::RandomGenerator& random);
+    // Row permutation (row k of the result is row perm[k] of the input),
+    // applied to every column and to the weights. Columns are processed in
+    // small groups through one scratch buffer of a group's size, each group
+    // split into row blocks that run in parallel on `nthread` threads
+    // (0 = hardware concurrency; datasets below ~1M values always run
+    // serially). Shuffle applies a random permutation.
+    void Shuffle(Operon::RandomGenerator& random, std::size_t nthread = 0);
     void Normalize(size_t i, Range range);
     void Standardize(size_t i, Range range);
-    void PermuteRows(std::vector<int> const& perm);
+    void PermuteRows(std::vector<int> const& perm, std::size_t nthread = 0);
 
     // Overwrites the [range.Start(), range.Start() + range.Size()) slice of
     // one column in place - e.g. for permutation-importance-style analyses
@@ -128,6 +281,62 @@ public:
     // analyzers/permutation_importance.hpp). Rows outside `range` and every
     // other column are untouched.
     void SetValues(Operon::Hash hash, Range range, Span<Scalar const> values);
+
+    // Mean, variance, min and max of a column over `range`, computed once and
+    // memoized: target variance (skip-nonfinite penalty scale), Standardize/
+    // Normalize and interval-domain construction ask for the same columns over
+    // the same ranges over and over. Float64 columns are summarized from
+    // their binary64 values. With `weighted` set, statistics use the
+    // dataset weights (falls back to unweighted when there are none). Safe to
+    // call concurrently on a shared const dataset. Entries are invalidated by
+    // every mutation that changes values (SetValues, Normalize, Standardize,
+    // PermuteRows, Shuffle, SetColumnPrecision) and, for weighted entries,
+    // by SetWeights.
+    [[nodiscard]] auto GetColumnStatistics(int64_t index, Range range, bool weighted = false) const -> ColumnStatistics;
+    [[nodiscard]] auto GetColumnStatistics(Operon::Hash hash, Range range, bool weighted = false) const -> ColumnStatistics;
+    [[nodiscard]] auto CachedStatisticsCount() const -> std::size_t { return statistics_.Size(); }
+
+    // NUMA replication for multi-socket machines. Keeps one copy of the
+    // column data per NUMA node, each allocated and filled by a thread pinned
+    // to that node so first-touch places its pages in node-local memory.
+    // GetValues and GetPaddedValues then resolve to the replica of the
+    // calling thread's node - only meaningful when the callers are pinned
+    // (GeneticProgrammingAlgorithm::Run pins its workers when the problem's
+    // dataset is replicated; see NumaWorkerPinning for custom executors).
+    // Memory cost is one extra copy of the data per node. Mutations keep the
+    // replicas in sync; copies of a replicated dataset are not replicated.
+    // Compressed columns (SetColumnPrecision) are not replicated. Returns
+    // the number of replicas, 0 on single-node machines (no-op).
+    auto EnableNumaReplication() -> int;
+    void DisableNumaReplication() noexcept { replicas_.clear(); }
+    [[nodiscard]] auto ReplicaCount() const noexcept -> int { return static_cast<int>(replicas_.size()); }
+
+    // Opt-in compressed column storage. Switching a column to Float16 or
+    // BFloat16 keeps a padded 16-bit copy that the interpreter's
+    // variable-load step widens to float32 on the fly, halving the column
+    // bytes streamed per evaluation. The full-precision column is rounded in
+    // place to the same representable values, so every other consumer
+    // (GetValues, the JIT's column loads, target/weight lookups) sees exactly
+    // what the interpreter sees. The rounding is lossy: switching back to
+    // Float32 drops the compressed copy but does not restore the original
+    // values. Returns the accuracy report for the conversion. Later
+    // mutations (Normalize, Standardize, SetValues, PermuteRows, Shuffle)
+    // re-encode compressed columns.
+    //
+    // Float64 on an existing dataset only widens the native values (the
+    // original doubles are gone); it makes later Normalize/Standardize run
+    // in double and lets the interpreter scale the column in double. For
+    // exact 64-bit columns load through FromFloat64/ReadFloat64 instead.
+    auto SetColumnPrecision(Operon::Hash hash, ColumnPrecision precision) -> ColumnPrecisionReport;
+
+    // Dry run of SetColumnPrecision: reports the accuracy loss without
+    // modifying the dataset. Also valid for non-owning datasets.
+    [[nodiscard]] auto AuditColumnPrecision(Operon::Hash hash, ColumnPrecision precision) const -> ColumnPrecisionReport;
+
+    [[nodiscard]] auto GetColumnPrecision(int64_t index) const noexcept -> ColumnPrecision;
+    [[nodiscard]] auto GetColumnPrecision(Operon::Hash hash) const noexcept -> ColumnPrecision;
+    [[nodiscard]] auto GetCompressedValues(int64_t index) const noexcept -> CompressedColumn;
+    [[nodiscard]] auto GetCompressedValues(Operon::Hash hash) const noexcept -> CompressedColumn;
 };
 
 } // namespace Operon
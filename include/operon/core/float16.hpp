@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright 2019-2025 Heal Research
+// SPDX-FileCopyrightText: Copyright 2025-present Bogdan Burlacu and contributors
+
+#ifndef OPERON_CORE_FLOAT16_HPP
+#define OPERON_CORE_FLOAT16_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+namespace Operon {
+
+// Storage precision of a dataset column. Float32 is the native
+// (Operon::Scalar) representation; Float16 (IEEE 754 binary16) and BFloat16
+// (truncated binary32) are opt-in compressed encodings that halve the bytes
+// streamed per evaluation - see Dataset::SetColumnPrecision. Float64 keeps a
+// binary64 copy next to the native column for precision-sensitive inputs
+// (see Dataset::FromFloat64); it is the native precision in double builds.
+enum class ColumnPrecision : std::uint8_t { Float32 = 0, Float16, BFloat16, Float64 };
+
+namespace Float16 {
+    // Round-to-nearest-even binary32 -> binary16, saturating to +/-Inf on
+    // overflow and preserving NaN (quieted). Branch structure follows the
+    // well-known "fast3_rtne" conversion: subnormal results are produced by
+    // an FP add against a magic constant, which rounds correctly as long as
+    // the FPU is in its default round-to-nearest mode.
+    inline auto FromFloat(float value) noexcept -> std::uint16_t
+    {
+        constexpr std::uint32_t infinity { 255U << 23U };
+        constexpr std::uint32_t halfMax { (127U + 16U) << 23U };
+        constexpr std::uint32_t minNormal { 113U << 23U };
+        constexpr std::uint32_t denormMagic { ((127U - 15U) + (23U - 10U) + 1U) << 23U };
+
+        auto bits = std::bit_cast<std::uint32_t>(value);
+        auto const sign = bits & 0x80000000U;
+        bits ^= sign;
+
+        std::uint32_t out{};
+        if (bits >= halfMax) {
+            out = bits > infinity ? 0x7E00U : 0x7C00U;
+        } else if (bits < minNormal) {
+            auto const f = std::bit_cast<float>(bits) + std::bit_cast<float>(denormMagic);
+            out = std::bit_cast<std::uint32_t>(f) - denormMagic;
+        } else {
+            auto const odd = (bits >> 13U) & 1U;
+            bits += ((15U - 127U) << 23U) + 0xFFFU;
+            bits += odd;
+            out = bits >> 13U;
+        }
+        return static_cast<std::uint16_t>(out | (sign >> 16U));
+    }
+
+    inline auto ToFloat(std::uint16_t value) noexcept -> float
+    {
+        auto const sign = static_cast<std::uint32_t>(value & 0x8000U) << 16U;
+        auto exp = static_cast<std::uint32_t>(value >> 10U) & 0x1FU;
+        auto man = static_cast<std::uint32_t>(value) & 0x3FFU;
+
+        std::uint32_t bits{};
+        if (exp == 0) {
+            if (man == 0) {
+                bits = sign;
+            } else {
+                // subnormal half: renormalize into a (normal) binary32
+                exp = 1;
+                while ((man & 0x400U) == 0) { man <<= 1U; --exp; }
+                man &= 0x3FFU;
+                bits = sign | ((exp + 112U) << 23U) | (man << 13U);
+            }
+        } else if (exp == 0x1FU) {
+            bits = sign | 0x7F800000U | (man << 13U);
+        } else {
+            bits = sign | ((exp + 112U) << 23U) | (man << 13U);
+        }
+        return std::bit_cast<float>(bits);
+    }
+} // namespace Float16
+
+namespace BFloat16 {
+    // Round-to-nearest-even binary32 -> bfloat16 (upper half of the binary32
+    // bit pattern). Same exponent range as float32, so no overflow handling
+    // is needed; NaN payloads are forced quiet so rounding can't turn them
+    // into Inf.
+    inline auto FromFloat(float value) noexcept -> std::uint16_t
+    {
+        auto const bits = std::bit_cast<std::uint32_t>(value);
+        if ((bits & 0x7FFFFFFFU) > 0x7F800000U) {
+            return static_cast<std::uint16_t>((bits >> 16U) | 0x40U);
+        }
+        auto const odd = (bits >> 16U) & 1U;
+        return static_cast<std::uint16_t>((bits + 0x7FFFU + odd) >> 16U);
+    }
+
+    inline auto ToFloat(std::uint16_t value) noexcept -> float
+    {
+        return std::bit_cast<float>(static_cast<std::uint32_t>(value) << 16U);
+    }
+} // namespace BFloat16
+
+inline auto Compress(ColumnPrecision precision, float value) noexcept -> std::uint16_t
+{
+    return precision == ColumnPrecision::BFloat16 ? BFloat16::FromFloat(value) : Float16::FromFloat(value);
+}
+
+inline auto Decompress(ColumnPrecision precision, std::uint16_t value) noexcept -> float
+{
+    return precision == ColumnPrecision::BFloat16 ? BFloat16::ToFloat(value) : Float16::ToFloat(value);
+}
+
+// Widens `n` compressed values into float32. This is the interpreter's
+// variable-load step for compressed columns, so the fp16 case uses the F16C
+// `vcvtph2ps` instruction (eight lanes per step) when the target supports
+// it; the bf16 case is a plain shift that the compiler vectorizes on its own.
+inline auto Widen(ColumnPrecision precision, std::uint16_t const* src, float* dst, std::size_t n) noexcept -> void
+{
+    std::size_t i = 0;
+    if (precision == ColumnPrecision::BFloat16) {
+        for (; i < n; ++i) { dst[i] = BFloat16::ToFloat(src[i]); }
+        return;
+    }
+#if defined(__F16C__)
+    for (; i + 8 <= n; i += 8) {
+        auto const h = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+    }
+#endif
+    for (; i < n; ++i) { dst[i] = Float16::ToFloat(src[i]); }
+}
+
+} // namespace Operon
+
+#endif
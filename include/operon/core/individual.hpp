@@ -8,6 +8,7 @@
 #include "comparison.hpp"
 #include "tree.hpp" 
 #include "types.hpp" 
+#include "operon/collections/small_vector.hpp"
 #include <cstddef>
 #include <functional>
 
@@ -15,9 +16,14 @@ namespace Operon {
 
 struct LexicographicalComparison; // fwd def
 
+// Objective values of an individual. Nearly every run has one to four
+// objectives, which are then stored inline: breeding, caching and scoring an
+// offspring never touch the allocator for its fitness.
+using FitnessVector = SmallVector<Operon::Scalar, 4>;
+
 struct Individual {
     Tree Genotype;
-    Operon::Vector<Operon::Scalar> Fitness;
+    FitnessVector Fitness;
     size_t Rank{}; // domination rank; used by NSGA2
     Operon::Scalar Distance{}; // crowding distance; used by NSGA2
 
@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright 2019-2025 Heal Research
+// SPDX-FileCopyrightText: Copyright 2025-present Bogdan Burlacu and contributors
+
+#ifndef OPERON_CORE_NUMA_HPP
+#define OPERON_CORE_NUMA_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include "operon/operon_export.hpp"
+
+// Minimal NUMA topology queries, read from sysfs on Linux (no libnuma
+// dependency). Every other platform - and Linux machines without
+// /sys/devices/system/node - reports a single node, which turns the
+// replication and pinning code paths into no-ops.
+namespace Operon::Numa {
+
+// Number of NUMA nodes with at least one online CPU (>= 1).
+OPERON_EXPORT auto NodeCount() -> int;
+
+// Node of the CPU the calling thread is currently running on. Meant for
+// threads pinned with PinCurrentThread; for an unpinned thread the answer
+// is only a snapshot. Returns 0 when the topology is unknown.
+OPERON_EXPORT auto CurrentNode() noexcept -> int;
+
+// Online CPUs of `node`, ascending.
+OPERON_EXPORT auto NodeCpus(int node) -> std::vector<int>;
+
+// Restricts the calling thread to the CPUs of `node`. Returns false (and
+// leaves the affinity untouched) when that is not possible.
+OPERON_EXPORT auto PinCurrentThread(int node) -> bool;
+
+// Node assignment for worker `id` out of `workers`: contiguous blocks, so
+// workers 0..k-1 share node 0 and so on, matching the order in which
+// hardware threads are numbered on common dual-socket layouts.
+inline auto WorkerNode(std::size_t id, std::size_t workers, int nodes) noexcept -> int
+{
+    if (nodes <= 1 || workers == 0) { return 0; }
+    return static_cast<int>(id * static_cast<std::size_t>(nodes) / workers);
+}
+
+} // namespace Operon::Numa
+
+#endif
@@ -125,6 +125,14 @@ public:
         return dataset_->GetValues(target_.Index).subspan(range.Start(), range.Size());
     }
 
+    // The exact binary64 target values when the target is a Float64 column
+    // (see Dataset::FromFloat64), empty otherwise; TargetValues returns
+    // their Scalar narrowing.
+    [[nodiscard]] auto WideTargetValues(Operon::Range range) const -> Operon::Span<double const> {
+        auto const wide = dataset_->GetCompressedValues(static_cast<int64_t>(target_.Index)).Wide;
+        return wide.empty() ? wide : wide.subspan(range.Start(), range.Size());
+    }
+
     [[nodiscard]] auto Weights(Operon::Range range) const -> std::optional<Operon::Span<Operon::Scalar const>> {
         auto w = dataset_->Weights();
         if (!w) { return std::nullopt; }
@@ -157,4 +157,23 @@ struct HessianDag {
 
 OPERON_EXPORT auto BuildHessianDag(Tree const& tree) -> HessianDag;
 
+// Whether BuildJacobianDag/BuildHessianDag differentiate every node of the
+// tree. Their Deriv() answers Zero both for a derivative that vanishes and
+// for an op it has no rule for (Aq/Powabs/Fmin/Fmax, Abs/Sqrtabs/Floor/Ceil,
+// n-ary Div, unregistered user functions), so a dag built from a tree that
+// fails this check can silently drop terms. Consumers that need exact
+// derivatives check this first and fall back to numeric differentiation.
+OPERON_EXPORT auto HasSymbolicDerivatives(Tree const& tree) -> bool;
+
+// Positions (in GetCoefficients() order) of coefficients the tree's output is
+// jointly linear in, so that f = sum_k c_k * phi_k(rest) + g(rest): every
+// diagonal and mixed second derivative among them vanishes. Read off the tree
+// structure directly rather than from a HessianDag, whose Zero sentinel also
+// stands for "no rule registered" and would pass a non-differentiable
+// function off as linear. A coefficient qualifies when every ancestor is an
+// Add or Sub, or a Mul that carries it as a direct leaf operand - at most
+// one per product, so no two of them ever multiply. The weights of the terms
+// in a top-level sum and the variable weights directly under it all qualify.
+OPERON_EXPORT auto LinearCoefficients(Tree const& tree) -> Operon::Vector<std::size_t>;
+
 } // namespace Operon
@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright 2019-2025 Heal Research
+// SPDX-FileCopyrightText: Copyright 2025-present Bogdan Burlacu and contributors
+
+#ifndef OPERON_HASH_SEMANTIC_HPP
+#define OPERON_HASH_SEMANTIC_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+#include "operon/core/dataset.hpp"
+#include "operon/core/dispatch.hpp"
+#include "operon/core/problem.hpp"
+#include "operon/core/tree.hpp"
+#include "operon/core/types.hpp"
+#include "operon/hash/zobrist.hpp"
+#include "operon/operon_export.hpp"
+
+namespace Operon {
+
+// Fingerprint of the model a semantic cache entry's optimized coefficients
+// produce (see SemanticCache::Insert).
+struct FingerprintData {
+    Hash OptimizedFingerprint{};
+};
+
+using SemanticEntry = CacheEntry<FitnessData, CoefficientData, FingerprintData>;
+
+// Fitness cache keyed by what a model computes rather than how it is written.
+// The Zobrist transposition table only matches structurally identical trees,
+// but crossover and mutation routinely produce trees that differ in
+// structure and compute the same function: commuted operands (x + y vs
+// y + x), regrouped sums, or subtrees that cancel. Such offspring would
+// otherwise pay for a full round of coefficient optimization only to land on
+// a fitness already known.
+//
+// A tree's fingerprint is its output, with its current coefficients, on a
+// small fixed set of probe rows sampled once from the training range,
+// quantized to a relative precision of 2^-QuantizationBits and hashed. Trees
+// with a non-finite output on any probe row get no fingerprint: every such
+// tree would otherwise collapse onto the same handful of values.
+//
+// An entry holds the fitness the first tree with that fingerprint scored
+// after local search, plus the coefficients it ended up with and the
+// fingerprint of the resulting model. A later candidate with the same
+// fingerprint takes the fitness that goes with those coefficients, but only
+// when they fit the candidate's layout and reproduce the stored model on the
+// probe rows (see OffspringGeneratorBase::Score), since two semantically
+// equal trees need not order their coefficients the same way. A candidate
+// they don't fit is scored as usual. Whether a candidate that takes the
+// fitness also keeps the coefficients is the Lamarckian draw, as for a
+// Zobrist hit: with pLamarck = 0 the fitness is reused Baldwin-style and
+// the candidate keeps its own coefficients.
+//
+// Like Zobrist, the fingerprint is an approximation: two models that agree on
+// every probe row to within the quantization step but differ elsewhere share
+// an entry. The probe rows are few but random, so this requires agreement at
+// points neither tree was built for.
+//
+// Ownership mirrors Zobrist: the caller constructs one per run and passes a
+// raw pointer into GeneticAlgorithmConfig::Semantic; `problem` and `dtable`
+// must outlive it.
+class OPERON_EXPORT SemanticCache {
+    struct Table;
+
+public:
+    static constexpr std::size_t DefaultProbeRows { 16 };
+    static constexpr int QuantizationBits { 16 };
+
+    SemanticCache(RandomGenerator& rng, Problem const& problem, ScalarDispatch const& dtable, std::size_t probeRows = DefaultProbeRows, std::size_t maxAge = 0);
+    ~SemanticCache();
+    SemanticCache(SemanticCache const&)            = delete;
+    SemanticCache(SemanticCache&&)                 = delete;
+    auto operator=(SemanticCache const&) -> SemanticCache& = delete;
+    auto operator=(SemanticCache&&)      -> SemanticCache& = delete;
+
+    // Fingerprint of `tree` with its current coefficients; nullopt if any
+    // probe output is non-finite. Thread-safe.
+    [[nodiscard]] auto Fingerprint(Tree const& tree) const -> std::optional<Hash>;
+
+    // Returns true and fills `entry` if the fingerprint is known; thread-safe.
+    // Counts towards Lookups() and applies the same age-based expiry as
+    // Zobrist::TryGet. A found entry is not yet a hit: the caller may still
+    // find that its coefficients don't fit, and calls RecordHit() only once
+    // it has actually reused the entry.
+    [[nodiscard]] auto TryGet(Hash fingerprint, SemanticEntry& entry) const -> bool;
+
+    // Counts a reused entry towards Hits(); thread-safe.
+    auto RecordHit() const -> void { hits_.fetch_add(1, std::memory_order_relaxed); }
+
+    // Records `fitness` for `fingerprint`, with the coefficients of the
+    // scored `tree` and their own fingerprint. First writer wins, as in
+    // Zobrist::Insert. Thread-safe.
+    auto Insert(Hash fingerprint, Tree const& tree, FitnessVector const& fitness) -> void;
+
+    // Clears the table and the counters; not safe concurrently with lookups.
+    auto Clear() -> void;
+
+    // Drops every entry, keeping the counters and the clock (see
+    // Zobrist::Invalidate).
+    auto Invalidate() -> void;
+
+    // Advances the generation clock used for age-based expiry.
+    auto SetGeneration(std::size_t generation) -> void;
+
+    [[nodiscard]] auto ProbeRows() const -> std::size_t { return static_cast<std::size_t>(probe_.Rows()); }
+    [[nodiscard]] auto Hits() const -> std::size_t { return hits_.load(std::memory_order_relaxed); }
+    [[nodiscard]] auto Lookups() const -> std::size_t { return lookups_.load(std::memory_order_relaxed); }
+    [[nodiscard]] auto Size() const -> std::size_t;
+
+private:
+    // The probe rows copied out of the problem's dataset into a dataset of
+    // their own (same variable names and therefore the same variable
+    // hashes), so a fingerprint is one contiguous interpreter call.
+    Dataset probe_;
+    gsl::not_null<ScalarDispatch const*> dtable_;
+    std::unique_ptr<Table> table_;
+
+    mutable std::atomic<std::size_t> hits_{0};
+    mutable std::atomic<std::size_t> lookups_{0};
+    mutable std::atomic<std::uint32_t> clock_{0};
+    std::size_t maxAge_{0};
+};
+
+} // namespace Operon
+
+#endif
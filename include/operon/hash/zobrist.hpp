@@ -12,6 +12,7 @@
 #include <gtl/phmap.hpp>
 
 #include "operon/core/node.hpp"
+#include "operon/core/individual.hpp"
 #include "operon/core/tree.hpp"
 #include "operon/core/types.hpp"
 #include "operon/hash/hash.hpp"
@@ -27,13 +28,22 @@ namespace Operon {
 template<typename... Data>
 struct CacheEntry : Data... {};
 
-// Fitness value produced by the evaluator after local search.
+// Fitness value produced by the evaluator after local search, stored the way
+// Individual holds it so a hit copies into the offspring without allocating.
 struct FitnessData {
-    Vector<Scalar>  Value;
+    FitnessVector   Value;
     std::uint32_t   InsertGeneration{0};
 };
 
+// Coefficients the cached fitness was computed with, so that a hit can hand
+// back the fitted model and not just its score. Left empty for entries whose
+// coefficients are unknown or were not asked for.
+struct CoefficientData {
+    Vector<Scalar>  Coefficients;
+};
+
 using FitnessEntry = CacheEntry<FitnessData>;
+using FittedEntry  = CacheEntry<FitnessData, CoefficientData>;
 
 // Thread-safe cache keyed by Operon::Hash, backed by gtl::parallel_flat_hash_map_m.
 template<typename Entry>
@@ -86,6 +96,17 @@ public:
 // must not share a cache entry.  IsEnabled is NOT hashed because disabled
 // nodes are erased by Tree::Reduce() before they reach ComputeHash.
 //
+// With storeCoefficients set, every entry also keeps the coefficients its
+// fitness was computed with (after local search). Without them a hit only
+// restores the score: the offspring keeps the coefficients it inherited,
+// which a Lamarckian run would otherwise have replaced with fitted ones, so
+// the model that is later recombined, re-evaluated or exported is worse than
+// its cached fitness says. Since the hash fixes the coefficient layout, the
+// stored coefficients always fit a tree that hits the entry. They cost
+// CoefficientBytes() on top of the table itself, whose entries also grow by
+// an (empty when unused) coefficient vector; a cache built without
+// storeCoefficients keeps plain fitness entries and pays for neither.
+//
 // Ownership: the caller constructs one Zobrist per experiment (or per run) and
 // passes a raw pointer into GeneticAlgorithmConfig::Cache.  The algorithm
 // borrows the pointer; the caller is responsible for lifetime.
@@ -114,6 +135,9 @@ class OPERON_EXPORT Zobrist {
     mutable std::atomic<std::size_t> hits_{0};
     mutable std::atomic<std::size_t> lookups_{0};
 
+    // bytes held by the stored coefficients (see CoefficientBytes)
+    mutable std::atomic<std::size_t> coefficientBytes_{0};
+
     // Generation clock ticked by the GA loop (see gp.cpp/nsga2.cpp) once per
     // generation. Used only to lazily expire stale entries in TryGet - see
     // maxAge_ below. Not related to hits_/lookups_.
@@ -125,11 +149,16 @@ class OPERON_EXPORT Zobrist {
     // is a pragmatic freshness/evolvability mitigation, not a memory bound.
     std::size_t maxAge_{0};
 
+    bool storeCoefficients_{false};
+
+    // shared body of the TryGet overloads; `coefficients` may be null
+    auto Find(Hash hash, FitnessVector& val, Vector<Scalar>* coefficients) const -> bool;
+
 public:
     // variableHashes must include every variable hash that can appear in a tree.
     // Each variable gets its own row of independent random values so that
     // permuting variables at different positions always yields a different hash.
-    Zobrist(RandomGenerator& rng, int maxLength, Span<Hash const> variableHashes, std::size_t maxAge = 0);
+    Zobrist(RandomGenerator& rng, int maxLength, Span<Hash const> variableHashes, std::size_t maxAge = 0, bool storeCoefficients = false);
     virtual ~Zobrist();
     Zobrist(Zobrist const&)            = delete;
     Zobrist(Zobrist&&)                 = delete;
@@ -139,6 +168,7 @@ public:
     [[nodiscard]] auto Rows() const { return table_.extent(0); }
     [[nodiscard]] auto Cols() const { return table_.extent(1); }
     [[nodiscard]] auto OptimizeRow() const { return static_cast<int>(Rows()) - 1; }
+    [[nodiscard]] auto StoresCoefficients() const -> bool { return storeCoefficients_; }
 
     [[nodiscard]] auto ComputeHash(Node const& n, int pos) const -> Hash
     {
@@ -174,19 +204,35 @@ public:
         return h;
     }
 
-    // Returns true and fills `val` if the hash is found; thread-safe.
+    // Returns true and fills `val` if the hash is found; thread-safe. The
+    // FitnessVector overload lets a generator write a hit straight into the
+    // offspring's fitness.
+    [[nodiscard]] auto TryGet(Hash hash, FitnessVector& val) const -> bool;
     [[nodiscard]] auto TryGet(Hash hash, Value& val) const -> bool;
 
+    // As above, and also fills `coefficients` with the entry's stored
+    // coefficients - empty if it has none.
+    [[nodiscard]] auto TryGet(Hash hash, FitnessVector& val, Vector<Scalar>& coefficients) const -> bool;
+
     // Inserts a newly-computed value for `hash`; thread-safe. A concurrent
     // race inserting the same hash first is not an error - the existing
     // entry's value is kept (first writer wins).
-    auto Insert(Hash hash, Value const& val) -> void;
+    auto Insert(Hash hash, FitnessVector const& val) -> void;
+
+    // As above, with the coefficients `val` was computed with; they are
+    // stored only if StoresCoefficients().
+    auto Insert(Hash hash, FitnessVector const& val, Span<Scalar const> coefficients) -> void;
 
     // Clears the transposition table and resets the hit counter.
     // NOT safe to call concurrently with TryGet or Insert — call only after
     // the algorithm has fully stopped (e.g. after GeneticAlgorithm::Run returns).
     auto Clear() -> void;
 
+    // Drops every entry but keeps the counters and the generation clock, for
+    // when the cached fitness values have gone stale mid-run (a new
+    // EvaluatorBase::Epoch). Same concurrency restriction as Clear.
+    auto Invalidate() -> void;
+
     // Advances the generation clock used by TryGet's age-based expiry.
     // Thread-safe; called once per generation from the GA loop.
     auto SetGeneration(std::size_t generation) -> void;
@@ -196,6 +242,9 @@ public:
     // needs to express an actual hit *rate* rather than a raw count.
     [[nodiscard]] auto Lookups() const -> std::size_t { return lookups_.load(std::memory_order_relaxed); }
     [[nodiscard]] auto Size() const -> std::size_t;
+
+    // Heap memory held by stored coefficients, in bytes.
+    [[nodiscard]] auto CoefficientBytes() const -> std::size_t { return coefficientBytes_.load(std::memory_order_relaxed); }
 };
 
 } // namespace Operon
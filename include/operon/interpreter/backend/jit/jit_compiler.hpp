@@ -14,6 +14,7 @@
 #include <memory>
 #include <vector>
 
+#include "operon/core/dataset.hpp"
 #include "operon/core/hash_registry.hpp"
 #include "operon/core/tree.hpp"
 #include "operon/core/tree_diff.hpp"
@@ -94,6 +95,15 @@ inline auto VarOrder(Operon::Tree const& tree) -> std::vector<Operon::Hash> {
     return order;
 }
 
+// Whether the tree reads a Float64 column (see Dataset::SetColumnPrecision).
+// The compiled functions load the float narrowing of every column, so
+// callers send such trees to the interpreter, which loads the exact values.
+inline auto ReadsFloat64Columns(Operon::Tree const& tree, Operon::Dataset const& dataset) -> bool {
+    return std::ranges::any_of(tree.Nodes(), [&](auto const& n) {
+        return n.IsVariable() && dataset.GetColumnPrecision(n.HashValue) == ColumnPrecision::Float64;
+    });
+}
+
 // Holds one or both compiled functions for a single structural hash.
 // fn is compiled first (by GetOrCompile); jacFn is added lazily (by GetOrCompileJacobian).
 // rt* point into the JitRuntimePool owned by JitZobrist — must outlive this object.
@@ -67,7 +67,7 @@ public:
     JitEvaluator(JitEvaluator&&)                 = delete;
     JitEvaluator& operator=(JitEvaluator&&)      = delete;
 
-    auto Evaluate(RandomGenerator& rng, Individual const& ind, Span<Scalar> buf) const -> ReturnType override;
+    auto EvaluateInto(RandomGenerator& rng, Individual const& ind, Span<Scalar> buf, Span<Scalar> fitness) const -> void override;
 
     [[nodiscard]] auto CacheSize()   const -> std::size_t;
     [[nodiscard]] auto CacheHits()   const -> std::size_t { return hits_.load(); }
@@ -6,6 +6,7 @@
 #define OPERON_INTERPRETER_HPP
 
 #include <algorithm>
+#include <array>
 #include <gsl/pointers>
 #include <optional>
 #include <span>
@@ -40,6 +41,14 @@ struct InterpreterBase {
     virtual auto JacRev(Operon::Span<T const> coeff, Operon::Range range, Operon::Span<T> jacobian) const -> void = 0;
     virtual auto JacRev(Operon::Span<T const> coeff, Operon::Range range) const -> Eigen::Array<T, -1, -1> = 0;
 
+    // evaluate model output and reverse-mode jacobian together. The default
+    // runs the two passes back to back; Interpreter fuses them.
+    virtual auto EvaluateWithJacobian(Operon::Span<T const> coeff, Operon::Range range, Operon::Span<T> result, Operon::Span<T> jacobian) const -> void
+    {
+        Evaluate(coeff, range, result);
+        JacRev(coeff, range, jacobian);
+    }
+
     // evaluate model jacobian in forward mode
     virtual auto JacFwd(Operon::Span<T const> coeff, Operon::Range range, Operon::Span<T> jacobian) const -> void = 0;
     virtual auto JacFwd(Operon::Span<T const> coeff, Operon::Range range) const -> Eigen::Array<T, -1, -1> = 0;
@@ -60,9 +69,11 @@ struct InterpreterBase {
 };
 
 // Thread affinity: Evaluate/JacRev/JacFwd/... look const from the outside but
-// bind lazily into the `mutable` scratch state below (context_/primal_/trace_/
-// range_), then reuse that binding across calls for the same (tree, range) via
-// UpdateCoefficients — that's the bind-once/re-evaluate fast path. None of it
+// bind lazily into the `mutable` scratch state below (context_/primal_/trace_),
+// then reuse that binding across calls for the same tree via
+// UpdateCoefficients — that's the bind-once/re-evaluate fast path. The
+// binding does not depend on the range, so mini-batch optimizers that pick a
+// new sub-range every step keep it too. None of it
 // is synchronized, so a single Interpreter instance must not be called
 // concurrently from more than one thread. It's cheap to construct (just three
 // non-owning pointers), so the convention throughout this codebase is one
@@ -85,7 +96,7 @@ struct Interpreter : public InterpreterBase<T> {
     auto Trace() const { return trace_; }
 
     auto Evaluate(Operon::Span<T const> coeff, Operon::Range range, Operon::Span<T> result) const -> void final {
-        InitContext(coeff, range);
+        InitContext(coeff);
 
         auto const len{ static_cast<int64_t>(range.Size()) };
 
@@ -110,29 +121,16 @@ struct Interpreter : public InterpreterBase<T> {
     }
 
     auto JacRev(Operon::Span<T const> coeff, Operon::Range range, Operon::Span<T> jacobian) const -> void final {
-        InitContext(coeff, range);
-        auto const len{ static_cast<int64_t>(range.Size()) };
-        auto const& nodes = tree_->Nodes();
-        auto const nn { std::ssize(nodes) };
-
-        constexpr int64_t S{ BatchSize };
-        trace_ = Backend::Buffer<T, S>(S, nn);
-        Backend::Fill<T, S>(trace_, nn-1, T{1});
-
-        std::size_t j = 0;
-        auto const cols = BuildColumns([&](std::size_t i) -> std::size_t { return nodes[i].Optimize ? j++ : NoIndex; });
-
-        Eigen::Map<Eigen::Array<T, -1, -1>> jac(jacobian.data(), len, coeff.size());
-        // No zero-init needed: each Optimize node maps to a unique column
-        // (built via BuildColumns above), so every column is written
-        // exactly once (Accumulate=false, plain `=`).
+        JacRevImpl(coeff, range, jacobian, /*result=*/{});
+    }
 
-        for (auto row = 0L; row < len; row += S) {
-            ForwardPass(range, row, /*trace=*/true);
-            ReverseTraceGeneric<false>(range, row, cols.colOf,
-                [](std::size_t i, auto const& primal, T w) { return primal.col(static_cast<Eigen::Index>(i)) / w; },
-                jac);
-        }
+    // JacRev's traced forward pass already computes the model output batch
+    // by batch; this copies it out before the reverse sweep instead of
+    // running a second, untraced forward pass. `result` follows Evaluate's
+    // contract (written only when sized to the range), `jacobian` JacRev's
+    // (range.Size() x coeff.size(), column-major).
+    auto EvaluateWithJacobian(Operon::Span<T const> coeff, Operon::Range range, Operon::Span<T> result, Operon::Span<T> jacobian) const -> void final {
+        JacRevImpl(coeff, range, jacobian, result);
     }
 
     auto JacRev(Operon::Span<T const> coeff, Operon::Range range) const -> Eigen::Array<T, -1, -1> final {
@@ -143,16 +141,15 @@ struct Interpreter : public InterpreterBase<T> {
     }
 
     auto JacFwd(Operon::Span<T const> coeff, Operon::Range range, Operon::Span<T> jacobian) const -> void final {
-        InitContext(coeff, range);
+        InitContext(coeff);
         auto const& nodes = tree_->Nodes();
         auto const nNodes = std::ssize(nodes);
         auto const nRows  = static_cast<int>(range.Size());
 
-        trace_ = Backend::Buffer<T, BatchSize>(BatchSize, nNodes);
-        Backend::Fill<T, BatchSize>(trace_, nNodes-1, T{1});
+        ResetTrace(nNodes);
 
         std::size_t j = 0;
-        auto const cols = BuildColumns([&](std::size_t i) -> std::size_t { return nodes[i].Optimize ? j++ : NoIndex; });
+        auto const& cols = BuildColumns([&](std::size_t i) -> std::size_t { return nodes[i].Optimize ? j++ : NoIndex; });
 
         Eigen::Map<Eigen::Array<T, -1, -1>> jac(jacobian.data(), nRows, coeff.size());
         // No zero-init needed — see JacRev.
@@ -179,16 +176,15 @@ struct Interpreter : public InterpreterBase<T> {
     // coefficients (weights) rather than variable values — same underlying
     // adjoint sweep (ReverseTraceGeneric), different extraction point.
     auto JacRevVariable(Operon::Span<T const> coeff, Operon::Range range, Operon::Hash variable, Operon::Span<T> result) const -> void final {
-        InitContext(coeff, range);
+        InitContext(coeff);
         auto const len{ static_cast<int64_t>(range.Size()) };
         auto const& nodes = tree_->Nodes();
         auto const nn { std::ssize(nodes) };
 
         constexpr int64_t S{ BatchSize };
-        trace_ = Backend::Buffer<T, S>(S, nn);
-        Backend::Fill<T, S>(trace_, nn-1, T{1});
+        ResetTrace(nn);
 
-        auto const cols = BuildColumns([&](std::size_t i) -> std::size_t { return (nodes[i].IsVariable() && nodes[i].HashValue == variable) ? 0 : NoIndex; });
+        auto const& cols = BuildColumns([&](std::size_t i) -> std::size_t { return (nodes[i].IsVariable() && nodes[i].HashValue == variable) ? 0 : NoIndex; });
 
         Eigen::Map<Eigen::Array<T, -1, -1>> jac(result.data(), len, 1);
         jac.setZero(); // needed: multiple occurrences of `variable` can share column 0 (Accumulate=true) — cheap, single-column buffer
@@ -210,15 +206,14 @@ struct Interpreter : public InterpreterBase<T> {
     // Forward-mode counterpart to JacRevVariable — same relationship as
     // JacFwd has to JacRev.
     auto JacFwdVariable(Operon::Span<T const> coeff, Operon::Range range, Operon::Hash variable, Operon::Span<T> result) const -> void final {
-        InitContext(coeff, range);
+        InitContext(coeff);
         auto const& nodes = tree_->Nodes();
         auto const nNodes = std::ssize(nodes);
         auto const nRows  = static_cast<int>(range.Size());
 
-        trace_ = Backend::Buffer<T, BatchSize>(BatchSize, nNodes);
-        Backend::Fill<T, BatchSize>(trace_, nNodes-1, T{1});
+        ResetTrace(nNodes);
 
-        auto const cols = BuildColumns([&](std::size_t i) -> std::size_t { return (nodes[i].IsVariable() && nodes[i].HashValue == variable) ? 0 : NoIndex; });
+        auto const& cols = BuildColumns([&](std::size_t i) -> std::size_t { return (nodes[i].IsVariable() && nodes[i].HashValue == variable) ? 0 : NoIndex; });
 
         Eigen::Map<Eigen::Array<T, -1, -1>> jac(result.data(), nRows, 1);
         jac.setZero(); // needed — see JacRevVariable
@@ -242,7 +237,7 @@ struct Interpreter : public InterpreterBase<T> {
     auto EvaluateRoots(Operon::Span<T const> coeff, Operon::Range range,
                        Operon::Span<std::size_t const> roots) const -> Eigen::Array<T, -1, -1>
     {
-        InitContext(coeff, range);
+        InitContext(coeff);
 
         auto const len    = static_cast<int64_t>(range.Size());
         auto const nRoots = static_cast<Eigen::Index>(roots.size());
@@ -290,10 +285,15 @@ struct Interpreter : public InterpreterBase<T> {
 
 private:
     // private members
+    // The trailing CompressedColumn is non-empty only for variable nodes
+    // whose column is stored at 16-bit or 64-bit precision
+    // (Dataset::SetColumnPrecision, Dataset::FromFloat64); ForwardPass then
+    // loads from it instead of reading the Scalar span.
     using Data = std::tuple<T,
           std::span<T const>,
           std::optional<Dispatch::Callable<T, BatchSize> const>,
-          std::optional<Dispatch::CallableDiff<T, BatchSize> const> >;
+          std::optional<Dispatch::CallableDiff<T, BatchSize> const>,
+          Operon::CompressedColumn>;
 
     gsl::not_null<DTable const*> dtable_;
     gsl::not_null<Operon::Dataset const*> dataset_;
@@ -304,9 +304,42 @@ private:
     mutable Operon::Vector<Data> context_;
     mutable Backend::Buffer<T, BatchSize> primal_;
     mutable Backend::Buffer<T, BatchSize> trace_;
-    mutable Operon::Range range_{};
+    mutable Backend::Buffer<T, BatchSize> tangent_;
 
     // private methods
+    // Shared body of JacRev and EvaluateWithJacobian; `result` is empty for
+    // the former.
+    auto JacRevImpl(Operon::Span<T const> coeff, Operon::Range range, Operon::Span<T> jacobian, Operon::Span<T> result) const -> void {
+        InitContext(coeff);
+        auto const len{ static_cast<int64_t>(range.Size()) };
+        auto const& nodes = tree_->Nodes();
+        auto const nn { std::ssize(nodes) };
+
+        constexpr int64_t S{ BatchSize };
+        ResetTrace(nn);
+
+        std::size_t j = 0;
+        auto const& cols = BuildColumns([&](std::size_t i) -> std::size_t { return nodes[i].Optimize ? j++ : NoIndex; });
+
+        Eigen::Map<Eigen::Array<T, -1, -1>> jac(jacobian.data(), len, coeff.size());
+        // No zero-init needed: each Optimize node maps to a unique column
+        // (built via BuildColumns above), so every column is written
+        // exactly once (Accumulate=false, plain `=`).
+
+        auto const* root = primal_.data() + ((nn - 1) * S);
+        auto const writeResult = std::ssize(result) == len;
+
+        for (auto row = 0L; row < len; row += S) {
+            ForwardPass(range, row, /*trace=*/true);
+            if (writeResult) {
+                std::copy_n(root, std::min(S, len - row), result.data() + row);
+            }
+            ReverseTraceGeneric<false>(range, row, cols.colOf,
+                [](std::size_t i, auto const& primal, T w) { return primal.col(static_cast<Eigen::Index>(i)) / w; },
+                jac);
+        }
+    }
+
     auto ForwardPass(Operon::Range range, int row, bool trace = false) const -> void {
         auto const& nodes     = tree_->Nodes();
         auto const nNodes     = std::ssize(nodes);
@@ -321,15 +354,25 @@ private:
         for (auto i = 0L; i < nNodes; ++i) {
             if (nodes[i].IsConstant()) { continue; }
 
-            auto const& [ p, v, f, df ] = context_[i];
+            auto const& [ p, v, f, df, h ] = context_[i];
             auto* ptr = primal_.data() + (i * S);
+            auto const first = rangeStart + row; // the variable columns are bound whole
 
             if (nodes[i].IsRef()) {
                 EXPECT(static_cast<int64_t>(nodes[i].RefTo) < i); // backward reference invariant
                 auto const* src = primal_.data() + (static_cast<int64_t>(nodes[i].RefTo) * S);
                 std::copy_n(src, S, ptr);
             } else if (nodes[i].IsVariable()) {
-                std::ranges::transform(v.subspan(row, rem), ptr, [p](auto x) { return x * p; });
+                if (!h.Wide.empty()) {
+                    // Float64 column: scale in double so w*x is rounded once, from the exact x
+                    std::ranges::transform(h.Wide.subspan(first, rem), ptr, [p](double x) { return static_cast<T>(x * static_cast<double>(p)); });
+                } else if (h.Values.empty()) {
+                    std::ranges::transform(v.subspan(first, rem), ptr, [p](auto x) { return x * p; });
+                } else {
+                    std::array<float, S> wide; // NOLINT(cppcoreguidelines-pro-type-member-init)
+                    Operon::Widen(h.Precision, h.Values.data() + first, wide.data(), static_cast<std::size_t>(rem));
+                    std::ranges::transform(std::span(wide.data(), rem), ptr, [p](auto x) { return static_cast<Operon::Scalar>(x) * p; });
+                }
             } else {
                 std::invoke(*f, nodes, primal_, i, rg);
 
@@ -367,11 +410,16 @@ private:
         Operon::Vector<std::pair<std::size_t, std::size_t>> seeds;
     };
 
+    // Rebuilt in place on every call, so repeated Jacobians of one tree
+    // (every Levenberg-Marquardt iteration) reuse the same storage.
+    mutable Columns columns_;
+
     template <typename Predicate>
-    auto BuildColumns(Predicate predicate) const -> Columns {
+    auto BuildColumns(Predicate predicate) const -> Columns const& {
         auto const nNodes = static_cast<std::size_t>(tree_->Nodes().size());
-        Columns cols;
+        auto& cols = columns_;
         cols.colOf.assign(nNodes, NoIndex);
+        cols.seeds.clear();
         for (std::size_t i = 0; i < nNodes; ++i) {
             if (auto const col = predicate(i); col != NoIndex) {
                 cols.colOf[i] = col;
@@ -381,6 +429,19 @@ private:
         return cols;
     }
 
+    // Zero trace_ and seed the root's adjoint with one. The buffer is only
+    // reallocated when the node count changes, so a Jacobian per iteration
+    // of the same tree does not touch the heap.
+    auto ResetTrace(int64_t nNodes) const -> void {
+        constexpr int64_t S{ BatchSize };
+        if (trace_.extent(1) != nNodes) {
+            trace_ = Backend::Buffer<T, S>(S, nNodes);
+        } else {
+            std::ranges::fill_n(trace_.data(), S * nNodes, T{0});
+        }
+        Backend::Fill<T, S>(trace_, nNodes-1, T{1});
+    }
+
     // Shared forward-mode sweep behind JacFwd/JacFwdVariable. `seeds`: the
     // (node, column) pairs to seed-and-propagate (see BuildColumns).
     // `factor(i, primal, w)`: the local d(primal_i)/d(target) multiplier
@@ -400,7 +461,8 @@ private:
         constexpr int64_t S      = BatchSize;
         auto const remainingRows = std::min(S, rangeSize - row);
 
-        Eigen::Array<T, S, -1> dot(S, nNodes);
+        if (tangent_.extent(1) != nNodes) { tangent_ = Backend::Buffer<T, S>(S, nNodes); }
+        Eigen::Map<Eigen::Array<T, S, -1>> dot(tangent_.data(), S, nNodes);
 
         Eigen::Map<Eigen::Array<T, S, -1>> primal(primal_.data(), S, nNodes);
         Eigen::Map<Eigen::Array<T, S, -1>> trace(trace_.data(), S, nNodes);
@@ -486,11 +548,13 @@ private:
         }
     }
 
-    // Full bind: allocate primal_, build context_ with function/derivative pointers
-    // and variable data spans. Called once per unique (tree, range) pair.
-    auto BindTree(Operon::Range range) const {
+    // Full bind: allocate primal_, build context_ with function/derivative
+    // pointers and the variables' data columns. Nothing here depends on the
+    // range: the columns are bound whole and ForwardPass offsets into them,
+    // so this runs once per tree however often the range changes (SGD and
+    // L-BFGS with BatchSize() > 0 draw a new sub-range every step).
+    auto BindTree() const {
         auto const& nodes = tree_->Nodes();
-        auto const nRows  = static_cast<int64_t>(range.Size());
         auto const nNodes = std::ssize(nodes);
 
         constexpr int64_t S{ BatchSize };
@@ -504,8 +568,9 @@ private:
         for (int64_t i = 0; i < nNodes; ++i) {
             auto const& n = nodes[i];
             auto variableValues = n.IsVariable()
-                ? std::tuple_element_t<1, Data>(dataset_->GetValues(n.HashValue).subspan(range.Start(), range.Size()).data(), nRows)
+                ? std::tuple_element_t<1, Data>(dataset_->GetValues(n.HashValue))
                 : std::tuple_element_t<1, Data>{};
+            auto compressedValues = n.IsVariable() ? dataset_->GetCompressedValues(n.HashValue) : Operon::CompressedColumn{};
             auto nodeFunction   = dt->template TryGetFunction<T>(n.HashValue);
             auto nodeDerivative = dt->template TryGetDerivative<T>(n.HashValue);
 
@@ -513,13 +578,14 @@ private:
                 throw std::runtime_error(fmt::format("Missing primitive for node {}\n", n.Name()));
             }
 
-            context_.emplace_back(T{n.Value}, variableValues, nodeFunction, nodeDerivative);
+            context_.emplace_back(T{n.Value}, variableValues, nodeFunction, nodeDerivative, compressedValues);
         }
-        range_ = range;
     }
 
     // Cheap update: patch coefficient values in context_ and re-fill constant columns.
-    // Called on every optimizer step once BindTree has been called for this range.
+    // Called on every optimizer step once BindTree has been called. An empty
+    // `coeff` means the tree's own values, re-read from its nodes: the binding
+    // outlives the call, so the values of an earlier `coeff` must not stick.
     auto UpdateCoefficients(Operon::Span<T const> coeff) const {
         auto const& nodes = tree_->Nodes();
         auto const nNodes = std::ssize(nodes);
@@ -527,8 +593,8 @@ private:
 
         for (int64_t i = 0, j = 0; i < nNodes; ++i) {
             auto const& n = nodes[i];
-            if (!coeff.empty() && n.Optimize) {
-                std::get<0>(context_[i]) = T{coeff[j++]};
+            if (n.Optimize || coeff.empty()) {
+                std::get<0>(context_[i]) = n.Optimize && !coeff.empty() ? T{coeff[j++]} : T{n.Value};
             }
             if (n.IsConstant()) {
                 Backend::Fill<T, S>(primal_, i, std::get<0>(context_[i]));
@@ -536,8 +602,8 @@ private:
         }
     }
 
-    auto InitContext(Operon::Span<T const> coeff, Operon::Range range) const {
-        if (context_.empty() || range_ != range) { BindTree(range); }
+    auto InitContext(Operon::Span<T const> coeff) const {
+        if (context_.empty()) { BindTree(); }
         UpdateCoefficients(coeff);
     }
 };
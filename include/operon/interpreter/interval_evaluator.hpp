@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "operon/core/contracts.hpp"
+#include "operon/core/dataset.hpp"
 #include "operon/core/hash_registry.hpp"
 #include "operon/core/node.hpp"
 #include "operon/core/tree.hpp"
@@ -136,6 +137,23 @@ public:
     IntervalEvaluator(gsl::not_null<Operon::Tree const*> tree, DomainMap domains)
         : tree_(tree), domains_(std::move(domains)) {}
 
+    // Observed [min, max] of every dataset column over `range` - the usual
+    // way to bound a model over its training data. Min/max come from the
+    // dataset's statistics cache, so building domains for many trees over the
+    // same range scans each column once. Columns with no finite value in
+    // `range` are left out (a tree reading them throws from Evaluate()).
+    // AffineEvaluator::DomainMap is the same type.
+    [[nodiscard]] static auto DomainsFromDataset(Operon::Dataset const& dataset, Operon::Range range) -> DomainMap
+    {
+        DomainMap domains;
+        for (auto const& v : dataset.GetVariables()) {
+            auto const stats = dataset.GetColumnStatistics(v.Index, range);
+            if (stats.Count == 0) { continue; }
+            domains.insert({ v.Hash, { static_cast<Scalar>(stats.Min), static_cast<Scalar>(stats.Max) } });
+        }
+        return domains;
+    }
+
     [[nodiscard]] auto GetTree() const noexcept -> Operon::Tree const* { return tree_.get(); }
     [[nodiscard]] auto Domains() const noexcept -> DomainMap const& { return domains_; }
 
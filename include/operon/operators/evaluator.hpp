@@ -5,9 +5,12 @@
 #ifndef OPERON_EVALUATOR_HPP
 #define OPERON_EVALUATOR_HPP
 
+#include <algorithm>
 #include <atomic>
 #include <cmath>
+#include <cstdint>
 #include <functional>
+#include <numeric>
 #include <optional>
 #include <stdexcept>
 #include <utility>
@@ -88,6 +91,83 @@ auto OPERON_EXPORT FitLeastSquares(Operon::Span<float const> estimated, Operon::
 auto OPERON_EXPORT FitLeastSquares(Operon::Span<double const> estimated, Operon::Span<double const> target) noexcept -> std::pair<double, double>;
 auto OPERON_EXPORT FitLeastSquares(Operon::Span<float const> estimated, Operon::Span<float const> target, Operon::Span<float const> weights) noexcept -> std::pair<double, double>;
 auto OPERON_EXPORT FitLeastSquares(Operon::Span<double const> estimated, Operon::Span<double const> target, Operon::Span<double const> weights) noexcept -> std::pair<double, double>;
+// Against the exact values of a Float64 target (Problem::WideTargetValues)
+// instead of their float narrowing; `weights` may be empty.
+auto OPERON_EXPORT FitLeastSquares(Operon::Span<float const> estimated, Operon::Span<double const> target, Operon::Span<float const> weights) noexcept -> std::pair<double, double>;
+
+// The error metric of the least-squares scaled predictions (a*x+b, see
+// FitLeastSquares), computed in a single pass from the bivariate moments of
+// (estimated, target) without materializing the scaled values. nullopt when
+// there is no usable closed form: MAE, weighted SSE, non-finite moments, or
+// fits so close to perfect that the closed form loses precision. Callers
+// then scale and apply the metric directly.
+auto OPERON_EXPORT FusedScaledError(ErrorType type, Operon::Span<float const> estimated, Operon::Span<float const> target, Operon::Span<float const> weights = {}) -> std::optional<double>;
+auto OPERON_EXPORT FusedScaledError(ErrorType type, Operon::Span<double const> estimated, Operon::Span<double const> target, Operon::Span<double const> weights = {}) -> std::optional<double>;
+
+// Model output of one individual, interpreted once and handed to every
+// evaluator that scores the same individual inside a MultiEvaluator call.
+// A common multi-objective setup (e.g. an error metric, MDL and length)
+// would otherwise interpret the same tree over the same training range once
+// per objective. MultiEvaluator::Evaluate opens a Scope for the individual
+// on the calling thread; Evaluator<DTable>::Predict then takes the values
+// (and the Jacobian, when one was published) from the share if they match
+// the dataset and range it needs, or interprets the tree itself and
+// publishes the result for the evaluators that follow. Published values are
+// the raw model output, before any linear scaling. Outside a scope there is
+// no share and every evaluator interprets on its own, as before.
+class OPERON_EXPORT PredictionShare {
+public:
+    // Opens the calling thread's share for `tree` unless one is already
+    // open (a nested MultiEvaluator on the same individual reuses the outer
+    // share; one on a different tree simply finds no match).
+    class OPERON_EXPORT Scope {
+    public:
+        explicit Scope(Operon::Tree const* tree);
+        ~Scope();
+
+        Scope(Scope const&) = delete;
+        Scope(Scope&&) = delete;
+        auto operator=(Scope const&) -> Scope& = delete;
+        auto operator=(Scope&&) -> Scope& = delete;
+
+    private:
+        bool owner_{false};
+    };
+
+    // The calling thread's share if a scope is open for `tree` and nothing
+    // has been published yet, or the published values belong to `dataset`
+    // and `range`; nullptr otherwise.
+    static auto Find(Operon::Tree const* tree, Operon::Dataset const* dataset, Operon::Range range) -> PredictionShare*;
+
+    [[nodiscard]] auto Values() const -> Operon::Span<Operon::Scalar const> { return { values_.data(), size_ }; }
+    [[nodiscard]] auto Jacobian() const -> Operon::Span<Operon::Scalar const> { return { jacobian_.data(), jacobianSize_ }; }
+
+    // Copies `values` (and `jacobian`, if not empty) into the share. The
+    // storage is per thread and only grows, so steady-state publishing does
+    // not allocate.
+    auto Publish(Operon::Dataset const* dataset, Operon::Range range, Operon::Span<Operon::Scalar const> values, Operon::Span<Operon::Scalar const> jacobian = {}) -> void;
+
+private:
+    auto Open(Operon::Tree const* tree) -> void;
+
+    Operon::Tree const* tree_{nullptr};
+    Operon::Dataset const* dataset_{nullptr};
+    Operon::Range range_;
+    Operon::Vector<Operon::Scalar> values_;
+    Operon::Vector<Operon::Scalar> jacobian_;
+    std::size_t size_{0};
+    std::size_t jacobianSize_{0};
+};
+
+// The evaluation counters reported by EvaluatorBase::Stats, summed over the
+// sub-evaluators of a MultiEvaluator.
+struct EvaluatorStats {
+    std::size_t ResidualEvaluations{0};
+    std::size_t JacobianEvaluations{0};
+    std::size_t CallCount{0};
+    std::size_t CostFunctionTime{0}; // microseconds
+    std::size_t SavedRowEvaluations{0}; // rows skipped by early abort
+};
 
 // EvaluatorBase inherits OperatorBase once, like every other operator family
 // (CreatorBase, MutatorBase, CrossoverBase, ...) - the buffered 3-arg shape is
@@ -99,10 +179,14 @@ auto OPERON_EXPORT FitLeastSquares(Operon::Span<double const> estimated, Operon:
 // `operator() override { return Evaluate(rng, ind); }` boilerplate in every
 // class. The fix keeps the single-inheritance shape uniform with every other
 // family and splits the two roles `operator()` was playing:
-//   - `Evaluate(rng, ind, buf)` below is the ONE hook subclasses override to
-//     score an individual. It is NOT named `operator()`, so a subclass
-//     overriding it never declares an `operator()` of its own and therefore
-//     can never trigger name hiding.
+//   - `EvaluateInto(rng, ind, buf, fitness)` below is the hook subclasses
+//     override to score an individual. It is NOT named `operator()`, so a
+//     subclass overriding it never declares an `operator()` of its own and
+//     therefore can never trigger name hiding. `Evaluate(rng, ind, buf)`
+//     returns the objectives in a fresh vector by calling it. Subclasses
+//     written before EvaluateInto existed (pyoperon's among them) override
+//     `Evaluate` instead; for them EvaluateInto's default forwards to it.
+//     That route is deprecated and will be removed: override EvaluateInto.
 //   - EvaluatorBase itself closes out OperatorBase's pure-virtual
 //     `operator()(rng, ind, buf)` with a `final` override that just forwards
 //     to `Evaluate` (no subclass can re-override it, so hiding never has a
@@ -119,6 +203,11 @@ struct EvaluatorBase : public OperatorBase<Operon::Vector<Operon::Scalar>, Opero
     mutable std::atomic_ulong JacobianEvaluations { 0 }; // NOLINT
     mutable std::atomic_ulong CallCount { 0 }; // NOLINT
     mutable std::atomic_ulong CostFunctionTime { 0 }; // NOLINT
+    // Early-abort bookkeeping (see EvaluateBounded): individuals rejected
+    // before their full training range was interpreted, and the rows those
+    // rejections skipped.
+    mutable std::atomic_ulong RejectedEvaluations { 0 }; // NOLINT
+    mutable std::atomic_ulong SavedRowEvaluations { 0 }; // NOLINT
 
     static constexpr size_t DefaultEvaluationBudget = 100'000;
 
@@ -135,15 +224,25 @@ struct EvaluatorBase : public OperatorBase<Operon::Vector<Operon::Scalar>, Opero
     }
 
     // Closes out OperatorBase's pure-virtual 3-arg operator() by forwarding
-    // to the Evaluate hook below. `final` so no subclass can re-declare
+    // to Evaluate below. `final` so no subclass can re-declare
     // operator() and reintroduce the name-hiding hazard this design avoids.
     auto operator()(Operon::RandomGenerator& rng, Operon::Individual const& ind, Operon::Span<Operon::Scalar> buf) const -> ReturnType final {
         return Evaluate(rng, ind, buf);
     }
 
-    // The single hook subclasses override. `buf` is a caller-owned scratch
-    // buffer of size >= TrainingRange().Size().
-    virtual auto Evaluate(Operon::RandomGenerator& rng, Operon::Individual const& ind, Operon::Span<Operon::Scalar> buf) const -> ReturnType = 0;
+    // The ObjectiveCount() objectives of `ind`, scored by EvaluateInto.
+    // `buf` is a caller-owned scratch buffer of size >=
+    // TrainingRange().Size(). Virtual only for the evaluators that predate
+    // EvaluateInto (see above); deprecated as an override point.
+    virtual auto Evaluate(Operon::RandomGenerator& rng, Operon::Individual const& ind, Operon::Span<Operon::Scalar> buf) const -> ReturnType
+    {
+        if (Forwarding() == this) {
+            throw std::logic_error("an evaluator must override EvaluateInto");
+        }
+        ReturnType fitness(ObjectiveCount());
+        EvaluateInto(rng, ind, buf, fitness);
+        return fitness;
+    }
 
     // 2-arg convenience: non-virtual deducing-this facade (can't be virtual -
     // explicit-object members can't be) that allocates a scratch buffer of
@@ -151,10 +250,56 @@ struct EvaluatorBase : public OperatorBase<Operon::Vector<Operon::Scalar>, Opero
     // Self deduces to the static type at the call site (including when the
     // call comes through an `EvaluatorBase&`), so this works polymorphically
     // without itself needing to be virtual. Buffer-size contract is on each
-    // concrete Evaluate override that actually reads/writes the buffer (they
+    // concrete EvaluateInto override that actually reads/writes the buffer (they
     // each carry their own ENSURE), not here: UserDefinedEvaluator and
     // DiversityEvaluator legitimately ignore `buf` and accept any size,
     // including the empty span pyoperon passes for UserDefinedEvaluator.
+    // Scores `ind` with a rejection threshold: an evaluator that can bound
+    // its own fitness from a prefix of the training range may stop as soon
+    // as that bound proves the final fitness would exceed `threshold`, and
+    // return { ErrMax } instead (counted in RejectedEvaluations /
+    // SavedRowEvaluations). A result that is not ErrMax is always the exact
+    // fitness Evaluate would have returned. Callers that discard offspring
+    // worse than a known target (OffspringSelectionGenerator) pass that
+    // target; the default implementation ignores it. Named differently from
+    // Evaluate for the same name-hiding reason as above.
+    virtual auto EvaluateBounded(Operon::RandomGenerator& rng, Operon::Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Scalar /*threshold*/) const -> ReturnType
+    {
+        return Evaluate(rng, ind, buf);
+    }
+
+    // The single hook subclasses override: scores `ind` and writes the
+    // ObjectiveCount() values into `fitness`. This is the path
+    // ScoreIndividual takes for every offspring, with `fitness` pointing
+    // into the individual's own inline FitnessVector, so scoring does not
+    // touch the allocator. `fitness` may alias ind.Fitness: implementations
+    // must not read the latter.
+    //
+    // The default serves the deprecated subclasses that override Evaluate:
+    // it copies that result into `fitness`, allocation and all.
+    virtual auto EvaluateInto(Operon::RandomGenerator& rng, Operon::Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Span<Operon::Scalar> fitness) const -> void
+    {
+        struct Restore { // NOLINT(cppcoreguidelines-special-member-functions,hicpp-special-member-functions)
+            EvaluatorBase const* Previous;
+            ~Restore() { Forwarding() = Previous; }
+        } const restore{ std::exchange(Forwarding(), this) };
+        auto const value = Evaluate(rng, ind, buf);
+        ENSURE(value.size() == fitness.size());
+        std::ranges::copy(value, fitness.begin());
+    }
+
+    // Scores `ind` on `range` (a window inside the training range) instead
+    // of the whole training range. Used by racing offspring generators
+    // (OffspringGeneratorBase::Race) to rank candidates cheaply before only
+    // the finalists are scored in full. Counts no CallCount or residual
+    // evaluation: the caller accounts for the partial work. Evaluators that
+    // cannot score a sub-range return std::nullopt (the default), which
+    // disables racing.
+    virtual auto EvaluateRange(Operon::RandomGenerator& /*rng*/, Operon::Individual const& /*ind*/, Operon::Span<Operon::Scalar> /*buf*/, Operon::Range /*range*/) const -> std::optional<ReturnType>
+    {
+        return std::nullopt;
+    }
+
     template<typename Self>
     auto operator()(this Self const& self, Operon::RandomGenerator& rng, Operon::Individual const& ind) -> ReturnType {
         std::vector<Operon::Scalar> buf(self.GetProblem()->TrainingRange().Size());
@@ -165,8 +310,18 @@ struct EvaluatorBase : public OperatorBase<Operon::Vector<Operon::Scalar>, Opero
     {
     }
 
+    // Changes whenever Prepare() has made an unchanged individual score
+    // differently (SubsampledEvaluator redrawing its rows): fitness cached
+    // under another epoch no longer applies.
+    virtual auto Epoch() const -> std::size_t { return 0; }
+
     virtual auto ObjectiveCount() const -> std::size_t { return 1UL; }
 
+    // Whether Evaluate needs the model Jacobian as well as its output.
+    // MultiEvaluator runs such evaluators first, so the single traced pass
+    // they publish to the PredictionShare also serves the others.
+    virtual auto UsesJacobian() const -> bool { return false; }
+
     auto TotalEvaluations() const -> size_t { return ResidualEvaluations + JacobianEvaluations; }
 
     void SetBudget(size_t value) { budget_ = value; }
@@ -175,12 +330,13 @@ struct EvaluatorBase : public OperatorBase<Operon::Vector<Operon::Scalar>, Opero
     // virtual because more complex evaluators (e.g. MultiEvaluator) might need to calculate it differently
     virtual auto BudgetExhausted() const -> bool { return TotalEvaluations() >= Budget(); }
 
-    virtual auto Stats() const -> std::tuple<std::size_t, std::size_t, std::size_t, std::size_t> {
-        return std::tuple{
-            ResidualEvaluations.load(),
-            JacobianEvaluations.load(),
-            CallCount.load(),
-            CostFunctionTime.load()
+    virtual auto Stats() const -> EvaluatorStats {
+        return EvaluatorStats{
+            .ResidualEvaluations = ResidualEvaluations.load(),
+            .JacobianEvaluations = JacobianEvaluations.load(),
+            .CallCount = CallCount.load(),
+            .CostFunctionTime = CostFunctionTime.load(),
+            .SavedRowEvaluations = SavedRowEvaluations.load()
         };
     }
 
@@ -195,9 +351,20 @@ struct EvaluatorBase : public OperatorBase<Operon::Vector<Operon::Scalar>, Opero
         JacobianEvaluations = 0;
         CallCount = 0;
         CostFunctionTime = 0;
+        RejectedEvaluations = 0;
+        SavedRowEvaluations = 0;
     }
 
 private:
+    // The evaluator whose default EvaluateInto is forwarding to Evaluate on
+    // this thread; Evaluate's default then finds itself called back by it,
+    // which means neither was overridden.
+    static auto Forwarding() -> EvaluatorBase const*&
+    {
+        thread_local EvaluatorBase const* forwarding{nullptr};
+        return forwarding;
+    }
+
     mutable Operon::Span<Operon::Individual const> population_;
     gsl::not_null<Problem const*> problem_;
     size_t budget_ = DefaultEvaluationBudget;
@@ -214,6 +381,22 @@ private:
 // without duplicating this logic.
 OPERON_EXPORT auto LocalSearch(Operon::RandomGenerator& random, Operon::Individual& ind, Operon::EvaluatorBase const& evaluator, Operon::CoefficientOptimizer const* coeffOptimizer, double pLocal, double pLamarck) -> std::optional<std::vector<Operon::Scalar>>;
 
+// LocalSearch over a contiguous block of individuals, with random[i]
+// belonging to individuals[i]: each individual makes the same random draws
+// as it would in LocalSearch, but the selected ones are optimized with a
+// single CoefficientOptimizer::OptimizeBatch call, so an optimizer that
+// shares work across a batch (BatchedLevenbergMarquardtOptimizer) gets to.
+// Returns, per individual, what LocalSearch would have returned.
+//
+// LocalSearchBlockSize is the block size the algorithms use for their
+// initial populations and, with an optimizer that batches
+// (OptimizerBase::Batched), for their offspring (see
+// OffspringGeneratorBase::GenerateBatch): large enough that the blocks'
+// trees fall into sizeable groups by coefficient count, small enough to
+// keep every worker busy on populations of a few hundred.
+inline constexpr std::size_t LocalSearchBlockSize { 64 };
+OPERON_EXPORT auto LocalSearchBatch(Operon::Span<Operon::RandomGenerator> random, Operon::Span<Operon::Individual> individuals, Operon::EvaluatorBase const& evaluator, Operon::CoefficientOptimizer const* coeffOptimizer, double pLocal, double pLamarck) -> std::vector<std::optional<std::vector<Operon::Scalar>>>;
+
 // Optionally applies local search (coefficient optimization) to `ind`'s
 // genotype with probability `pLocal`, then scores it via `evaluator`. Non-
 // finite fitness values are clamped to EvaluatorBase::ErrMax either way.
@@ -222,7 +405,20 @@ OPERON_EXPORT auto LocalSearch(Operon::RandomGenerator& random, Operon::Individu
 // initial-population scoring (GeneticProgrammingAlgorithm::Run,
 // NSGA2::Run) so both receive identical local-search treatment - passing
 // pLocal=0 (or a null coeffOptimizer) degenerates to a plain evaluate.
-OPERON_EXPORT auto ScoreIndividual(Operon::RandomGenerator& random, Operon::Individual& ind, Operon::EvaluatorBase const& evaluator, Operon::CoefficientOptimizer const* coeffOptimizer, double pLocal, double pLamarck, Operon::Span<Operon::Scalar> buf) -> void;
+//
+// A `threshold` below ErrMax routes the final evaluation through
+// EvaluatorBase::EvaluateBounded, so an evaluator with early abort enabled
+// may reject the individual (fitness ErrMax) without scoring every row.
+//
+// A non-null `scoredCoefficients` receives the coefficients the fitness was
+// computed with - the optimized ones even when a non-Lamarckian update then
+// restores the inherited coefficients into `ind`.
+OPERON_EXPORT auto ScoreIndividual(Operon::RandomGenerator& random, Operon::Individual& ind, Operon::EvaluatorBase const& evaluator, Operon::CoefficientOptimizer const* coeffOptimizer, double pLocal, double pLamarck, Operon::Span<Operon::Scalar> buf, Operon::Scalar threshold = EvaluatorBase::ErrMax, std::vector<Operon::Scalar>* scoredCoefficients = nullptr) -> void;
+
+// The second half of ScoreIndividual, for callers that ran the local search
+// themselves (LocalSearch, LocalSearchBatch): scores `ind` as it stands and
+// then restores `originalCoeffs`, if any.
+OPERON_EXPORT auto ScoreOptimized(Operon::RandomGenerator& random, Operon::Individual& ind, Operon::EvaluatorBase const& evaluator, std::optional<std::vector<Operon::Scalar>> const& originalCoeffs, Operon::Span<Operon::Scalar> buf, Operon::Scalar threshold = EvaluatorBase::ErrMax, std::vector<Operon::Scalar>* scoredCoefficients = nullptr) -> void;
 
 class OPERON_EXPORT UserDefinedEvaluator : public EvaluatorBase {
 public:
@@ -240,10 +436,12 @@ public:
     }
 
     auto
-    Evaluate(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> /*buf*/) const -> typename EvaluatorBase::ReturnType override
+    EvaluateInto(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> /*buf*/, Operon::Span<Operon::Scalar> fitness) const -> void override
     {
         ++this->CallCount;
-        return fptr_ ? fptr_(&rng, ind) : fref_(rng, ind);
+        auto const result = fptr_ ? fptr_(&rng, ind) : fref_(rng, ind);
+        ENSURE(result.size() == fitness.size());
+        std::ranges::copy(result, fitness.begin());
     }
 
 private:
@@ -274,9 +472,87 @@ public:
     }
 
     auto GetDispatchTable() const -> DTable const* { return dtable_.get(); }
+    auto GetErrorMetric() const -> ErrorMetric const& { return error_; }
+    auto LinearScaling() const -> bool { return scaling_; }
+
+    // Opt-in early abort for EvaluateBounded: the training range is
+    // interpreted in blocks (the first `rows` long, doubling afterwards) and
+    // after each block a lower bound on the final error is derived from the
+    // rows seen so far. Without linear scaling the partial sum of (weighted)
+    // squared or absolute errors is such a bound, since the remaining rows
+    // only add to it. With linear scaling the least-squares fit over the
+    // prefix is used: the full-range fit is one particular (a, b) for the
+    // prefix too, so its prefix error cannot be below the prefix optimum.
+    // The per-metric normalisation (row count or weight sum, target variance
+    // for NMSE) is over the full range and known up front. MAE is only
+    // bounded without scaling (the least-squares fit does not minimise it),
+    // R2/C2 are not prefix-monotone at all, and the skip-nonfinite penalty
+    // depends on the final non-finite fraction, so those combinations throw.
+    // 0 disables (the default).
+    void SetEarlyAbortRows(std::size_t rows)
+    {
+        if (rows > 0) {
+            auto const type = error_.Type();
+            if (type == ErrorType::R2 || type == ErrorType::C2 || (type == ErrorType::MAE && scaling_)) {
+                throw std::invalid_argument("early abort is only supported for sse, mse, nmse, rmse, and mae without linear scaling");
+            }
+            if (skipNonFinite_) {
+                throw std::invalid_argument("early abort is not supported together with --skip-nonfinite");
+            }
+        }
+        earlyAbortRows_ = rows;
+    }
+    auto EarlyAbortRows() const -> std::size_t { return earlyAbortRows_; }
+
+    auto
+    EvaluateBounded(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Scalar threshold) const -> typename EvaluatorBase::ReturnType override;
+
+    auto
+    EvaluateInto(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Span<Operon::Scalar> fitness) const -> void override;
 
+    // Error metric on `range` alone. Derived evaluators whose fitness is not
+    // the metric (MDL, BIC, ...) inherit this as a proxy: racing only uses
+    // it to rank candidates, the finalists are scored by Evaluate.
     auto
-    Evaluate(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf) const -> typename EvaluatorBase::ReturnType override;
+    EvaluateRange(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Range range) const -> std::optional<typename EvaluatorBase::ReturnType> override;
+
+protected:
+    // Writes the output of `tree` (with its current coefficients) on `range`
+    // into `estimated`, and its Jacobian into `jacobian` unless that is
+    // empty. Inside a MultiEvaluator call the result is taken from the
+    // thread's PredictionShare when another evaluator already published it
+    // for this individual, and published there otherwise. Residual and
+    // Jacobian evaluations are only counted for passes actually run.
+    auto Predict(Operon::Tree const& tree, Operon::Range range, Operon::Span<Operon::Scalar> estimated, Operon::Span<Operon::Scalar> jacobian = {}) const -> void
+    {
+        auto const* dataset = GetProblem()->GetDataset();
+        auto* share = PredictionShare::Find(&tree, dataset, range);
+        if (share != nullptr) {
+            auto const values = share->Values();
+            auto const jac = share->Jacobian();
+            if (values.size() == estimated.size() && (jacobian.empty() || jac.size() == jacobian.size())) {
+                std::ranges::copy(values, estimated.begin());
+                if (!jacobian.empty()) { std::ranges::copy(jac, jacobian.begin()); }
+                return;
+            }
+        }
+
+        TInterpreter const interpreter{dtable_, dataset, &tree};
+        auto const coeff = tree.GetCoefficients();
+        ++ResidualEvaluations;
+        if (jacobian.empty()) {
+            interpreter.Evaluate(coeff, range, estimated);
+        } else {
+            ++JacobianEvaluations;
+            interpreter.EvaluateWithJacobian(coeff, range, estimated, jacobian);
+        }
+        if (share != nullptr) { share->Publish(dataset, range, estimated, jacobian); }
+    }
+
+    // The error metric of `ind` over the training range, clamped to ErrMax
+    // when not finite; what EvaluateInto writes. Criteria derived from the
+    // error (BIC, AIC) start from it.
+    auto ComputeFitness(Individual const& ind, Operon::Span<Operon::Scalar> buf) const -> Operon::Scalar;
 
 private:
     gsl::not_null<DTable const*> dtable_;
@@ -295,6 +571,7 @@ private:
     // Default (false): non-finite metric result clamps fit to ErrMax.
     bool skipNonFinite_{false};
     double nonFinitePenaltyWeight_{1.0};
+    std::size_t earlyAbortRows_{0};
 };
 
 class OPERON_EXPORT MultiEvaluator : public EvaluatorBase {
@@ -327,6 +604,11 @@ public:
         }
     }
 
+    auto Epoch() const -> std::size_t override
+    {
+        return std::transform_reduce(evaluators_.begin(), evaluators_.end(), std::size_t{0}, std::plus{}, [](auto const eval) { return eval->Epoch(); });
+    }
+
     auto SetAggregateType(std::optional<AggregateType> type) { aggregateType_ = type; }
     auto ClearAggregateType() { aggregateType_ = std::nullopt; }
     auto GetAggregateType() const -> std::optional<AggregateType> { return aggregateType_; }
@@ -336,30 +618,32 @@ public:
         return aggregateType_ ? 1UL : SubEvaluatorObjectiveCount();
     }
 
-    auto
-    Evaluate(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf) const -> typename EvaluatorBase::ReturnType override;
+    auto UsesJacobian() const -> bool override
+    {
+        return std::ranges::any_of(evaluators_, [](auto const eval) { return eval->UsesJacobian(); });
+    }
 
-    auto Stats() const -> std::tuple<std::size_t, std::size_t, std::size_t, std::size_t> final {
-        auto resEval{0UL};
-        auto jacEval{0UL};
-        auto cfTime{0UL};
+    // Without an aggregate each sub-evaluator writes its objectives straight
+    // into its slice of `fitness`; with one, the per-evaluator objectives are
+    // gathered on the stack when they fit there.
+    auto
+    EvaluateInto(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Span<Operon::Scalar> fitness) const -> void override;
 
+    auto Stats() const -> EvaluatorStats final {
+        auto stats = EvaluatorBase::Stats();
         for (auto const& ev: evaluators_) {
-            auto [re, je, cc, ct] = ev->Stats();
-            resEval += re;
-            jacEval += je;
-            cfTime  += ct;
+            auto const s = ev->Stats();
+            stats.ResidualEvaluations += s.ResidualEvaluations;
+            stats.JacobianEvaluations += s.JacobianEvaluations;
+            stats.CostFunctionTime    += s.CostFunctionTime;
+            stats.SavedRowEvaluations += s.SavedRowEvaluations;
         }
-
-        return std::tuple{resEval + ResidualEvaluations.load(),
-            jacEval + JacobianEvaluations.load(),
-            CallCount.load(),
-            cfTime + CostFunctionTime.load()};
+        return stats;
     }
 
     auto BudgetExhausted() const -> bool final {
-        auto [re, je, cc, ct] = Stats();
-        return re + je >= Budget();
+        auto const stats = Stats();
+        return stats.ResidualEvaluations + stats.JacobianEvaluations >= Budget();
     }
 
     auto Evaluators() const { return evaluators_; }
@@ -370,6 +654,14 @@ private:
         return std::transform_reduce(evaluators_.begin(), evaluators_.end(), 0UL, std::plus {}, [](auto const eval) { return eval->ObjectiveCount(); });
     }
 
+    // Runs every sub-evaluator on `ind`, each writing into its own slice of
+    // `objectives` (SubEvaluatorObjectiveCount() values in insertion order).
+    auto EvaluateObjectives(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Span<Operon::Scalar> objectives) const -> void;
+
+    // Combines the sub-evaluator objectives according to aggregateType_;
+    // may reorder `objectives`.
+    auto Aggregate(Operon::Span<Operon::Scalar> objectives) const -> Operon::Scalar;
+
     std::vector<gsl::not_null<EvaluatorBase const*>> evaluators_;
     std::optional<AggregateType> aggregateType_;
 };
@@ -406,7 +698,7 @@ public:
     }
 
     auto
-    Evaluate(Operon::RandomGenerator& /*random*/, Individual const& ind, Operon::Span<Operon::Scalar> buf) const -> typename EvaluatorBase::ReturnType override;
+    EvaluateInto(Operon::RandomGenerator& random, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Span<Operon::Scalar> fitness) const -> void override;
 
     auto Prepare(Operon::Span<Operon::Individual const> pop) const -> void override;
 
@@ -418,7 +710,7 @@ private:
 
 // See core/concepts.hpp for why these are asserted here rather than constraining a template.
 // LengthEvaluator/ShapeEvaluator aren't asserted separately: they inherit
-// UserDefinedEvaluator's Evaluate override without overriding it themselves,
+// UserDefinedEvaluator's EvaluateInto override without overriding it themselves,
 // so UserDefinedEvaluator's assert below already covers them.
 static_assert(Concepts::EvaluatorCallable<UserDefinedEvaluator>);
 static_assert(Concepts::EvaluatorCallable<Evaluator<ScalarDispatch>>);
@@ -449,6 +741,50 @@ namespace detail {
         return std::max(static_cast<Operon::Scalar>(std::sqrt(ssr / n)),
                          std::numeric_limits<Operon::Scalar>::epsilon());
     }
+
+    // Jacobian storage for evaluators that need one per call (rows x
+    // coefficients, column-major). Requests of up to Cap values share a
+    // per-thread buffer that only grows, so the steady state of a run does
+    // no allocation; larger ones get a buffer of their own, freed with the
+    // scratch, so a huge range does not pin its Jacobian to the thread for
+    // the rest of the process. Values() is valid until the scratch is
+    // destroyed or another one is made on the same thread.
+    class JacobianScratch {
+    public:
+        static constexpr std::size_t Cap { 1UL << 22U }; // 16 MiB of floats
+
+        explicit JacobianScratch(std::size_t size)
+            : size_(size)
+        {
+            if (size > Cap) {
+                owned_.resize(size);
+                data_ = owned_.data();
+                return;
+            }
+            auto& shared = Shared();
+            if (shared.size() < size) { shared.resize(size); }
+            data_ = shared.data();
+        }
+
+        JacobianScratch(JacobianScratch const&) = delete;
+        JacobianScratch(JacobianScratch&&) = delete;
+        auto operator=(JacobianScratch const&) -> JacobianScratch& = delete;
+        auto operator=(JacobianScratch&&) -> JacobianScratch& = delete;
+        ~JacobianScratch() = default;
+
+        [[nodiscard]] auto Values() const -> Operon::Span<Operon::Scalar> { return { data_, size_ }; }
+
+    private:
+        static auto Shared() -> Operon::Vector<Operon::Scalar>&
+        {
+            thread_local Operon::Vector<Operon::Scalar> scratch;
+            return scratch;
+        }
+
+        Operon::Vector<Operon::Scalar> owned_;
+        Operon::Scalar* data_{nullptr};
+        std::size_t size_;
+    };
 } // namespace detail
 
 template <typename DTable, Concepts::Likelihood Lik>
@@ -465,16 +801,13 @@ public:
     auto Sigma() const { return std::span<Operon::Scalar const>{sigma_}; }
     auto SetSigma(std::vector<Operon::Scalar> sigma) const -> void { sigma_ = std::move(sigma); }
 
-    auto Evaluate(Operon::RandomGenerator& /*random*/, Individual const& ind, Operon::Span<Operon::Scalar> buf) const -> typename EvaluatorBase::ReturnType override {
+    auto EvaluateInto(Operon::RandomGenerator& /*random*/, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Span<Operon::Scalar> fitness) const -> void override {
+        ENSURE(fitness.size() == 1);
         ++Base::CallCount;
 
-        auto const* dtable = Base::GetDispatchTable();
         auto const* problem = Base::GetProblem();
-        auto const* dataset = problem->GetDataset();
 
-        // this call will optimize the tree coefficients and compute the SSE
         auto const& tree = ind.Genotype;
-        Operon::Interpreter<Operon::Scalar, DTable> interpreter{dtable, dataset, &ind.Genotype};
         auto parameters = tree.GetCoefficients();
 
         auto const p { static_cast<double>(parameters.size()) };
@@ -492,8 +825,12 @@ public:
         // mismatched size) sees a span sized to match.
         auto estimatedValues = buf.subspan(0, trainingRange.Size());
 
-        ++Base::ResidualEvaluations;
-        interpreter.Evaluate(parameters, trainingRange, estimatedValues);
+        // model output and jacobian from a single traced pass over the rows
+        // (the jacobian is needed for the Fisher matrix below anyway), or
+        // from the prediction share when inside a MultiEvaluator
+        detail::JacobianScratch const scratch{trainingRange.Size() * parameters.size()};
+        auto jacobian = scratch.Values();
+        Base::Predict(tree, trainingRange, estimatedValues, jacobian);
 
         auto targetValues = problem->TargetValues(trainingRange);
         Operon::Scalar profiledSigma{};
@@ -504,16 +841,23 @@ public:
             ? std::span<Operon::Scalar const>{&profiledSigma, 1}  // profiled
             : std::span<Operon::Scalar const>{sigma_};             // fixed scalar, per-sample, or empty (Poisson unweighted)
 
-        ++Base::JacobianEvaluations;
-        Eigen::Matrix<Operon::Scalar, -1, -1> jac = interpreter.JacRev(parameters, trainingRange); // jacobian
-        auto fisherMatrix = Lik::ComputeFisherMatrix(estimatedValues, {jac.data(), static_cast<std::size_t>(jac.size())}, effectiveSigma);
+        auto fisherMatrix = Lik::ComputeFisherMatrix(estimatedValues, jacobian, effectiveSigma);
         auto fisherDiag   = fisherMatrix.diagonal().array();
         ENSURE(fisherDiag.size() == p);
 
         auto cLikelihood = Lik::ComputeLikelihood(estimatedValues, targetValues, effectiveSigma);
         auto mdl = Operon::MinimumDescriptionLength(tree, parameters, fisherDiag, static_cast<double>(cLikelihood));
         if (!std::isfinite(mdl)) { mdl = EvaluatorBase::ErrMax; }
-        return typename EvaluatorBase::ReturnType { static_cast<Operon::Scalar>(mdl) };
+        fitness.front() = static_cast<Operon::Scalar>(mdl);
+    }
+
+    // the Fisher matrix needs the model Jacobian
+    auto UsesJacobian() const -> bool override { return true; }
+
+    // scored by the description length, not by the base class' error metric: the prefix
+    // bound of Evaluator::EvaluateBounded does not apply
+    auto EvaluateBounded(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Scalar /*threshold*/) const -> typename EvaluatorBase::ReturnType override {
+        return this->Evaluate(rng, ind, buf);
     }
 
 private:
@@ -534,27 +878,21 @@ public:
     auto Sigma() const { return std::span<Operon::Scalar const>{sigma_}; }
     auto SetSigma(std::vector<Operon::Scalar> sigma) const -> void { sigma_ = std::move(sigma); }
 
-    auto Evaluate(Operon::RandomGenerator& /*random*/, Individual const& ind, Operon::Span<Operon::Scalar> buf) const -> typename EvaluatorBase::ReturnType override {
+    auto EvaluateInto(Operon::RandomGenerator& /*random*/, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Span<Operon::Scalar> fitness) const -> void override {
+        ENSURE(fitness.size() == 1);
         ++Base::CallCount;
 
-        auto const* dtable  = Base::GetDispatchTable();
         auto const* problem = Base::GetProblem();
-        auto const* dataset = problem->GetDataset();
         auto const& tree    = ind.Genotype;
 
-        Operon::Interpreter<Operon::Scalar, DTable> interpreter{dtable, dataset, &tree};
-        auto parameters = tree.GetCoefficients();
-
         auto const trainingRange = problem->TrainingRange();
         auto const n { static_cast<double>(trainingRange.Size()) };
         ENSURE(buf.size() >= trainingRange.Size());
-        // See MinimumDescriptionLengthEvaluator's Evaluate() for why this
+        // See MinimumDescriptionLengthEvaluator::EvaluateInto for why this
         // slice is needed: everything downstream assumes exactly
         // trainingRange.Size() rows, but buf may legitimately be larger.
         auto estimatedValues = buf.subspan(0, trainingRange.Size());
-
-        ++Base::ResidualEvaluations;
-        interpreter.Evaluate(parameters, trainingRange, estimatedValues);
+        Base::Predict(tree, trainingRange, estimatedValues);
 
         auto targetValues = problem->TargetValues(trainingRange);
         double mlNLL{};
@@ -576,7 +914,13 @@ public:
 
         auto fbf = Operon::FractionalBayesFactor(tree, n, nll);
         if (!std::isfinite(fbf)) { fbf = EvaluatorBase::ErrMax; }
-        return typename EvaluatorBase::ReturnType { static_cast<Operon::Scalar>(fbf) };
+        fitness.front() = static_cast<Operon::Scalar>(fbf);
+    }
+
+    // scored by the fractional Bayes factor, not by the base class' error metric: the prefix
+    // bound of Evaluator::EvaluateBounded does not apply
+    auto EvaluateBounded(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Scalar /*threshold*/) const -> typename EvaluatorBase::ReturnType override {
+        return this->Evaluate(rng, ind, buf);
     }
 
 private:
@@ -594,7 +938,13 @@ public:
     }
 
     auto
-    Evaluate(Operon::RandomGenerator& /*random*/, Individual const& ind, Operon::Span<Operon::Scalar> buf) const -> typename EvaluatorBase::ReturnType override;
+    EvaluateInto(Operon::RandomGenerator& /*random*/, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Span<Operon::Scalar> fitness) const -> void override;
+
+    // scored by the BIC, not by the base class' error metric: the prefix
+    // bound of Evaluator::EvaluateBounded does not apply
+    auto EvaluateBounded(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Scalar /*threshold*/) const -> typename EvaluatorBase::ReturnType override {
+        return this->Evaluate(rng, ind, buf);
+    }
 };
 
 template <typename DTable>
@@ -608,7 +958,179 @@ public:
     }
 
     auto
-    Evaluate(Operon::RandomGenerator& /*random*/, Individual const& ind, Operon::Span<Operon::Scalar> buf) const -> typename EvaluatorBase::ReturnType override;
+    EvaluateInto(Operon::RandomGenerator& /*random*/, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Span<Operon::Scalar> fitness) const -> void override;
+
+    // scored by the AIC, not by the base class' error metric: the prefix
+    // bound of Evaluator::EvaluateBounded does not apply
+    auto EvaluateBounded(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Scalar /*threshold*/) const -> typename EvaluatorBase::ReturnType override {
+        return this->Evaluate(rng, ind, buf);
+    }
+};
+
+// K-fold cross-validated error over the training range, split into `folds`
+// contiguous folds. The model is interpreted once over the whole range and
+// its predictions are streamed into one set of weighted co-moments per fold.
+// Fold i is then scored out of sample: with linear scaling the least-squares
+// fit is taken from the pooled moments of the other folds, and the held-out
+// squared error under that fit follows in closed form from fold i's own
+// moments. The objectives are the mean of the per-fold errors and, unless
+// disabled, their sample standard deviation (a stability term for
+// multi-objective runs).
+//
+// Only the squared-error metrics (SSE, MSE, RMSE, NMSE) and R2 have such a
+// closed form; MAE and C2 throw, as does fewer than two folds or a training
+// range with fewer rows than folds. A non-finite prediction on any row
+// scores ErrMax.
+template <typename DTable>
+class OPERON_EXPORT CrossValidationEvaluator final : public Evaluator<DTable> {
+    using Base = Evaluator<DTable>;
+
+public:
+    explicit CrossValidationEvaluator(Operon::Problem const* problem, DTable const* dtable, std::size_t folds = 5, ErrorMetric error = MSE{}, bool linearScaling = true, bool reportDeviation = true)
+        : Base(problem, dtable, error, linearScaling)
+        , folds_(folds)
+        , reportDeviation_(reportDeviation)
+    {
+        if (error.Type() == ErrorType::MAE || error.Type() == ErrorType::C2) {
+            throw std::invalid_argument("cross-validation is only supported for sse, mse, nmse, rmse, and r2");
+        }
+        if (folds_ < 2) {
+            throw std::invalid_argument("cross-validation needs at least two folds");
+        }
+        if (problem->TrainingRange().Size() < folds_) {
+            throw std::invalid_argument("cross-validation needs at least one training row per fold");
+        }
+    }
+
+    auto Folds() const -> std::size_t { return folds_; }
+
+    // mean error, plus its deviation across folds when reported
+    auto ObjectiveCount() const -> std::size_t override { return reportDeviation_ ? 2UL : 1UL; }
+
+    auto
+    EvaluateInto(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Span<Operon::Scalar> fitness) const -> void override;
+
+    // scored out of sample, not by the base class' error metric: the prefix
+    // bound of Evaluator::EvaluateBounded does not apply
+    auto EvaluateBounded(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Scalar /*threshold*/) const -> typename EvaluatorBase::ReturnType override {
+        return this->Evaluate(rng, ind, buf);
+    }
+
+private:
+    std::size_t folds_;
+    bool reportDeviation_;
+};
+
+// Error metric on a row sample of the training range that is redrawn every
+// generation, for training ranges too large to interpret in full for every
+// candidate. The cost of an evaluation scales with the sample, not the
+// dataset: the sampled rows are copied into a compact dataset of their own
+// (same variable names, hence the same variable hashes) once per
+// generation, and every candidate is interpreted on that.
+//
+// The sample is stratified: the training range is cut into as many
+// contiguous strata as there are sampled rows and one row is drawn uniformly
+// from each, so the sample covers the whole range (ordered data, drifts)
+// with no clusters or gaps. Each sampled row carries the size of its stratum
+// times its dataset weight, if any, as its weight. That is the inverse of
+// its inclusion probability, so weighted sums over the sample (SSE) are
+// unbiased estimates of their full-range counterparts and the normalised
+// metrics are the matching ratio estimates.
+//
+// Prepare() redraws the sample for the next generation. Before that it grows
+// the sample by `growth` whenever the population has converged to the point
+// where sampling noise would decide selection: that is, while the relative
+// gap between the population's median and best fitness is below the
+// relative standard error sqrt(2 / rows) of a mean of squared Gaussian
+// residuals. The sample never shrinks and stops at the full training range.
+// Growth is thus driven by selection pressure rather than a fixed schedule.
+// The rule is calibrated for the squared-error metrics. Once the sample
+// spans the training range (or was asked to from the start) nothing is
+// copied any more and every call is delegated to Evaluator, prefix bound
+// included. Prepare() must not run concurrently with evaluations, which the
+// algorithms guarantee.
+//
+// Survivors are not re-scored when the sample is redrawn: parents and
+// elites keep the fitness they scored on the sample of their own
+// generation. Because they survived selection on that sample, it is biased
+// low (the draws that flattered them are the ones that were kept), and an
+// old score from a smaller sample is noisier still. Offspring therefore
+// compete against optimistic incumbents, which errs on the side of keeping
+// good models, and the bias disappears once the sample has grown to the
+// full range.
+//
+// Cached fitness is only valid for the sample it was scored on, so every
+// redraw starts a new Epoch() and the offspring generator drops the
+// transposition and semantic cache entries of the previous one.
+//
+// ResidualEvaluations counts full-range equivalents: the interpreted sample
+// rows are accumulated and converted into whole training-range passes, so
+// budgets and reports stay comparable with the full evaluator. The rows
+// skipped relative to a full pass go to SavedRowEvaluations. Local search
+// still fits coefficients on the full training range.
+template <typename DTable>
+class OPERON_EXPORT SubsampledEvaluator final : public Evaluator<DTable> {
+    using Base = Evaluator<DTable>;
+
+public:
+    static constexpr double DefaultGrowth { 2.0 };
+
+    explicit SubsampledEvaluator(Operon::Problem const* problem, DTable const* dtable, std::size_t rows, ErrorMetric error = MSE{}, bool linearScaling = true, double growth = DefaultGrowth, std::uint64_t seed = 0)
+        : Base(problem, dtable, error, linearScaling)
+        , growth_(growth)
+        , random_(seed)
+        , rows_(std::min(rows, problem->TrainingRange().Size()))
+    {
+        if (rows == 0) {
+            throw std::invalid_argument("the row sample must not be empty");
+        }
+        if (!(growth_ >= 1.0)) {
+            throw std::invalid_argument("the row sample growth factor must be at least 1");
+        }
+        Resample();
+    }
+
+    // rows in the current sample, and their indices into the dataset
+    // (sorted); no indices once the sample is the whole training range
+    auto SampleSize() const -> std::size_t { return rows_; }
+    auto SampleRows() const -> Operon::Span<std::size_t const> { return sample_; }
+
+    auto Prepare(Operon::Span<Individual const> pop) const -> void override;
+
+    // one per sample drawn
+    auto Epoch() const -> std::size_t override { return epoch_; }
+
+    auto
+    EvaluateInto(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Span<Operon::Scalar> fitness) const -> void override;
+
+    // the prefix bound of Evaluator::EvaluateBounded is over the full range,
+    // so it only applies once the sample is
+    auto EvaluateBounded(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Scalar threshold) const -> typename EvaluatorBase::ReturnType override {
+        return Full() ? Base::EvaluateBounded(rng, ind, buf, threshold) : this->Evaluate(rng, ind, buf);
+    }
+
+private:
+    auto Full() const -> bool { return rows_ >= Base::GetProblem()->TrainingRange().Size(); }
+
+    // Draws a new stratified sample of rows_ rows and refills the compact
+    // dataset, targets and weights (the dataset is only rebuilt when the
+    // sample has grown).
+    auto Resample() const -> void;
+
+    // The error metric of `ind` on the current sample, clamped to ErrMax
+    // when not finite.
+    auto ScoreSample(Individual const& ind, Operon::Span<Operon::Scalar> buf) const -> Operon::Scalar;
+
+    double growth_;
+    mutable Operon::RandomGenerator random_;
+    mutable std::size_t rows_;
+    mutable std::vector<std::size_t> sample_;
+    mutable std::optional<Dataset> subset_;
+    mutable std::vector<Operon::Scalar> target_;
+    mutable std::vector<Operon::Scalar> weights_;
+    mutable std::vector<Operon::Scalar> column_;
+    mutable std::size_t epoch_{0};
+    mutable std::atomic_size_t interpretedRows_{0};
 };
 
 template<typename DTable, Concepts::Likelihood Likelihood = GaussianLikelihood<Operon::Scalar>>
@@ -623,31 +1145,30 @@ class OPERON_EXPORT LikelihoodEvaluator final : public Evaluator<DTable> {
     }
 
     auto
-    Evaluate(Operon::RandomGenerator& /*rng*/, Individual const& ind, Operon::Span<Operon::Scalar> buf) const -> typename EvaluatorBase::ReturnType override {
+    EvaluateInto(Operon::RandomGenerator& /*rng*/, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Span<Operon::Scalar> fitness) const -> void override {
+        ENSURE(fitness.size() == 1);
         ++Base::CallCount;
 
-        auto const* dtable  = Base::Evaluator::GetDispatchTable();
         auto const* problem = Base::Evaluator::GetProblem();
-        auto const* dataset = problem->GetDataset();
-        auto const* tree    = &ind.Genotype;
-
-        // this call will optimize the tree coefficients and compute the SSE
-        Operon::Interpreter<Operon::Scalar, DTable> interpreter{dtable, dataset, tree};
-        auto parameters = tree->GetCoefficients();
 
         auto const trainingRange = problem->TrainingRange();
         ENSURE(buf.size() >= trainingRange.Size());
-        // See MinimumDescriptionLengthEvaluator's Evaluate() for why this
+        // See MinimumDescriptionLengthEvaluator::EvaluateInto for why this
         // slice is needed: everything downstream assumes exactly
         // trainingRange.Size() rows, but buf may legitimately be larger.
         auto estimatedValues = buf.subspan(0, trainingRange.Size());
-        ++Base::ResidualEvaluations;
-        interpreter.Evaluate(parameters, trainingRange, estimatedValues);
+        Base::Predict(ind.Genotype, trainingRange, estimatedValues);
 
         auto targetValues = problem->TargetValues(trainingRange);
 
         auto lik = Likelihood::ComputeLikelihood(estimatedValues, targetValues, sigma_);
-        return typename EvaluatorBase::ReturnType { static_cast<Operon::Scalar>(lik) };
+        fitness.front() = static_cast<Operon::Scalar>(lik);
+    }
+
+    // scored by the likelihood, not by the base class' error metric: the prefix
+    // bound of Evaluator::EvaluateBounded does not apply
+    auto EvaluateBounded(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Scalar /*threshold*/) const -> typename EvaluatorBase::ReturnType override {
+        return this->Evaluate(rng, ind, buf);
     }
 
     auto Sigma() const { return std::span<Operon::Scalar const>{sigma_}; }
@@ -674,6 +1195,8 @@ using PoissonLikelihoodEvaluator = LikelihoodEvaluator<DTable, PoissonLikelihood
 static_assert(Concepts::EvaluatorCallable<BayesianInformationCriterionEvaluator<ScalarDispatch>>);
 static_assert(Concepts::EvaluatorCallable<AkaikeInformationCriterionEvaluator<ScalarDispatch>>);
 static_assert(Concepts::EvaluatorCallable<LikelihoodEvaluator<ScalarDispatch>>);
+static_assert(Concepts::EvaluatorCallable<CrossValidationEvaluator<ScalarDispatch>>);
+static_assert(Concepts::EvaluatorCallable<SubsampledEvaluator<ScalarDispatch>>);
 
 } // namespace Operon
 #endif
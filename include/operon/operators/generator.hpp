@@ -5,16 +5,40 @@
 #ifndef OPERON_GENERATOR_HPP
 #define OPERON_GENERATOR_HPP
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
 #include "operon/core/operator.hpp"
+#include "operon/hash/semantic.hpp"
 #include "operon/hash/zobrist.hpp"
 #include "operon/operators/crossover.hpp"
 #include "operon/operators/evaluator.hpp"
 #include "operon/operators/mutation.hpp"
 #include "operon/operators/selector.hpp"
 #include "operon/operators/local_search.hpp"
+#include "operon/operators/surrogate.hpp"
 
 namespace Operon {
 
+// Racing (successive halving) of bred candidates, see
+// OffspringGeneratorBase::Race. Every round scores the surviving candidates
+// on the same randomly placed window of the training range, keeps the best
+// 1/HalvingRatio of them (never fewer than Finalists) and grows the window
+// by HalvingRatio for the next round. Only the finalists get local search
+// and a full-range evaluation. InitialRows == 0 disables racing.
+struct RacingConfig {
+    std::size_t InitialRows { 0 };
+    double HalvingRatio { 2.0 };
+    std::size_t Finalists { 1 };
+    std::size_t Candidates { 4 }; // per OffspringSelectionGenerator attempt; the brood generator races its whole brood
+};
+
 struct RecombinationResult {
     std::optional<Operon::Individual> Child;
     std::optional<Operon::Individual> Parent1;
@@ -47,6 +71,14 @@ public:
         FemaleSelector()->Prepare(pop);
         MaleSelector()->Prepare(pop);
         Evaluator()->Prepare(pop);
+        if (budget_ != nullptr) { budget_->Prepare(pop); }
+        // fitness cached against the evaluator's previous sample would be
+        // reused as if it had been scored on the current one
+        if (auto const epoch = Evaluator()->Epoch(); epoch != epoch_) {
+            epoch_ = epoch;
+            if (cache_ != nullptr) { cache_->Invalidate(); }
+            if (semantic_ != nullptr) { semantic_->Invalidate(); }
+        }
     }
 
     [[nodiscard]] virtual auto Terminate() const -> bool { return evaluator_->BudgetExhausted(); }
@@ -54,7 +86,50 @@ public:
     auto SetCache(Zobrist* cache) const { cache_ = cache; }
     [[nodiscard]] auto Cache() const -> Zobrist* { return cache_; }
 
-    auto Generate(Operon::RandomGenerator& random, double pCrossover, double pMutation, double pLocal, double pLamarck, Operon::Span<Operon::Scalar> buf, RecombinationResult& res) const -> void {
+    // Semantic fingerprint cache consulted by Score() after a transposition
+    // cache miss and before local search; null disables it.
+    auto SetFingerprintCache(SemanticCache* cache) const { semantic_ = cache; }
+    [[nodiscard]] auto FingerprintCache() const -> SemanticCache* { return semantic_; }
+
+    // Fitness surrogate consulted by Score() before local search: offspring
+    // it confidently predicts to miss RejectionThreshold() are rejected
+    // without being evaluated. Null (the default) disables it.
+    auto SetSurrogate(FitnessSurrogate const* surrogate) const { surrogate_ = surrogate; }
+    [[nodiscard]] auto Surrogate() const -> FitnessSurrogate const* { return surrogate_; }
+
+    // Per-individual local search budget, by parent rank; null (the
+    // default) fits every offspring with the optimizer's own budget.
+    auto SetLocalSearchBudget(LocalSearchBudget const* budget) const { budget_ = budget; }
+    [[nodiscard]] auto GetLocalSearchBudget() const -> LocalSearchBudget const* { return budget_; }
+
+    // Reseed each offspring's coefficients from the parent subtrees they
+    // came from before local search (see InheritCoefficients); off by default.
+    auto SetCoefficientInheritance(bool inherit) const { inherit_ = inherit; }
+    [[nodiscard]] auto CoefficientInheritance() const -> bool { return inherit_; }
+
+    auto SetRacing(RacingConfig const& config) -> void
+    {
+        if (config.InitialRows > 0 && (!(config.HalvingRatio > 1.0) || config.Finalists == 0)) {
+            throw std::invalid_argument("racing requires a halving ratio > 1 and at least one finalist");
+        }
+        racing_ = config;
+    }
+    [[nodiscard]] auto Racing() const -> RacingConfig const& { return racing_; }
+    [[nodiscard]] auto RacingEnabled() const -> bool { return racing_.InitialRows > 0; }
+
+    // Races the bred (unscored) candidates and Score()s the finalists; the
+    // returned indices name the scored candidates. Falls back to scoring
+    // every candidate when racing is disabled, the evaluator cannot score a
+    // sub-range (EvaluatorBase::EvaluateRange) or has several objectives.
+    // The race's row evaluations are charged to the evaluator's budget as
+    // full-range equivalents, and the rows it saved against scoring every
+    // candidate in full are added to its SavedRowEvaluations. Eliminated
+    // candidates count towards CallCount like any other scored attempt.
+    auto Race(Operon::RandomGenerator& random, double pLocal, double pLamarck, Operon::Span<Operon::Scalar> buf, Operon::Span<RecombinationResult> candidates) const -> std::vector<std::size_t>;
+
+    // Selects the parents (unless already set in `res`) and breeds
+    // res.Child's genotype, without scoring it.
+    auto Breed(Operon::RandomGenerator& random, double pCrossover, double pMutation, RecombinationResult& res) const -> void {
         auto pop = FemaleSelector()->Population();
         if (!res.Parent1) { res.Parent1 = pop[ (*FemaleSelector())(random) ]; }
         if (!res.Parent2) { res.Parent2 = pop[ (*MaleSelector())(random) ]; }
@@ -69,23 +144,34 @@ public:
         if (BernoulliTrial{pMutation}(random)) {
             res.Child->Genotype = (*Mutator())(random, std::move(res.Child->Genotype));
         }
+    }
 
-        auto evaluate = [&]() {
-            ScoreIndividual(random, *res.Child, *Evaluator(), coeffOptimizer_, pLocal, pLamarck, buf);
-        };
-
-        if (cache_ != nullptr) {
-            auto const hash = cache_->ComputeHash(res.Child->Genotype);
-            Operon::Vector<Operon::Scalar> cached(Evaluator()->ObjectiveCount());
-            if (cache_->TryGet(hash, cached)) {
-                res.Child->Fitness = cached;
-            } else {
-                evaluate();
-                cache_->Insert(hash, res.Child->Fitness);
-            }
-        } else {
-            evaluate();
+    // Scores the bred res.Child: transposition cache lookup, semantic
+    // fingerprint lookup, surrogate screening, then local search and the
+    // generator's rejection threshold.
+    auto Score(Operon::RandomGenerator& random, double pLocal, double pLamarck, Operon::Span<Operon::Scalar> buf, RecombinationResult& res) const -> void {
+        auto pending = Lookup(random, pLocal, pLamarck, res);
+        if (!pending) { return; }
+        std::optional<std::vector<Operon::Scalar>> original;
+        {
+            std::optional<LocalSearchBudget::Scope> budget;
+            if (pending->Iterations) { budget.emplace(*pending->Iterations); }
+            original = LocalSearch(random, *res.Child, *Evaluator(), coeffOptimizer_, pLocal, pLamarck);
         }
+        Finish(random, buf, res, *pending, original);
+    }
+
+    // Score() over a block of bred candidates, rngs[i] belonging to
+    // results[i]: every candidate makes the same random draws as in Score(),
+    // but the local search of those that get past the lookups runs through
+    // one LocalSearchBatch call per iteration budget, so a batched optimizer
+    // (OptimizerBase::Batched) fits them together. All lookups come first,
+    // so candidates of one block never find each other in the caches.
+    auto ScoreBatch(Operon::Span<Operon::RandomGenerator> rngs, double pLocal, double pLamarck, Operon::Span<Operon::Scalar> buf, Operon::Span<RecombinationResult> results) const -> void;
+
+    auto Generate(Operon::RandomGenerator& random, double pCrossover, double pMutation, double pLocal, double pLamarck, Operon::Span<Operon::Scalar> buf, RecombinationResult& res) const -> void {
+        Breed(random, pCrossover, pMutation, res);
+        Score(random, pLocal, pLamarck, buf, res);
     }
 
     auto Generate(Operon::RandomGenerator& random, double pCrossover, double pMutation, double pLocal, double pLamarck, Operon::Span<Operon::Scalar> buf) const -> RecombinationResult {
@@ -94,7 +180,167 @@ public:
         return res;
     }
 
+    // Fills offspring[i] with an offspring bred and scored with rngs[i] and
+    // returns, per slot, whether it was filled: like operator(), a generator
+    // may come back empty-handed, and the caller then retries the slot. The
+    // default calls operator() once per slot; generators that can score a
+    // block at once (BasicOffspringGenerator, see ScoreBatch) override it.
+    virtual auto GenerateBatch(Operon::Span<Operon::RandomGenerator> rngs, double pCrossover, double pMutation, double pLocal, double pLamarck, Operon::Span<Operon::Scalar> buf, Operon::Span<Individual> offspring) const -> std::vector<std::uint8_t>;
+
+protected:
+    // Fitness above which the offspring in `res` is discarded anyway, handed
+    // to EvaluatorBase::EvaluateBounded so evaluators with early abort
+    // enabled can stop scoring it as soon as that is certain. Generators that
+    // keep every offspring regardless of its fitness return ErrMax (no
+    // threshold).
+    [[nodiscard]] virtual auto RejectionThreshold(RecombinationResult const& /*res*/) const -> Operon::Scalar { return EvaluatorBase::ErrMax; }
+
 private:
+    // What Score() carries from the lookups past local search.
+    struct Pending {
+        std::optional<Operon::Hash> Hash;
+        std::optional<Operon::Hash> Fingerprint;
+        std::optional<FitnessSurrogate::Features> Features;
+        FitnessSurrogate::Decision Decision{FitnessSurrogate::Decision::Evaluate};
+        Operon::Scalar Threshold{EvaluatorBase::ErrMax};
+        std::optional<std::size_t> Iterations; // the local search budget, if any
+    };
+
+    // The stages of Score() before local search: coefficient inheritance,
+    // the cache lookups and surrogate screening. Returns nothing when they
+    // settled res.Child's fitness.
+    auto Lookup(Operon::RandomGenerator& random, double pLocal, double pLamarck, RecombinationResult& res) const -> std::optional<Pending> {
+        auto& child = *res.Child;
+
+        // before hashing: the inherited coefficients are the child's genotype
+        if (inherit_ && coeffOptimizer_ != nullptr && pLocal > 0 && res.Parent1) {
+            InheritCoefficients(child.Genotype, res.Parent1->Genotype, (res.Parent2 ? *res.Parent2 : *res.Parent1).Genotype);
+        }
+
+        Pending pending;
+        if (cache_ != nullptr) {
+            pending.Hash = cache_->ComputeHash(child.Genotype);
+            if (ReuseTransposition(random, pLamarck, *pending.Hash, child)) { return std::nullopt; }
+        }
+
+        if (semantic_ != nullptr) {
+            pending.Fingerprint = semantic_->Fingerprint(child.Genotype);
+            if (pending.Fingerprint && ReuseFingerprint(random, pLamarck, *pending.Fingerprint, pending.Hash, child)) {
+                return std::nullopt;
+            }
+        }
+
+        pending.Threshold = RejectionThreshold(res);
+
+        // a surrogate rejection counts as an attempt, like a candidate
+        // eliminated by Race, and is not cached either
+        pending.Features = surrogate_ != nullptr ? DescribeForSurrogate(res) : std::nullopt;
+        if (pending.Features && pending.Threshold < EvaluatorBase::ErrMax) {
+            pending.Decision = surrogate_->Screen(random, *pending.Features, pending.Threshold);
+            if (pending.Decision == FitnessSurrogate::Decision::Reject) {
+                std::ranges::fill(child.Fitness, EvaluatorBase::ErrMax);
+                ++Evaluator()->CallCount;
+                Evaluator()->SavedRowEvaluations += Evaluator()->GetProblem()->TrainingRange().Size();
+                return std::nullopt;
+            }
+        }
+
+        if (budget_ != nullptr && res.Parent1 && res.Parent1->Size() > 0) {
+            auto parent = (*res.Parent1)[0];
+            if (res.Parent2 && res.Parent2->Size() > 0) { parent = std::min(parent, (*res.Parent2)[0]); }
+            pending.Iterations = budget_->Iterations(parent);
+        }
+        return pending;
+    }
+
+    // The stages of Score() after local search, which left `original` (see
+    // LocalSearch): evaluation under the rejection threshold, surrogate
+    // feedback and the cache inserts.
+    auto Finish(Operon::RandomGenerator& random, Operon::Span<Operon::Scalar> buf, RecombinationResult& res, Pending const& pending, std::optional<std::vector<Operon::Scalar>> const& original) const -> void {
+        auto& child = *res.Child;
+
+        // the coefficients the fitness belongs to, for a cache that keeps them
+        std::vector<Operon::Scalar> scored;
+        auto* const keep = (pending.Hash && cache_->StoresCoefficients()) || pending.Fingerprint ? &scored : nullptr;
+        ScoreOptimized(random, child, *Evaluator(), original, buf, pending.Threshold, keep);
+
+        if (pending.Features) {
+            if (pending.Decision == FitnessSurrogate::Decision::Audit) { surrogate_->Audit(child.Fitness.front() <= pending.Threshold); }
+            surrogate_->Observe(*pending.Features, child.Fitness.front());
+        }
+
+        // an early-aborted ErrMax is relative to this threshold, not the
+        // genotype's fitness, so it must not be cached
+        auto const rejected = pending.Threshold < EvaluatorBase::ErrMax && child.Fitness.front() == EvaluatorBase::ErrMax;
+        if (rejected) { return; }
+        if (pending.Hash) { cache_->Insert(*pending.Hash, child.Fitness, scored); }
+        if (pending.Fingerprint) {
+            // the entry is keyed by the tree as bred but holds the model that
+            // was scored, which a Baldwinian search has taken back off it
+            if (original) { child.Genotype.SetCoefficients(scored); }
+            semantic_->Insert(*pending.Fingerprint, child.Genotype, child.Fitness);
+            if (original) { child.Genotype.SetCoefficients(*original); }
+        }
+    }
+
+    // Surrogate features of res.Child; only single-objective offspring with
+    // known parents are described.
+    [[nodiscard]] auto DescribeForSurrogate(RecombinationResult const& res) const -> std::optional<FitnessSurrogate::Features> {
+        if (Evaluator()->ObjectiveCount() != 1 || !res.Parent1 || res.Parent1->Size() != 1) { return std::nullopt; }
+        auto const& p1 = *res.Parent1;
+        auto const& p2 = res.Parent2 ? *res.Parent2 : p1;
+        if (p2.Size() != 1) { return std::nullopt; }
+        auto const parentLength = 0.5 * static_cast<double>(p1.Genotype.Length() + p2.Genotype.Length());
+        return FitnessSurrogate::Describe(res.Child->Genotype, p1[0], p2[0], parentLength);
+    }
+
+    // Transposition cache hit: `ind` takes the stored fitness instead of
+    // being optimized and evaluated. If the cache keeps coefficients, the
+    // Lamarckian draw also writes back the ones that fitness was computed
+    // with; the hash fixes the coefficient layout, so they always fit.
+    auto ReuseTransposition(Operon::RandomGenerator& random, double pLamarck, Operon::Hash hash, Individual& ind) const -> bool {
+        if (!cache_->StoresCoefficients()) { return cache_->TryGet(hash, ind.Fitness); }
+
+        std::vector<Operon::Scalar> coefficients;
+        if (!cache_->TryGet(hash, ind.Fitness, coefficients)) { return false; }
+        if (!coefficients.empty() && std::cmp_equal(coefficients.size(), ind.Genotype.CoefficientsCount()) && std::bernoulli_distribution{pLamarck}(random)) {
+            ind.Genotype.SetCoefficients(coefficients);
+        }
+        return true;
+    }
+
+    // Semantic cache hit: `ind` takes the stored fitness instead of being
+    // optimized and evaluated. The fitness belongs to the stored
+    // coefficients, not to the tree's own, so it is only reused when those
+    // fit the tree's coefficient layout and reproduce the stored model on
+    // the probe rows; otherwise the tree keeps its coefficients, returns
+    // false and is scored like any other offspring. As on a transposition
+    // hit, the Lamarckian draw decides whether the tree keeps the stored
+    // coefficients. A reused fitness is also cached under the tree's Zobrist
+    // `hash`, with the coefficients it belongs to.
+    auto ReuseFingerprint(Operon::RandomGenerator& random, double pLamarck, Operon::Hash fingerprint, std::optional<Operon::Hash> hash, Individual& ind) const -> bool {
+        SemanticEntry entry;
+        if (!semantic_->TryGet(fingerprint, entry) || entry.Value.size() != Evaluator()->ObjectiveCount()) {
+            return false;
+        }
+
+        auto& tree = ind.Genotype;
+        if (!std::cmp_equal(entry.Coefficients.size(), tree.CoefficientsCount())) {
+            return false;
+        }
+        auto original = tree.GetCoefficients();
+        tree.SetCoefficients(entry.Coefficients);
+        if (semantic_->Fingerprint(tree) != entry.OptimizedFingerprint) {
+            tree.SetCoefficients(original);
+            return false;
+        }
+        semantic_->RecordHit();
+        ind.Fitness = entry.Value;
+        if (hash) { cache_->Insert(*hash, ind.Fitness, entry.Coefficients); }
+        if (!std::bernoulli_distribution{pLamarck}(random)) { tree.SetCoefficients(original); }
+        return true;
+    }
+
     gsl::not_null<EvaluatorBase const*> evaluator_;
     gsl::not_null<CrossoverBase const*> crossover_;
     gsl::not_null<MutatorBase const*>   mutator_;
@@ -102,6 +348,12 @@ private:
     gsl::not_null<SelectorBase const*>  maleSelector_;
     CoefficientOptimizer const*         coeffOptimizer_;
     mutable Zobrist*                    cache_{nullptr};
+    mutable SemanticCache*              semantic_{nullptr};
+    mutable std::size_t                 epoch_{0};
+    mutable FitnessSurrogate const*     surrogate_{nullptr};
+    mutable LocalSearchBudget const*    budget_{nullptr};
+    mutable bool                        inherit_{false};
+    RacingConfig                        racing_;
 };
 
 class OPERON_EXPORT BasicOffspringGenerator final : public OffspringGeneratorBase {
@@ -112,6 +364,10 @@ public:
     }
 
     auto operator()(Operon::RandomGenerator& random, double pCrossover, double pMutation, double pLocal, double pLamarck, Operon::Span<Operon::Scalar> buf) const -> std::optional<Individual> final;
+
+    // breeds the whole block, then scores it with ScoreBatch; never leaves
+    // a slot empty
+    auto GenerateBatch(Operon::Span<Operon::RandomGenerator> rngs, double pCrossover, double pMutation, double pLocal, double pLamarck, Operon::Span<Operon::Scalar> buf, Operon::Span<Individual> offspring) const -> std::vector<std::uint8_t> final;
 };
 
 class OPERON_EXPORT BroodOffspringGenerator : public OffspringGeneratorBase {
@@ -198,7 +454,17 @@ public:
     static constexpr size_t DefaultMaxSelectionPressure { 100 };
     static constexpr double DefaultComparisonFactor { 1.0 };
 
+protected:
+    // The single-objective acceptance target of operator(): offspring worse
+    // than it are rejected, so the evaluator need not score them in full.
+    [[nodiscard]] auto RejectionThreshold(RecombinationResult const& res) const -> Operon::Scalar override;
+
 private:
+    // The fitness a child of parents with fitness f1 and f2 must reach on
+    // one objective: the worse parent, moved toward the better one by the
+    // comparison factor.
+    [[nodiscard]] auto AcceptanceTarget(Operon::Scalar f1, Operon::Scalar f2) const -> Operon::Scalar;
+
     mutable size_t lastEvaluations_{0};
     size_t maxSelectionPressure_{DefaultMaxSelectionPressure};
     double comparisonFactor_{0};
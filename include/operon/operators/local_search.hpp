@@ -5,9 +5,15 @@
 #ifndef OPERON_LOCAL_SEARCH_HPP
 #define OPERON_LOCAL_SEARCH_HPP
 
+#include <atomic>
+#include <cstddef>
 #include <gsl/pointers>
+#include <optional>
 #include <tl/expected.hpp>
+#include <vector>
+#include "operon/core/individual.hpp"
 #include "operon/core/operator.hpp"
+#include "operon/core/types.hpp"
 #include "operon/operon_export.hpp"
 
 
@@ -27,10 +33,108 @@ public:
 
     auto operator()(Operon::RandomGenerator& rng, Operon::Tree tree) const -> std::tuple<Operon::Tree, tl::expected<FitResult, FitFailure>> override;
 
+    // Optimizes all `trees` with one OptimizerBase::OptimizeBatch call and
+    // writes improved coefficients back in place; rngs[i] belongs to trees[i].
+    auto OptimizeBatch(Operon::Span<Operon::RandomGenerator> rngs, Operon::Span<Operon::Tree> trees) const -> std::vector<tl::expected<FitResult, FitFailure>>;
+
+    // see OptimizerBase::Batched
+    [[nodiscard]] auto Batched() const -> bool;
+
 private:
     gsl::not_null<Operon::OptimizerBase const*> optimizer_;
 };
 
+// Per-individual local search budget. A single iteration budget for every
+// fit either wastes evaluations on the many fits that converge in a couple
+// of iterations or under-fits the few that need many more; offspring of the
+// best parents are also the ones most likely to survive, so their fits are
+// worth finishing. Each generation, Prepare() ranks the population on its
+// first objective, and an offspring whose better parent sits at quantile q
+// (0 = best) gets
+//
+//   max(1, round(I * (MaxScale - (MaxScale - MinScale) * q)))
+//
+// iterations, I being the optimizer's configured budget. The scales only
+// average to 1 if q is uniform, and it is not: selection favours good
+// parents and the better of the two is taken, so q crowds towards 0 and the
+// raw scales would spend well above the static setting. Each scale is
+// therefore divided by the mean raw scale of the offspring budgeted so far
+// in the same generation, itself included, with the previous generation's
+// mean (Prepare() takes it over; 1 at first) counting as one more draw. The
+// running mean settles after a few offspring, so the total stays near the
+// static setting from the first generation on while the ordering is kept.
+// Allotted() and Baseline() count both for comparison.
+//
+// The budget reaches the optimizer through a Scope, which overrides
+// OptimizerBase::Iterations() on the calling thread (the optimizer itself
+// is shared between threads). OffspringGeneratorBase::Score opens one
+// around local search when a budget is set (SetLocalSearchBudget).
+struct LocalSearchBudgetConfig {
+    double MinScale{0.25}; // NOLINT
+    double MaxScale{1.75}; // NOLINT
+};
+
+class OPERON_EXPORT LocalSearchBudget {
+public:
+    explicit LocalSearchBudget(gsl::not_null<OptimizerBase const*> optimizer, LocalSearchBudgetConfig config = {});
+
+    class OPERON_EXPORT Scope {
+    public:
+        explicit Scope(std::size_t iterations);
+        ~Scope();
+
+        Scope(Scope const&) = delete;
+        Scope(Scope&&) = delete;
+        auto operator=(Scope const&) -> Scope& = delete;
+        auto operator=(Scope&&) -> Scope& = delete;
+
+    private:
+        std::optional<std::size_t> previous_;
+    };
+
+    // Ranks `population` on its first objective and takes over the mean raw
+    // scale of the offspring budgeted since the last call; not thread-safe,
+    // called once per generation before offspring are scored.
+    auto Prepare(Operon::Span<Individual const> population) const -> void;
+
+    // The budget of an offspring whose better parent has `parentFitness`
+    // (first objective); the configured budget before the first Prepare.
+    [[nodiscard]] auto Iterations(Operon::Scalar parentFitness) const -> std::size_t;
+
+    [[nodiscard]] auto Allotted() const -> std::size_t { return allotted_.load(std::memory_order_relaxed); }
+    [[nodiscard]] auto Baseline() const -> std::size_t { return baseline_.load(std::memory_order_relaxed); }
+    [[nodiscard]] auto Config() const -> LocalSearchBudgetConfig const& { return config_; }
+
+private:
+    gsl::not_null<OptimizerBase const*> optimizer_;
+    LocalSearchBudgetConfig config_;
+    mutable Operon::Vector<Operon::Scalar> ranked_;
+    mutable double prior_{1}; // mean raw scale of the previous generation
+    mutable std::atomic<double> scaleSum_{0};
+    mutable std::atomic<std::size_t> draws_{0};
+    mutable std::atomic<std::size_t> allotted_{0};
+    mutable std::atomic<std::size_t> baseline_{0};
+};
+
+// Coefficient inheritance for offspring. Local search starts from whatever
+// coefficients crossover and mutation left in the child, but a subtree that
+// moved over from a parent was already fitted there (under Lamarckian
+// write-back, the parents' genotypes carry their fitted coefficients) and is
+// a better starting point than its perturbed copy. InheritCoefficients
+// matches the child's subtrees top-down against the parents' by layout (the
+// same node types and arities in the same order), and copies the parent
+// subtree's coefficients into each maximal match. It returns the number of
+// coefficients inherited. Subtrees the operators created or changed find no
+// match and keep theirs; least-squares optimizers with a linear warm start
+// (OptimizerBase::SetLinearWarmStart, see LinearWarmStartSupported) then
+// give the linearly entering ones their least-squares values.
+//
+// A child laid out exactly like one of its parents (a coefficient-only
+// mutation) is left alone, as is any single leaf: neither identifies where
+// its coefficients came from. Trees with shared subexpressions (Ref nodes)
+// are skipped.
+OPERON_EXPORT auto InheritCoefficients(Tree& child, Tree const& parent1, Tree const& parent2) -> std::size_t;
+
 } // namespace Operon
 
 #endif
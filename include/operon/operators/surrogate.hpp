@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright 2019-2025 Heal Research
+// SPDX-FileCopyrightText: Copyright 2025-present Bogdan Burlacu and contributors
+
+#ifndef OPERON_OPERATORS_SURROGATE_HPP
+#define OPERON_OPERATORS_SURROGATE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+
+#include "operon/core/tree.hpp"
+#include "operon/core/types.hpp"
+#include "operon/operon_export.hpp"
+
+namespace Operon {
+
+// Settings of FitnessSurrogate. Warmup == 0 disables screening altogether
+// (the surrogate still learns, it just never rejects anything).
+struct SurrogateConfig {
+    std::size_t Warmup { 0 };          // observations before the first rejection
+    double AuditRate { 0.1 };          // fraction of would-be rejections evaluated anyway
+    double TargetMissRate { 0.05 };    // tolerated fraction of audited rejections that would have been accepted
+    double Forgetting { 0.995 };       // per-observation decay of old evidence, in (0, 1]
+    double InitialMargin { 2.0 };      // starting margin, in residual standard deviations
+};
+
+// Cheap predictor of an offspring's fitness (after local search) from its
+// parents' fitness and a handful of structural features, used by
+// OffspringGeneratorBase::Score to skip the full evaluation of offspring that
+// would be rejected anyway.
+//
+// The features are: a bias, the better and the worse parent fitness, the
+// child's length relative to its parents' mean length, the log of its depth,
+// and a coarse operator histogram (the share of function nodes whose
+// HashValue falls into each of OperatorBuckets buckets). The model is a
+// linear regression on them fitted by recursive least squares with
+// exponential forgetting, so it follows the population as it drifts and an
+// observation costs O(FeatureCount^2) with no stored history.
+//
+// Screening compares a conservative prediction, the point prediction minus
+// Margin() residual standard deviations, against the generator's rejection
+// threshold: a candidate is only rejected when even that is above the
+// threshold. The residual deviation is an exponentially weighted average of
+// the a-priori prediction errors. The margin itself is tuned online: a
+// fraction AuditRate of would-be rejections is evaluated anyway, and every
+// audited candidate that turns out to be acceptable (a miss) widens the
+// margin while every correct rejection narrows it slightly, which is a
+// stochastic approximation that settles where the miss rate equals
+// TargetMissRate.
+//
+// Fitness is assumed to be minimized. Observations or predictions involving
+// a non-finite or ErrMax fitness are ignored. All members are thread-safe;
+// the state is small and guarded by one mutex, which is negligible next to
+// the evaluation it stands in for.
+//
+// Ownership mirrors the fitness caches: the caller constructs one per run and
+// hands a raw pointer to OffspringGeneratorBase::SetSurrogate.
+class OPERON_EXPORT FitnessSurrogate {
+public:
+    static constexpr std::size_t OperatorBuckets { 4 };
+    static constexpr std::size_t FeatureCount { 5 + OperatorBuckets };
+    using Features = std::array<double, FeatureCount>;
+
+    enum class Decision : std::uint8_t {
+        Evaluate, // predicted competitive, or the surrogate is not warm yet
+        Audit,    // predicted to be rejected, but evaluate it to check the margin
+        Reject    // predicted to be rejected; skip the evaluation
+    };
+
+    explicit FitnessSurrogate(SurrogateConfig const& config = {});
+
+    // Features of `child` bred from parents with the given (single-objective)
+    // fitness values and mean length; nullopt if a parent fitness is unusable.
+    [[nodiscard]] static auto Describe(Tree const& child, Scalar parent1, Scalar parent2, double parentLength) -> std::optional<Features>;
+
+    // Point prediction of the fitness; nullopt until Warmup observations.
+    [[nodiscard]] auto Predict(Features const& features) const -> std::optional<double>;
+
+    // Screening decision for a candidate to be compared against `threshold`.
+    [[nodiscard]] auto Screen(RandomGenerator& random, Features const& features, Scalar threshold) const -> Decision;
+
+    // Fitness of a fully evaluated candidate.
+    auto Observe(Features const& features, Scalar fitness) const -> void;
+
+    // Outcome of an audited candidate: whether it would have been accepted.
+    auto Audit(bool accepted) const -> void;
+
+    [[nodiscard]] auto Config() const -> SurrogateConfig const& { return config_; }
+    [[nodiscard]] auto Margin() const -> double;
+    [[nodiscard]] auto ResidualDeviation() const -> double;
+    [[nodiscard]] auto Observations() const -> std::size_t;
+    [[nodiscard]] auto Rejected() const -> std::size_t;
+    [[nodiscard]] auto Audited() const -> std::size_t;
+    [[nodiscard]] auto Missed() const -> std::size_t;
+
+private:
+    [[nodiscard]] auto PredictUnlocked(Features const& features) const -> double;
+
+    SurrogateConfig config_;
+
+    mutable std::mutex mutex_;
+    mutable std::array<double, FeatureCount> weights_{};
+    mutable std::array<double, FeatureCount * FeatureCount> covariance_{}; // row-major inverse information matrix
+    mutable double residualVariance_{0};
+    mutable double margin_{0};
+    mutable std::size_t observations_{0};
+    mutable std::size_t rejected_{0};
+    mutable std::size_t audited_{0};
+    mutable std::size_t missed_{0};
+};
+
+} // namespace Operon
+
+#endif
@@ -57,6 +57,7 @@ struct JitLMCostFunction : public LMCostFunctionBase<JitLMCostFunction<T, Storag
         , nRowsPad_(static_cast<std::size_t>((static_cast<int>(range.Size()) + 7) & ~7))
         , scratchResiduals_(nRowsPad_)
         , scratchJac_(nRowsPad_ * this->numParameters_)
+        , jacOuts_(this->numParameters_)
         , nVars_(nVars)
         , nConsts_(nConsts)
     {
@@ -77,11 +78,12 @@ struct JitLMCostFunction : public LMCostFunctionBase<JitLMCostFunction<T, Storag
                 ENSURE(nVars_   < 0 || static_cast<int>(jacColPtrs_.size()) == nVars_);
                 ENSURE(nConsts_ < 0 || static_cast<int>(this->numParameters_) == nConsts_);
                 // Write into padded per-column scratch, then copy valid rows to jacobian.
-                std::vector<float*> outs(this->numParameters_);
+                // The column pointers are refreshed per call (a copy of this
+                // object owns different scratch) but their array is not reallocated.
                 for (std::size_t k = 0; k < this->numParameters_; ++k) {
-                    outs[k] = scratchJac_.data() + k * nRowsPad_;
+                    jacOuts_[k] = scratchJac_.data() + k * nRowsPad_;
                 }
-                jacFn_(outs.data(), jacColPtrs_.data(), nRowsPad, parameters);
+                jacFn_(jacOuts_.data(), jacColPtrs_.data(), nRowsPad, parameters);
                 for (std::size_t k = 0; k < this->numParameters_; ++k) {
                     std::copy_n(scratchJac_.data() + k * nRowsPad_, this->numResiduals_,
                                 jacobian + k * static_cast<std::ptrdiff_t>(this->numResiduals_));
@@ -125,6 +127,7 @@ private:
     std::size_t                              nRowsPad_;
     mutable std::vector<Scalar>              scratchResiduals_;
     mutable std::vector<Scalar>              scratchJac_;
+    mutable std::vector<float*>              jacOuts_;   // per-column pointers into scratchJac_
 
     int                                      nVars_   = -1;
     int                                      nConsts_ = -1;
@@ -128,6 +128,7 @@ struct GaussianLoss : public LikelihoodBase<T> {
         , np_{static_cast<std::size_t>(interpreter->GetTree()->CoefficientsCount())}
         , nr_{range_.Size()}
         , jac_{bs_, np_}
+        , primal_(static_cast<Eigen::Index>(bs_))
     {
         EXPECT(range_.Start() + range_.Size() <= static_cast<std::size_t>(target_.size()));
         EXPECT(weights_.empty() || range_.Start() + range_.Size() <= weights_.size());
@@ -152,10 +153,10 @@ struct GaussianLoss : public LikelihoodBase<T> {
         auto const& interpreter = this->GetInterpreter();
         Operon::Span<Operon::Scalar const> c{x.data(), static_cast<std::size_t>(x.size())};
         auto const batch = SelectBatch();
-        auto primal = interpreter->Evaluate(c, batch);
+        auto primal = primal_.head(static_cast<Eigen::Index>(batch.Size()));
+        interpreter->Evaluate(c, batch, {primal.data(), batch.Size()});
         auto target = target_.segment(batch.Start(), batch.Size());
-        Eigen::Map<Eigen::Array<Scalar, -1, 1> const> primalMap{primal.data(), std::ssize(primal)};
-        auto e = primalMap - target;
+        auto e = primal - target;
 
         if (weights_.empty()) {
             if (grad.size() != 0) {
@@ -215,6 +216,7 @@ private:
     std::size_t np_; // number of parameters to optimize
     std::size_t nr_; // number of data points (rows)
     mutable Eigen::Array<Scalar, -1, -1> jac_;
+    mutable Eigen::Array<Scalar, -1, 1> primal_; // model output, reused by every call
     mutable std::size_t feval_{};
     mutable std::size_t jeval_{};
 };
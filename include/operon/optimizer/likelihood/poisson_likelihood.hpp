@@ -126,6 +126,7 @@ struct PoissonLoss : public LikelihoodBase<T> {
         , numParameters_{static_cast<std::size_t>(interpreter->GetTree()->CoefficientsCount())}
         , numResiduals_{range_.Size()}
         , jac_{batchSize_, numParameters_}
+        , primal_(static_cast<Eigen::Index>(batchSize_))
     {
         EXPECT(range_.Start() + range_.Size() <= target_.size());
     }
@@ -144,9 +145,9 @@ struct PoissonLoss : public LikelihoodBase<T> {
         auto const* interpreter = this->GetInterpreter();
         Operon::Span<Operon::Scalar const> c{x.data(), static_cast<std::size_t>(x.size())};
         auto const r = SelectBatch();
-        auto p = interpreter->Evaluate(c, r);
+        auto pmap = primal_.head(static_cast<Eigen::Index>(r.Size()));
+        interpreter->Evaluate(c, r, {pmap.data(), r.Size()});
         auto t = target_.subspan(r.Start(), r.Size());
-        auto pmap = Eigen::Map<Eigen::Array<Operon::Scalar, -1, 1> const>(p.data(), std::ssize(p));
 
         auto tmap = Eigen::Map<Eigen::Array<Operon::Scalar, -1, 1> const>(t.data(), std::ssize(t));
         if (g.size() != 0) {
@@ -195,6 +196,7 @@ private:
     std::size_t numParameters_; // number of parameters to optimize
     std::size_t numResiduals_; // number of data points (rows)
     mutable Eigen::Array<Scalar, -1, -1> jac_;
+    mutable Eigen::Array<Scalar, -1, 1> primal_; // model output, reused by every call
     mutable std::size_t feval_{};
     mutable std::size_t jeval_{};
 };
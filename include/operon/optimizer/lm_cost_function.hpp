@@ -5,12 +5,36 @@
 #ifndef OPERON_LM_COST_FUNCTION_HPP
 #define OPERON_LM_COST_FUNCTION_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <gsl/pointers>
+#include <taskflow/core/executor.hpp>
+#include <taskflow/core/taskflow.hpp>
+#include <vector>
 #include "operon/interpreter/interpreter.hpp"
 #include "operon/optimizer/lm_cost_function_base.hpp"
 
 namespace Operon {
 
+// Row-parallel evaluation of one fit. On a huge training range a single
+// residual/Jacobian evaluation is worth splitting across workers that would
+// otherwise sit idle, typically at the end of a generation when a few
+// straggling fits are all that is left. The range is cut into contiguous
+// row blocks, each evaluated by its own interpreter (interpreters are not
+// thread-safe) as a task on `Executor`, writing straight into its rows of
+// the residual vector and Jacobian. The number of blocks is decided per
+// evaluation: one per idle worker (workers minus `Busy`, the fits in flight
+// on the executor, this one included, plus this fit's own worker), capped by
+// the interpreters available and by MinBlockRows rows per block, so a busy
+// executor costs nothing over the serial path.
+template<typename T = Operon::Scalar>
+struct LMRowBlocks {
+    tf::Executor* Executor{nullptr};
+    std::vector<InterpreterBase<T> const*> Interpreters;
+    std::atomic<std::size_t> const* Busy{nullptr};
+    std::size_t MinBlockRows{1};
+};
+
 template<typename T = Operon::Scalar, int StorageOrder = Eigen::ColMajor>
 struct LMCostFunction : public LMCostFunctionBase<LMCostFunction<T, StorageOrder>, StorageOrder> {
     using Base = LMCostFunctionBase<LMCostFunction<T, StorageOrder>, StorageOrder>;
@@ -35,23 +59,51 @@ struct LMCostFunction : public LMCostFunctionBase<LMCostFunction<T, StorageOrder
         ValidateLMWeights(weights_, this->numResiduals_);
     }
 
+    // the row-block tasks hold a pointer to the cost function
+    LMCostFunction(LMCostFunction const&) = delete;
+    LMCostFunction(LMCostFunction&&) = delete;
+    auto operator=(LMCostFunction const&) -> LMCostFunction& = delete;
+    auto operator=(LMCostFunction&&) -> LMCostFunction& = delete;
+    ~LMCostFunction() = default;
+
+    auto SetRowBlocks(LMRowBlocks<T> blocks) -> void
+    {
+        rowBlocks_ = std::move(blocks);
+        scratch_.resize(rowBlocks_.Interpreters.size());
+        taskflow_.clear();
+        taskflowBlocks_ = 0;
+    }
+
+    // The number of row blocks the next evaluation is split into (1 = serial).
+    [[nodiscard]] auto RowBlockCount() const -> std::size_t
+    {
+        if (rowBlocks_.Executor == nullptr || rowBlocks_.Interpreters.size() < 2) { return 1; }
+        auto const workers = rowBlocks_.Executor->num_workers();
+        auto const busy = rowBlocks_.Busy != nullptr ? rowBlocks_.Busy->load(std::memory_order_relaxed) : workers;
+        auto const idle = workers > busy ? workers - busy : 0;
+        auto const rows = this->numResiduals_ / std::max<std::size_t>(rowBlocks_.MinBlockRows, 1);
+        return std::max<std::size_t>(1, std::min({ idle + 1, rowBlocks_.Interpreters.size(), rows }));
+    }
+
     inline auto Evaluate(Scalar const* parameters, Scalar* residuals, Scalar* jacobian) const -> bool // NOLINT
     {
         EXPECT(target_.size() == this->numResiduals_);
         EXPECT(parameters != nullptr);
         Operon::Span<Operon::Scalar const> params{ parameters, this->numParameters_ };
 
+        if (auto const blocks = RowBlockCount(); blocks > 1) {
+            EvaluateRowBlocks(blocks, params, residuals, jacobian);
+        } else {
+            EvaluateRows(*interpreter_, params, range_, residuals, jacobian);
+        }
+
         if (jacobian != nullptr) {
             ++this->jacobianCallCount_;
-            Operon::Span<Operon::Scalar> jac{jacobian, this->numResiduals_ * this->numParameters_};
-            interpreter_->JacRev(params, range_, jac);
             ApplyLMJacobianWeights(weights_, jacobian, this->numResiduals_, this->numParameters_);
         }
 
         if (residuals != nullptr) {
             ++this->residualCallCount_;
-            Operon::Span<Operon::Scalar> res{ residuals, this->numResiduals_ };
-            interpreter_->Evaluate(params, range_, res);
             Eigen::Map<Eigen::Array<Operon::Scalar, -1, 1>> x(residuals, static_cast<Eigen::Index>(this->numResiduals_));
             Eigen::Map<Eigen::Array<Operon::Scalar, -1, 1> const> y(target_.data(), static_cast<Eigen::Index>(this->numResiduals_));
             x -= y;
@@ -61,10 +113,80 @@ struct LMCostFunction : public LMCostFunctionBase<LMCostFunction<T, StorageOrder
     }
 
 private:
+    // Model output and/or Jacobian over `rows`, written contiguously.
+    auto EvaluateRows(InterpreterBase<T> const& interpreter, Operon::Span<Operon::Scalar const> params, Operon::Range rows, Scalar* residuals, Scalar* jacobian) const -> void
+    {
+        auto const n = rows.Size();
+        Operon::Span<Operon::Scalar> res{ residuals, residuals != nullptr ? n : 0 };
+        Operon::Span<Operon::Scalar> jac{ jacobian, jacobian != nullptr ? n * this->numParameters_ : 0 };
+        if (jacobian != nullptr && residuals != nullptr) {
+            interpreter.EvaluateWithJacobian(params, rows, res, jac);
+        } else if (jacobian != nullptr) {
+            interpreter.JacRev(params, rows, jac);
+        } else if (residuals != nullptr) {
+            interpreter.Evaluate(params, rows, res);
+        }
+    }
+
+    // Residual blocks are slices of `residuals`; Jacobian blocks are
+    // computed contiguously into per-block scratch and copied into their
+    // rows of the column-major Jacobian. The taskflow, one task per block,
+    // is built when the block count changes and otherwise rerun as is; its
+    // tasks take the arguments of the evaluation from call_.
+    auto EvaluateRowBlocks(std::size_t blocks, Operon::Span<Operon::Scalar const> params, Scalar* residuals, Scalar* jacobian) const -> void
+    {
+        static_assert(StorageOrder == Eigen::ColMajor, "row blocks are copied into a column-major Jacobian");
+        if (blocks != taskflowBlocks_) {
+            taskflow_.clear();
+            for (auto b = 0UL; b < blocks; ++b) {
+                taskflow_.emplace([this, b, blocks]() -> void { EvaluateRowBlock(b, blocks); });
+            }
+            taskflowBlocks_ = blocks;
+        }
+        call_ = { .Params = params, .Residuals = residuals, .Jacobian = jacobian };
+        // a worker thread must not block on its own executor: corun lets it
+        // take part in the blocks instead
+        if (rowBlocks_.Executor->this_worker_id() >= 0) {
+            rowBlocks_.Executor->corun(taskflow_);
+        } else {
+            rowBlocks_.Executor->run(taskflow_).get();
+        }
+    }
+
+    auto EvaluateRowBlock(std::size_t b, std::size_t blocks) const -> void
+    {
+        auto const n = this->numResiduals_;
+        auto const p = this->numParameters_;
+        auto const [params, residuals, jacobian] = call_;
+        auto const lo = n * b / blocks;
+        auto const hi = n * (b + 1) / blocks;
+        Operon::Range const rows{ range_.Start() + lo, range_.Start() + hi };
+        auto& scratch = scratch_[b];
+        if (jacobian != nullptr) { scratch.resize((hi - lo) * p); }
+        EvaluateRows(*rowBlocks_.Interpreters[b], params, rows, residuals != nullptr ? residuals + lo : nullptr, jacobian != nullptr ? scratch.data() : nullptr);
+        if (jacobian != nullptr) {
+            Eigen::Map<Eigen::Matrix<Operon::Scalar, -1, -1>> dst(jacobian, static_cast<Eigen::Index>(n), static_cast<Eigen::Index>(p));
+            Eigen::Map<Eigen::Matrix<Operon::Scalar, -1, -1> const> src(scratch.data(), static_cast<Eigen::Index>(hi - lo), static_cast<Eigen::Index>(p));
+            dst.middleRows(static_cast<Eigen::Index>(lo), static_cast<Eigen::Index>(hi - lo)) = src;
+        }
+    }
+
+    // the arguments of the evaluation the row-block tasks are running
+    struct Call {
+        Operon::Span<Operon::Scalar const> Params;
+        Scalar* Residuals{nullptr};
+        Scalar* Jacobian{nullptr};
+    };
+
     gsl::not_null<InterpreterBase<T> const*> interpreter_;
     Operon::Span<Operon::Scalar const> target_;
     Operon::Range const range_; // NOLINT
     Operon::Span<Operon::Scalar const> weights_;
+    LMRowBlocks<T> rowBlocks_;
+    mutable std::vector<Operon::Vector<Operon::Scalar>> scratch_; // per-block Jacobian rows
+    mutable tf::Taskflow taskflow_;                               // its tasks point back at this object
+    mutable std::size_t taskflowBlocks_{0};
+    mutable Call call_;
 };
 } // namespace Operon
 
@@ -8,7 +8,17 @@
 #include <gsl/pointers>
 #include <lbfgs/solver.hpp>
 #include <tl/expected.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
 #include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
 
 #include "operon/error_metrics/sum_of_squared_errors.hpp"
 
@@ -20,9 +30,12 @@
 #include "likelihood/poisson_likelihood.hpp"
 // GaussianLoss / PoissonLoss are defined in the same headers above.
 #include "lm_cost_function.hpp"
+#include "robust_loss.hpp"
 #include "operon/core/comparison.hpp"
 #include "operon/core/dispatch.hpp"
 #include "operon/core/problem.hpp"
+#include "operon/core/tree_diff.hpp"
+#include "solvers/batch_cholesky.hpp"
 #include "solvers/sgd.hpp"
 #if defined(HAVE_ASMJIT)
 #include "jit_lm_cost_function.hpp"
@@ -45,6 +58,9 @@ struct FitDiagnostics {
     int Iterations{};
     int FunctionEvaluations{};
     int JacobianEvaluations{};
+    // passes that also evaluated the second derivatives (NewtonOptimizer);
+    // each is counted as a function and a Jacobian evaluation as well
+    int HessianEvaluations{};
 };
 
 struct FitResult : FitDiagnostics {};   // FinalCost improved on InitialCost
@@ -57,11 +73,40 @@ using FitOutcome = tl::expected<FitResult, FitFailure>;
                                 : static_cast<FitDiagnostics const&>(outcome.error());
 }
 
+// Optional early stopping on top of the iteration budget, for fits that
+// have stopped paying off long before it runs out. Zero disables a rule.
+// RelativeImprovement stops once an accepted step lowers the cost by less
+// than that fraction of it; GradientNorm stops once the max-norm of the
+// loss gradient falls below it (the backend's own gradient measure: Jacobi
+// scaled for Tiny and the batched solver, MINPACK's scaled gtol for Eigen).
+// The Levenberg-Marquardt backends (the JIT one included),
+// VariableProjectionOptimizer, NewtonOptimizer and
+// RobustLevenbergMarquardtOptimizer (in every pass) honour them; L-BFGS and
+// SGD only see the iteration budget (see OptimizerBase::StoppingSupported).
+struct StoppingRules {
+    double RelativeImprovement{0};
+    double GradientNorm{0};
+};
+
+// Row-parallel Levenberg-Marquardt fits (see LMRowBlocks): when the
+// executor has idle workers, a fit splits each residual/Jacobian evaluation
+// into row blocks of at least MinBlockRows rows and runs them on
+// `Executor`. Null (the default) keeps every fit on its own thread.
+struct RowParallelism {
+    tf::Executor* Executor{nullptr};
+    std::size_t MinBlockRows{1UL << 15U}; // NOLINT
+};
+
 class OptimizerBase {
 gsl::not_null<Problem const*> problem_;
 // batch size for loss functions (default = 0 -> use entire data range)
 mutable std::size_t batchSize_{0};
 mutable std::size_t iterations_{100}; // NOLINT
+mutable StoppingRules stopping_{};
+mutable RowParallelism rowParallelism_{};
+mutable bool linearWarmStart_{false};
+// fits in flight, shared by copies as they share the executor
+mutable std::shared_ptr<std::atomic<std::size_t>> busy_{std::make_shared<std::atomic<std::size_t>>(0)};
 
 public:
     explicit OptimizerBase(gsl::not_null<Problem const*> problem)
@@ -78,17 +123,265 @@ public:
 
     [[nodiscard]] auto GetProblem() const -> Problem const* { return problem_.get(); }
     [[nodiscard]] auto BatchSize() const -> std::size_t { return batchSize_; }
-    [[nodiscard]] auto Iterations() const -> std::size_t { return iterations_; }
+    [[nodiscard]] auto Stopping() const -> StoppingRules const& { return stopping_; }
+
+    // The iteration budget of a fit started on the calling thread: the
+    // configured one, unless a per-individual budget is in force (see
+    // LocalSearchBudget::Scope). Optimizers are shared between threads, so
+    // per-call budgets cannot go through SetIterations.
+    [[nodiscard]] auto Iterations() const -> std::size_t { return IterationOverride().value_or(iterations_); }
+    [[nodiscard]] auto ConfiguredIterations() const -> std::size_t { return iterations_; }
 
     auto SetBatchSize(std::size_t batchSize) const { batchSize_ = batchSize; }
     auto SetIterations(std::size_t iterations) const { iterations_ = iterations; }
+    auto SetStopping(StoppingRules rules) const { stopping_ = rules; }
+    auto SetRowParallelism(RowParallelism config) const { rowParallelism_ = config; }
+    // Least-squares optimizers first solve for the coefficients the tree is
+    // linear in (see detail::ProjectLinearCoefficients); the others ignore
+    // the setting, see LinearWarmStartSupported.
+    auto SetLinearWarmStart(bool warmStart) const { linearWarmStart_ = warmStart; }
+    [[nodiscard]] auto LinearWarmStart() const -> bool { return linearWarmStart_; }
+
+    [[nodiscard]] auto GetRowParallelism() const -> RowParallelism const& { return rowParallelism_; }
+    [[nodiscard]] auto FitsInFlight() const -> std::atomic<std::size_t>& { return *busy_; }
+
+    // The calling thread's override of Iterations(), shared by all optimizers.
+    static auto IterationOverride() -> std::optional<std::size_t>&
+    {
+        thread_local std::optional<std::size_t> iterations;
+        return iterations;
+    }
 
     [[nodiscard]] virtual auto Optimize(Operon::RandomGenerator& rng, Tree const& tree) const -> FitOutcome = 0;
+
+    // Optimizes many trees in one call; rngs[i] belongs to trees[i] and the
+    // outcomes come back in the same order. The default just calls Optimize
+    // once per tree, so every optimizer supports it - optimizers that can
+    // share work across the batch (BatchedLevenbergMarquardtOptimizer)
+    // override it.
+    [[nodiscard]] virtual auto OptimizeBatch(Operon::Span<Operon::RandomGenerator> rngs, Operon::Span<Tree const* const> trees) const -> std::vector<FitOutcome>
+    {
+        EXPECT(rngs.size() == trees.size());
+        std::vector<FitOutcome> outcomes;
+        outcomes.reserve(trees.size());
+        for (auto i = 0UL; i < trees.size(); ++i) {
+            outcomes.push_back(Optimize(rngs[i], *trees[i]));
+        }
+        return outcomes;
+    }
+
+    // Whether OptimizeBatch does better than one Optimize per tree, i.e.
+    // whether callers should gather trees into batches for it.
+    [[nodiscard]] virtual auto Batched() const -> bool { return false; }
+
+    // Whether SetLinearWarmStart has any effect. Variable projection does
+    // the projection on every fit anyway. The robust optimizer minimizes a
+    // loss a least-squares projection need not lower, and it, L-BFGS and
+    // SGD start from the coefficients as they are.
+    [[nodiscard]] virtual auto LinearWarmStartSupported() const -> bool { return false; }
+
+    // Whether the StoppingRules have any effect; L-BFGS and SGD run every
+    // iteration of their budget (Iterations(), so a LocalSearchBudget still
+    // applies to them).
+    [[nodiscard]] virtual auto StoppingSupported() const -> bool { return true; }
+
     [[nodiscard]] virtual auto ComputeLikelihood(Operon::Span<Operon::Scalar const> x, Operon::Span<Operon::Scalar const> y, Operon::Span<Operon::Scalar const> w) const -> Operon::Scalar = 0;
     [[nodiscard]] virtual auto ComputeFisherMatrix(Operon::Span<Operon::Scalar const> pred, Operon::Span<Operon::Scalar const> jac, Operon::Span<Operon::Scalar const> sigma) const -> Eigen::Matrix<Operon::Scalar, -1, -1> = 0;
 };
 
 namespace detail {
+    // The row-parallel side of one LM fit: counts the fit as in flight for
+    // its lifetime and, when the range is large enough to split, owns one
+    // interpreter per potential block (at most one per worker) and hands
+    // them to the cost function, which picks the block count per evaluation.
+    template<typename DTable>
+    class RowBlockFit {
+    public:
+        RowBlockFit(OptimizerBase const& optimizer, DTable const* dtable, Dataset const* dataset, Tree const* tree)
+            : config_{optimizer.GetRowParallelism()}, busy_{optimizer.FitsInFlight()}
+        {
+            busy_.fetch_add(1, std::memory_order_relaxed);
+            auto const rows = optimizer.GetProblem()->TrainingRange().Size();
+            auto const minRows = std::max<std::size_t>(config_.MinBlockRows, 1);
+            if (config_.Executor == nullptr || rows < 2 * minRows) { return; }
+            auto const blocks = std::min(config_.Executor->num_workers(), rows / minRows);
+            interpreters_.reserve(blocks);
+            for (auto i = 0UL; i < blocks; ++i) { interpreters_.emplace_back(dtable, dataset, tree); }
+        }
+
+        ~RowBlockFit() { busy_.fetch_sub(1, std::memory_order_relaxed); }
+
+        RowBlockFit(RowBlockFit const&) = delete;
+        RowBlockFit(RowBlockFit&&) = delete;
+        auto operator=(RowBlockFit const&) -> RowBlockFit& = delete;
+        auto operator=(RowBlockFit&&) -> RowBlockFit& = delete;
+
+        template<typename CostFunction>
+        auto Bind(CostFunction& cf) const -> void
+        {
+            if (interpreters_.size() < 2) { return; }
+            LMRowBlocks<Operon::Scalar> blocks{ .Executor = config_.Executor, .Interpreters = {}, .Busy = &busy_, .MinBlockRows = config_.MinBlockRows };
+            blocks.Interpreters.reserve(interpreters_.size());
+            for (auto const& interpreter : interpreters_) { blocks.Interpreters.push_back(&interpreter); }
+            cf.SetRowBlocks(std::move(blocks));
+        }
+
+    private:
+        RowParallelism config_;
+        std::atomic<std::size_t>& busy_;
+        std::vector<Operon::Interpreter<Operon::Scalar, DTable>> interpreters_;
+    };
+
+    // Scratch that outlives a fit: each thread keeps one T and every fit it
+    // runs reuses it, so storage sized by earlier fits (a TinySolver's
+    // buffers, say) is not reallocated by the next. Workers are threads and
+    // optimizers are shared between them, so this is per thread rather than
+    // per optimizer. A fit can start while another is running on the same
+    // thread (a worker helping with another fit's row blocks via corun); the
+    // inner one then gets a T of its own for its duration.
+    template<typename T>
+    class ThreadWorkspace {
+    public:
+        ThreadWorkspace()
+            : slot_{Slot()}, owned_{std::exchange(slot_.Busy, true) ? std::make_unique<T>() : nullptr}
+        {
+        }
+
+        ~ThreadWorkspace() { if (owned_ == nullptr) { slot_.Busy = false; } }
+
+        ThreadWorkspace(ThreadWorkspace const&) = delete;
+        ThreadWorkspace(ThreadWorkspace&&) = delete;
+        auto operator=(ThreadWorkspace const&) -> ThreadWorkspace& = delete;
+        auto operator=(ThreadWorkspace&&) -> ThreadWorkspace& = delete;
+
+        auto operator*() const -> T& { return owned_ != nullptr ? *owned_ : slot_.Value; }
+        auto operator->() const -> T* { return &**this; }
+
+        // whether this lease got the thread's own T
+        [[nodiscard]] auto Shared() const -> bool { return owned_ == nullptr; }
+
+    private:
+        struct Entry {
+            T Value;
+            bool Busy{false};
+        };
+
+        static auto Slot() -> Entry&
+        {
+            thread_local Entry entry;
+            return entry;
+        }
+
+        Entry& slot_;
+        std::unique_ptr<T> owned_;
+    };
+
+    // Data-driven starting values: one least-squares solve for the
+    // coefficients the tree is linear in (`linear`, see LinearCoefficients),
+    // the others held fixed, from a linearization at `x` the caller already
+    // has: the weighted residual and the column-major n x p Jacobian. Fresh
+    // coefficients (random scales of a new subtree, say) then start at their
+    // optimum given the rest instead of wherever the initializer put them;
+    // the model is linear in them, so the cost can only go down. Returns
+    // whether `x` changed, i.e. whether the linearization is now stale; `x`
+    // is left as it was if the solve is not finite.
+    inline auto ProjectLinearCoefficients(Operon::Span<std::size_t const> linear, Operon::Span<Operon::Scalar const> residual, Operon::Span<Operon::Scalar const> jacobian, std::vector<Operon::Scalar>& x) -> bool
+    {
+        using Vector = Eigen::Matrix<Operon::Scalar, -1, 1>;
+        using Matrix = Eigen::Matrix<Operon::Scalar, -1, -1>;
+        if (linear.empty() || residual.empty()) { return false; }
+        auto const n = std::ssize(residual);
+        Eigen::Map<Vector const> const r(residual.data(), n);
+        Eigen::Map<Matrix const> const jac(jacobian.data(), n, std::ssize(x));
+        if (!r.allFinite() || !jac.allFinite()) { return false; }
+        Matrix phi(n, std::ssize(linear));
+        for (auto k = 0L; k < phi.cols(); ++k) { phi.col(k) = jac.col(static_cast<Eigen::Index>(linear[k])); }
+        Vector const delta = phi.colPivHouseholderQr().solve(-r);
+        if (!delta.allFinite()) { return false; }
+        for (auto k = 0L; k < delta.size(); ++k) { x[linear[k]] += delta(k); }
+        return true;
+    }
+
+    // a residual and column-major Jacobian, kept per thread between fits
+    struct Linearization {
+        std::vector<Operon::Scalar> Residual;
+        std::vector<Operon::Scalar> Jacobian;
+    };
+
+    // The warm start for optimizers that hand `cf` to a solver which does
+    // its own first evaluation (the Tiny and Eigen backends): one residual
+    // and Jacobian pass of `cf` at `x`, into the thread's scratch, then the
+    // solve above. Returns the cost at the original `x`, or nothing, without
+    // a pass, when no coefficient enters the tree linearly.
+    template<typename CostFunction>
+    auto ProjectLinearCoefficients(CostFunction const& cf, Tree const& tree, std::vector<Operon::Scalar>& x) -> std::optional<double>
+    {
+        static_assert(CostFunction::Storage == Eigen::ColMajor, "the projection reads a column-major Jacobian");
+        auto const linear = LinearCoefficients(tree);
+        if (linear.empty()) { return std::nullopt; }
+        ThreadWorkspace<Linearization> const workspace;
+        auto& [residual, jacobian] = *workspace;
+        residual.resize(cf.NumResiduals());
+        jacobian.resize(cf.NumResiduals() * cf.NumParameters());
+        cf.Evaluate(x.data(), residual.data(), jacobian.data());
+        auto const cost = 0.5 * static_cast<double>(Eigen::Map<Eigen::Matrix<Operon::Scalar, -1, 1> const>(residual.data(), std::ssize(residual)).squaredNorm()); // NOLINT
+        if (std::isfinite(cost)) { (void)ProjectLinearCoefficients(linear, residual, jacobian, x); }
+        return cost;
+    }
+
+    // TinySolver's constants and damping schedule, for the optimizers that
+    // run its Levenberg-Marquardt loop themselves (batched, variable
+    // projection, Newton) so they stay in step with the Tiny backend. The
+    // damping scales the clamped diagonal added to the normal equations and
+    // follows the ratio rho of actual to predicted decrease.
+    struct TrustRegionSchedule {
+        static constexpr double GradientTolerance { 1e-10 };
+        static constexpr double ParameterTolerance { 1e-8 };
+        static constexpr double FunctionTolerance { 1e-6 };
+        static constexpr double InitialTrustRegionRadius { 1e4 };
+        static constexpr double MinDiagonal { 1e-6 };
+        static constexpr double MaxDiagonal { 1e32 };
+        static constexpr double CostThreshold { std::numeric_limits<Operon::Scalar>::epsilon() };
+
+        double Damping { 1 / InitialTrustRegionRadius };
+        double Growth { 2 };
+
+        // what the damping adds to a diagonal entry of the normal equations
+        [[nodiscard]] auto Damp(double diagonal) const -> double { return Damping * std::clamp(diagonal, MinDiagonal, MaxDiagonal); }
+
+        auto Accept(double rho) -> void {
+            auto const t = (2 * rho) - 1;
+            Damping *= std::max(1 / 3., 1 - (t * t * t));
+            Growth = 2;
+        }
+
+        auto Reject() -> void {
+            Damping *= Growth;
+            Growth *= 2;
+        }
+
+        [[nodiscard]] static auto Converged(double gradientMaxNorm, double cost) -> bool {
+            return gradientMaxNorm < GradientTolerance || cost < CostThreshold;
+        }
+
+        // ||dx|| <= parameter_tolerance * (||x|| + parameter_tolerance)
+        [[nodiscard]] static auto StepTooSmall(double stepNorm, double xNorm) -> bool {
+            return stepNorm < ParameterTolerance * (xNorm + ParameterTolerance);
+        }
+
+        // (new_cost - old_cost) < function_tolerance, on twice the cost as
+        // TinySolver measures it
+        [[nodiscard]] static auto CostChangeTooSmall(double costChange) -> bool {
+            return std::abs(costChange) < FunctionTolerance;
+        }
+    };
+
+    // The early stopping rules, checked after an accepted step took the
+    // cost from `previous` to `current`.
+    inline auto StopEarly(StoppingRules const& rules, double previous, double current, double gradientMaxNorm) -> bool {
+        return (previous - current < rules.RelativeImprovement * previous) || gradientMaxNorm < rules.GradientNorm;
+    }
+
     inline auto CheckSuccess(double initialCost, double finalCost) {
         constexpr auto CHECK_NAN{true};
         return Operon::Less<CHECK_NAN>{}(finalCost, initialCost);
@@ -126,11 +419,21 @@ struct LevenbergMarquardtOptimizer : public OptimizerBase {
 
         Operon::Interpreter<Operon::Scalar, DTable> interpreter{dtable, dataset, &tree};
         Operon::LMCostFunction cf{gsl::not_null<Operon::InterpreterBase<Operon::Scalar> const*>{&interpreter}, target, range, weights};
-        ceres::TinySolver<decltype(cf)> solver;
+        detail::RowBlockFit<DTable> const rowBlocks{*this, dtable, dataset, &tree};
+        rowBlocks.Bind(cf);
+        using Solver = ceres::TinySolver<decltype(cf)>;
+        detail::ThreadWorkspace<Solver> const workspace;
+        auto& solver = *workspace;
+        // the thread's solver still holds the previous fit's settings and
+        // summary (reported as is when there is nothing to fit)
+        solver.options = {};
+        solver.summary = {};
 
         auto x0 = tree.GetCoefficients();
         FitDiagnostics diag;
         diag.InitialParameters = x0;
+        std::optional<double> initialCost;
+        if (this->LinearWarmStart() && !x0.empty()) { initialCost = detail::ProjectLinearCoefficients(cf, tree, x0); }
         auto m0 = Eigen::Map<Eigen::Matrix<Operon::Scalar, Eigen::Dynamic, 1>>(x0.data(), x0.size());
         if (!x0.empty()) {
             // max_num_accepted_steps counts accepted LM steps only, matching
@@ -142,12 +445,15 @@ struct LevenbergMarquardtOptimizer : public OptimizerBase {
             // attempts, mirroring maxfev's role for the Eigen backend.
             solver.options.max_num_accepted_steps = static_cast<int>(iterations);
             solver.options.max_num_iterations = static_cast<int>(iterations) * (static_cast<int>(x0.size()) + 1);
-            typename decltype(solver)::ParameterVector p = m0.cast<typename decltype(cf)::Scalar>();
+            auto const& stopping = this->Stopping();
+            solver.options.relative_function_tolerance = static_cast<typename Solver::Scalar>(stopping.RelativeImprovement);
+            solver.options.gradient_tolerance = std::max(solver.options.gradient_tolerance, static_cast<typename Solver::Scalar>(stopping.GradientNorm));
+            typename Solver::ParameterVector p = m0.cast<typename decltype(cf)::Scalar>();
             solver.Solve(cf, &p);
             m0 = p.template cast<Operon::Scalar>();
         }
         diag.FinalParameters = x0;
-        diag.InitialCost = solver.summary.initial_cost;
+        diag.InitialCost = static_cast<Operon::Scalar>(initialCost.value_or(solver.summary.initial_cost));
         diag.FinalCost = solver.summary.final_cost;
         diag.Iterations = solver.summary.iterations;
         diag.FunctionEvaluations = cf.ResidualCalls();
@@ -155,6 +461,8 @@ struct LevenbergMarquardtOptimizer : public OptimizerBase {
         return detail::MakeFitOutcome(std::move(diag));
     }
 
+    [[nodiscard]] auto LinearWarmStartSupported() const -> bool final { return true; }
+
     auto GetDispatchTable() const -> DTable const* { return dtable_.get(); }
 
     [[nodiscard]] auto ComputeLikelihood(Operon::Span<Operon::Scalar const> x, Operon::Span<Operon::Scalar const> y, Operon::Span<Operon::Scalar const> w) const -> Operon::Scalar final
@@ -190,11 +498,15 @@ struct LevenbergMarquardtOptimizer<DTable, OptimizerType::Eigen> final : public
 
         Operon::Interpreter<Operon::Scalar, DTable> interpreter{dtable, dataset, &tree};
         Operon::LMCostFunction<Operon::Scalar> cf{&interpreter, target, range, weights};
+        detail::RowBlockFit<DTable> const rowBlocks{*this, dtable, dataset, &tree};
+        rowBlocks.Bind(cf);
         Eigen::LevenbergMarquardt<decltype(cf)> lm(cf);
 
         auto x0 = tree.GetCoefficients();
         FitDiagnostics diag;
         diag.InitialParameters = x0;
+        std::optional<double> initialCost;
+        if (this->LinearWarmStart() && !x0.empty()) { initialCost = detail::ProjectLinearCoefficients(cf, tree, x0); }
         if (!x0.empty()) {
             // `iterations` counts accepted LM steps (lm.iterations()), matching the
             // Tiny/ceres variant's max_num_iterations - it is not itself a function-
@@ -207,6 +519,8 @@ struct LevenbergMarquardtOptimizer<DTable, OptimizerType::Eigen> final : public
             // size instead of being a fixed constant.
             auto const maxfev = static_cast<Eigen::Index>(iterations) * (static_cast<Eigen::Index>(x0.size()) + 1);
             lm.setMaxfev(std::max<Eigen::Index>(maxfev, 1));
+            auto const& stopping = this->Stopping();
+            if (stopping.GradientNorm > 0) { lm.setGtol(static_cast<Operon::Scalar>(stopping.GradientNorm)); }
 
             Eigen::Map<Eigen::Matrix<Operon::Scalar, -1, 1>> m0(x0.data(), std::ssize(x0));
             Eigen::Matrix<Operon::Scalar, -1, 1> m = m0;
@@ -214,9 +528,17 @@ struct LevenbergMarquardtOptimizer<DTable, OptimizerType::Eigen> final : public
             // do the minimization loop manually because we want to extract the initial cost
             Eigen::LevenbergMarquardtSpace::Status status = lm.minimizeInit(m);
             diag.InitialCost = diag.FinalCost = lm.fnorm() * lm.fnorm() * 0.5; // get the initial cost after calling minimizeInit()
+            if (initialCost) { diag.InitialCost = static_cast<Operon::Scalar>(*initialCost); }
             if (status != Eigen::LevenbergMarquardtSpace::ImproperInputParameters) {
                 do {
+                    auto const previous = static_cast<double>(lm.fnorm());
                     status = lm.minimizeOneStep(m);
+                    // fnorm is the residual norm, so the cost ratio is its square
+                    auto const current = static_cast<double>(lm.fnorm());
+                    if (status == Eigen::LevenbergMarquardtSpace::Running && current < previous
+                        && detail::StopEarly({ .RelativeImprovement = stopping.RelativeImprovement }, previous * previous, current * current, std::numeric_limits<double>::infinity())) {
+                        break;
+                    }
                 } while (status == Eigen::LevenbergMarquardtSpace::Running
                           && lm.iterations() < static_cast<Eigen::Index>(iterations));
             }
@@ -231,6 +553,8 @@ struct LevenbergMarquardtOptimizer<DTable, OptimizerType::Eigen> final : public
         return detail::MakeFitOutcome(std::move(diag));
     }
 
+    [[nodiscard]] auto LinearWarmStartSupported() const -> bool final { return true; }
+
     auto GetDispatchTable() const -> DTable const* { return dtable_.get(); }
 
     [[nodiscard]] auto ComputeLikelihood(Operon::Span<Operon::Scalar const> x, Operon::Span<Operon::Scalar const> y, Operon::Span<Operon::Scalar const> w) const -> Operon::Scalar final
@@ -246,6 +570,895 @@ struct LevenbergMarquardtOptimizer<DTable, OptimizerType::Eigen> final : public
     gsl::not_null<DTable const*> dtable_;
 };
 
+// Levenberg-Marquardt over a whole batch of trees in lockstep. Every tree
+// runs the same algorithm as the Tiny backend above (ceres::TinySolver: Jacobi
+// scaling fixed at the initial point, damping u * clamp(diag(J'J)), the same
+// accept/reject schedule and stopping tests), but instead of finishing one
+// tree before starting the next, each round performs one LM attempt for
+// every tree still running. The damped normal equations of a round are
+// grouped by coefficient count and solved with BatchCholeskySolve, which
+// vectorizes across the trees of a group - for the handful of coefficients
+// typical of GP models a single p x p solve is far too small to use the SIMD
+// lanes, a group of them is not. A tree drops out of the rounds as soon as
+// it converges or exhausts its budget, so its results (and its diagnostics:
+// Iterations counts accepted steps, FunctionEvaluations and
+// JacobianEvaluations the interpreter passes) are those of solving it alone.
+//
+// Residuals and Jacobians are computed per tree into scratch buffers shared
+// by the batch, grouped by shape: trees that differ only in their
+// coefficients (same nodes, same fixed constants) share one interpreter,
+// bound once, and within a coefficient count the trees of a shape are
+// evaluated one after the other. Only the per-tree normal equations
+// (p x p) are kept across rounds.
+//
+// Only OptimizeBatch callers get a batch: the algorithms' initial
+// population (LocalSearchBatch) and the offspring of generators that
+// score them in blocks (OffspringGeneratorBase::GenerateBatch).
+template <typename DTable>
+struct BatchedLevenbergMarquardtOptimizer final : public OptimizerBase {
+    explicit BatchedLevenbergMarquardtOptimizer(gsl::not_null<DTable const*> dtable, gsl::not_null<Problem const*> problem)
+        : OptimizerBase{problem}, dtable_{dtable}
+    {
+    }
+
+    [[nodiscard]] auto Optimize(Operon::RandomGenerator& rng, Operon::Tree const& tree) const -> FitOutcome final
+    {
+        std::array<Operon::Tree const*, 1> const trees{ &tree };
+        return OptimizeBatch({ &rng, 1 }, trees).front();
+    }
+
+    [[nodiscard]] auto OptimizeBatch(Operon::Span<Operon::RandomGenerator> rngs, Operon::Span<Operon::Tree const* const> trees) const -> std::vector<FitOutcome> final
+    {
+        EXPECT(rngs.size() == trees.size());
+        auto const* problem = this->GetProblem();
+        auto const* dataset = problem->GetDataset();
+        auto const range = problem->TrainingRange();
+        auto const n = range.Size();
+
+        Batch batch {
+            .Range = range,
+            .Target = problem->TargetValues().subspan(range.Start(), n),
+            .Weights = dataset->Weights().value_or(Operon::Span<Operon::Scalar const>{}),
+        };
+        if (!batch.Weights.empty()) {
+            batch.Weights = batch.Weights.subspan(range.Start(), n);
+            ValidateLMWeights(batch.Weights, n);
+        }
+
+        // same budgets as the Tiny backend: `iterations` accepted steps, and
+        // at most iterations * (p + 1) attempts, accepted or rejected
+        auto const iterations = static_cast<int>(this->Iterations());
+
+        std::vector<Fit> fits(trees.size());
+        std::size_t maxParameters{0};
+        for (auto i = 0UL; i < trees.size(); ++i) {
+            auto& fit = fits[i];
+            fit.X = trees[i]->GetCoefficients();
+            fit.Diag.InitialParameters = fit.X;
+            fit.MaxAttempts = iterations * (static_cast<int>(fit.X.size()) + 1);
+            maxParameters = std::max(maxParameters, fit.X.size());
+        }
+        batch.Residual.resize(n);
+        batch.Jacobian.resize(n * maxParameters);
+
+        // one interpreter per shape; fits of a shape take the index of its
+        // first tree, so that sorting on it keeps them together
+        std::vector<std::unique_ptr<Operon::Interpreter<Operon::Scalar, DTable>>> interpreters(trees.size());
+        for (auto i = 0UL; i < trees.size(); ++i) {
+            auto& fit = fits[i];
+            if (fit.X.empty() || iterations == 0) { continue; }
+            fit.Shape = i;
+            for (auto k = 0UL; k < i; ++k) {
+                if (interpreters[k] != nullptr && SameShape(*trees[k], *trees[i])) { fit.Shape = k; break; }
+            }
+            auto& interpreter = interpreters[fit.Shape];
+            if (interpreter == nullptr) { interpreter = std::make_unique<Operon::Interpreter<Operon::Scalar, DTable>>(this->GetDispatchTable(), dataset, trees[i]); }
+            fit.Interpreter = interpreter.get();
+            auto ok = Linearize(batch, fit);
+            fit.Diag.InitialCost = static_cast<Operon::Scalar>(fit.Cost);
+            if (ok && this->LinearWarmStart()) { ok = WarmStart(batch, fit, *trees[i]); }
+            fit.Diag.FinalCost = static_cast<Operon::Scalar>(fit.Cost);
+            fit.Active = ok && fit.Attempts < fit.MaxAttempts && !Converged(fit);
+        }
+
+        // one LM attempt per running tree and round, trees with the same
+        // coefficient count solved together
+        std::vector<std::size_t> order;
+        while (true) {
+            order.clear();
+            for (auto i = 0UL; i < fits.size(); ++i) {
+                if (fits[i].Active) { order.push_back(i); }
+            }
+            if (order.empty()) { break; }
+            std::ranges::stable_sort(order, std::less{}, [&](auto i) { return std::pair{fits[i].X.size(), fits[i].Shape}; });
+
+            for (auto it = order.begin(); it != order.end();) {
+                auto const p = fits[*it].X.size();
+                auto end = std::find_if(it, order.end(), [&](auto i) { return fits[i].X.size() != p; });
+                Step(batch, fits, { it, end }, p);
+                it = end;
+            }
+        }
+
+        std::vector<FitOutcome> outcomes;
+        outcomes.reserve(fits.size());
+        for (auto& fit : fits) {
+            fit.Diag.FinalParameters = fit.X;
+            outcomes.push_back(detail::MakeFitOutcome(std::move(fit.Diag)));
+        }
+        return outcomes;
+    }
+
+    [[nodiscard]] auto Batched() const -> bool final { return true; }
+    [[nodiscard]] auto LinearWarmStartSupported() const -> bool final { return true; }
+
+    auto GetDispatchTable() const -> DTable const* { return dtable_.get(); }
+
+    [[nodiscard]] auto ComputeLikelihood(Operon::Span<Operon::Scalar const> x, Operon::Span<Operon::Scalar const> y, Operon::Span<Operon::Scalar const> w) const -> Operon::Scalar final
+    {
+        return GaussianLikelihood<Operon::Scalar>::ComputeLikelihood(x, y, w);
+    }
+
+    [[nodiscard]] auto ComputeFisherMatrix(Operon::Span<Operon::Scalar const> pred, Operon::Span<Operon::Scalar const> jac, Operon::Span<Operon::Scalar const> sigma) const -> Eigen::Matrix<Operon::Scalar, -1, -1> final {
+        return GaussianLikelihood<Operon::Scalar>::ComputeFisherMatrix(pred, jac, sigma);
+    }
+
+private:
+    using Schedule = detail::TrustRegionSchedule;
+
+    // inputs and scratch shared by all trees of one OptimizeBatch call
+    struct Batch {
+        Operon::Range Range;
+        Operon::Span<Operon::Scalar const> Target;  // range-local
+        Operon::Span<Operon::Scalar const> Weights; // range-local, or empty
+        std::vector<Operon::Scalar> Residual;
+        std::vector<Operon::Scalar> Jacobian;
+        std::vector<double> Lhs;                    // structure-of-arrays, see BatchCholeskySolve
+        std::vector<double> Rhs;
+        std::vector<std::uint8_t> Solved;
+    };
+
+    // per-tree solver state
+    struct Fit {
+        Operon::Interpreter<Operon::Scalar, DTable> const* Interpreter{nullptr}; // shared by the fits of a shape
+        std::size_t Shape{0};
+        std::vector<Operon::Scalar> X;
+        std::vector<Operon::Scalar> Trial;
+        Eigen::VectorXd Scaling;  // Jacobi scaling, from the initial Jacobian
+        Eigen::MatrixXd Hessian;  // J'J of the scaled Jacobian
+        Eigen::VectorXd Gradient; // -J'r of the scaled Jacobian
+        double Cost{0};           // 0.5 * ||r||^2
+        Schedule Damping;
+        int Attempts{1};
+        int MaxAttempts{0};
+        bool Active{false};
+        FitDiagnostics Diag;
+    };
+
+    // weighted residuals r = w^(1/2) (f(x) - y) at `x` into batch.Residual,
+    // returning 0.5 * ||r||^2
+    auto Residual(Batch& batch, Fit& fit, Operon::Span<Operon::Scalar const> x) const -> double
+    {
+        auto const n = batch.Range.Size();
+        Operon::Span<Operon::Scalar> res{ batch.Residual.data(), n };
+        fit.Interpreter->Evaluate(x, batch.Range, res);
+        ++fit.Diag.FunctionEvaluations;
+        Eigen::Map<Eigen::Array<Operon::Scalar, -1, 1>> r(res.data(), static_cast<Eigen::Index>(n));
+        r -= Eigen::Map<Eigen::Array<Operon::Scalar, -1, 1> const>(batch.Target.data(), static_cast<Eigen::Index>(n));
+        ApplyLMResidualWeights(batch.Weights, res.data(), n);
+        return 0.5 * static_cast<double>(r.matrix().squaredNorm()); // NOLINT
+    }
+
+    // residuals, Jacobian and normal equations at fit.X
+    auto Linearize(Batch& batch, Fit& fit) const -> bool
+    {
+        auto const n = batch.Range.Size();
+        auto const p = fit.X.size();
+        Operon::Span<Operon::Scalar> res{ batch.Residual.data(), n };
+        Operon::Span<Operon::Scalar> jac{ batch.Jacobian.data(), n * p };
+        fit.Interpreter->EvaluateWithJacobian(fit.X, batch.Range, res, jac);
+        ++fit.Diag.FunctionEvaluations;
+        ++fit.Diag.JacobianEvaluations;
+
+        Eigen::Map<Eigen::Matrix<Operon::Scalar, -1, 1>> r(res.data(), static_cast<Eigen::Index>(n));
+        r -= Eigen::Map<Eigen::Matrix<Operon::Scalar, -1, 1> const>(batch.Target.data(), static_cast<Eigen::Index>(n));
+        ApplyLMResidualWeights(batch.Weights, res.data(), n);
+        ApplyLMJacobianWeights(batch.Weights, jac.data(), n, p);
+
+        Eigen::Map<Eigen::Matrix<Operon::Scalar, -1, -1>> j(jac.data(), static_cast<Eigen::Index>(n), static_cast<Eigen::Index>(p));
+        if (fit.Scaling.size() == 0) {
+            fit.Scaling = (1.0 / (1.0 + j.colwise().norm().cast<double>().array())).matrix().transpose();
+        }
+        j = j * fit.Scaling.cast<Operon::Scalar>().asDiagonal();
+        fit.Hessian = (j.transpose() * j).cast<double>();
+        fit.Gradient = -(j.transpose() * r).cast<double>();
+        fit.Cost = 0.5 * static_cast<double>(r.squaredNorm()); // NOLINT
+        return std::isfinite(fit.Cost) && fit.Hessian.allFinite() && fit.Gradient.allFinite();
+    }
+
+    // the linear warm start (detail::ProjectLinearCoefficients) from the
+    // initial linearization, whose Jacobian Linearize left scaled; at the
+    // projected point the fit is linearized afresh, the Jacobi scaling
+    // included, as the Tiny backend fixes its scaling after the projection
+    auto WarmStart(Batch& batch, Fit& fit, Operon::Tree const& tree) const -> bool
+    {
+        auto const n = batch.Range.Size();
+        auto const p = fit.X.size();
+        Eigen::Map<Eigen::Matrix<Operon::Scalar, -1, -1>> j(batch.Jacobian.data(), static_cast<Eigen::Index>(n), static_cast<Eigen::Index>(p));
+        j = j * fit.Scaling.cwiseInverse().cast<Operon::Scalar>().asDiagonal();
+        auto const linear = LinearCoefficients(tree);
+        if (!detail::ProjectLinearCoefficients(linear, { batch.Residual.data(), n }, { batch.Jacobian.data(), n * p }, fit.X)) { return true; }
+        fit.Scaling.resize(0);
+        return Linearize(batch, fit);
+    }
+
+    // whether one interpreter can evaluate both trees: the same nodes,
+    // except for the values of the coefficients, which it is handed
+    static auto SameShape(Operon::Tree const& lhs, Operon::Tree const& rhs) -> bool
+    {
+        return std::ranges::equal(lhs.Nodes(), rhs.Nodes(), [](auto const& a, auto const& b) {
+            return a.HashValue == b.HashValue && a.Arity == b.Arity && a.Optimize == b.Optimize && (a.Optimize || a.Value == b.Value);
+        });
+    }
+
+    static auto Converged(Fit const& fit) -> bool
+    {
+        return Schedule::Converged(fit.Gradient.cwiseAbs().maxCoeff(), fit.Cost);
+    }
+
+    // one LM attempt for each of the fits in `group`, all with p coefficients
+    auto Step(Batch& batch, std::vector<Fit>& fits, Operon::Span<std::size_t const> group, std::size_t p) const -> void
+    {
+        auto const size = group.size();
+        batch.Lhs.assign(p * p * size, 0.0);
+        batch.Rhs.resize(p * size);
+        batch.Solved.assign(size, 1);
+        for (auto b = 0UL; b < size; ++b) {
+            auto const& fit = fits[group[b]];
+            for (auto i = 0UL; i < p; ++i) {
+                for (auto k = 0UL; k <= i; ++k) {
+                    batch.Lhs[(((i * p) + k) * size) + b] = fit.Hessian(i, k);
+                }
+                batch.Lhs[(((i * p) + i) * size) + b] += fit.Damping.Damp(fit.Hessian(i, i));
+                batch.Rhs[(i * size) + b] = fit.Gradient(i);
+            }
+        }
+        BatchCholeskySolve<double>(p, size, batch.Lhs, batch.Rhs, batch.Solved);
+
+        Eigen::VectorXd step(static_cast<Eigen::Index>(p));
+        for (auto b = 0UL; b < size; ++b) {
+            auto& fit = fits[group[b]];
+            for (auto i = 0UL; i < p; ++i) { step(i) = batch.Rhs[(i * size) + b]; }
+            fit.Active = Advance(batch, fit, step, batch.Solved[b] != 0) && ++fit.Attempts < fit.MaxAttempts;
+        }
+    }
+
+    // TinySolver's accept/reject logic for the scaled step `step`; returns
+    // false once the fit has terminated
+    auto Advance(Batch& batch, Fit& fit, Eigen::VectorXd const& step, bool solved) const -> bool
+    {
+        Eigen::Map<Eigen::Matrix<Operon::Scalar, -1, 1> const> x(fit.X.data(), std::ssize(fit.X));
+        if (solved) {
+            Eigen::VectorXd const dx = fit.Scaling.asDiagonal() * step;
+            if (Schedule::StepTooSmall(dx.norm(), static_cast<double>(x.norm()))) { return false; }
+
+            fit.Trial.resize(fit.X.size());
+            Eigen::Map<Eigen::Matrix<Operon::Scalar, -1, 1>>(fit.Trial.data(), std::ssize(fit.Trial)) = x + dx.cast<Operon::Scalar>();
+            auto const costChange = 2 * (fit.Cost - Residual(batch, fit, fit.Trial));
+            auto const modelCostChange = step.dot((2 * fit.Gradient) - (fit.Hessian * step));
+            auto const rho = costChange / modelCostChange;
+
+            if (rho > 0) {
+                std::swap(fit.X, fit.Trial);
+                ++fit.Diag.Iterations;
+                auto const previous = fit.Cost;
+                if (!Linearize(batch, fit)) {
+                    // the accepted point cannot be linearized; stay there
+                    // and report its cost, as TinySolver would
+                    fit.Diag.FinalCost = static_cast<Operon::Scalar>(fit.Cost);
+                    return false;
+                }
+                fit.Diag.FinalCost = static_cast<Operon::Scalar>(fit.Cost);
+                if (Schedule::CostChangeTooSmall(costChange) || Converged(fit)) { return false; }
+                if (detail::StopEarly(this->Stopping(), previous, fit.Cost, fit.Gradient.cwiseAbs().maxCoeff())) { return false; }
+                fit.Damping.Accept(rho);
+                return fit.Diag.Iterations < static_cast<int>(this->Iterations());
+            }
+            if (Schedule::CostChangeTooSmall(costChange)) { return false; }
+        }
+        // rejected, or the damped system was not positive definite
+        fit.Damping.Reject();
+        return true;
+    }
+
+    gsl::not_null<DTable const*> dtable_;
+};
+
+// Variable projection (Golub-Pereyra) for separable least squares. Most
+// coefficients of an evolved model enter it linearly - the weights of the
+// terms of a top-level sum, see LinearCoefficients - so the model is
+// f = Phi(b) a + g(b) for linear coefficients a and nonlinear ones b. For any
+// b the best a is a linear least-squares problem, solved here in closed form
+// by column-pivoting QR (which also copes with collinear terms), and LM only
+// searches over b, on the projected residual r(b) = f(a*(b), b) - y with
+// Kaufman's approximation of its Jacobian, (I - QQ') df/db. That removes
+// the linear coefficients from the iteration altogether: a model that is
+// linear in all its coefficients is fitted by a single QR solve, and the
+// others need fewer LM iterations, each on a smaller system.
+//
+// The LM loop over b follows TinySolver (see the Tiny backend above). Every
+// trial point needs Phi, i.e. a Jacobian pass, and an accepted one a second
+// pass for df/db at the re-solved a; FunctionEvaluations and
+// JacobianEvaluations count those passes and are always equal. Reverse mode
+// gets every column in one sweep, so a pass restricted to Phi would cost
+// the same; but a trial is a Jacobian pass where Tiny's is residual-only, so
+// fewer iterations only pay off when they save more than that difference.
+// Iterations counts accepted LM steps over b and is 0 for a fully linear
+// model. Every fit starts from the projected linear coefficients, so the
+// linear warm start (SetLinearWarmStart) is always on here.
+template <typename DTable>
+struct VariableProjectionOptimizer final : public OptimizerBase {
+    explicit VariableProjectionOptimizer(gsl::not_null<DTable const*> dtable, gsl::not_null<Problem const*> problem)
+        : OptimizerBase{problem}, dtable_{dtable}
+    {
+    }
+
+    [[nodiscard]] auto Optimize(Operon::RandomGenerator& /*unused*/, Operon::Tree const& tree) const -> FitOutcome final
+    {
+        using Vector = Eigen::Matrix<Operon::Scalar, -1, 1>;
+        using Matrix = Eigen::Matrix<Operon::Scalar, -1, -1>;
+
+        auto const* problem = this->GetProblem();
+        auto const* dataset = problem->GetDataset();
+        auto const range = problem->TrainingRange();
+        auto const n = static_cast<Eigen::Index>(range.Size());
+        auto const target = problem->TargetValues().subspan(range.Start(), range.Size());
+        auto weights = dataset->Weights().value_or(Operon::Span<Operon::Scalar const>{});
+        if (!weights.empty()) {
+            weights = weights.subspan(range.Start(), range.Size());
+            ValidateLMWeights(weights, range.Size());
+        }
+        auto const iterations = static_cast<int>(this->Iterations());
+
+        auto x = tree.GetCoefficients();
+        FitDiagnostics diag;
+        diag.InitialParameters = x;
+        if (x.empty() || iterations == 0) {
+            diag.FinalParameters = x;
+            return detail::MakeFitOutcome(std::move(diag));
+        }
+
+        auto const linear = LinearCoefficients(tree);
+        std::vector<Eigen::Index> nonlinear;
+        for (auto i = 0L, k = 0L; i < std::ssize(x); ++i) {
+            if (k < std::ssize(linear) && std::cmp_equal(linear[k], i)) { ++k; continue; }
+            nonlinear.push_back(i);
+        }
+
+        Operon::Interpreter<Operon::Scalar, DTable> const interpreter{this->GetDispatchTable(), dataset, &tree};
+        Vector r(n);
+        Matrix jac(n, std::ssize(x));
+        Eigen::Map<Vector const> y(target.data(), n);
+
+        // weighted residual and Jacobian at `coeff`, returning 0.5 * ||r||^2
+        auto linearize = [&](std::vector<Operon::Scalar> const& coeff) -> double {
+            interpreter.EvaluateWithJacobian(coeff, range, { r.data(), range.Size() }, { jac.data(), jac.size() });
+            ++diag.FunctionEvaluations;
+            ++diag.JacobianEvaluations;
+            r -= y;
+            ApplyLMResidualWeights(weights, r.data(), range.Size());
+            ApplyLMJacobianWeights(weights, jac.data(), range.Size(), x.size());
+            return 0.5 * static_cast<double>(r.squaredNorm()); // NOLINT
+        };
+
+        auto columns = [&](auto const& indices) -> Matrix {
+            Matrix m(n, std::ssize(indices));
+            for (auto k = 0L; k < m.cols(); ++k) { m.col(k) = jac.col(static_cast<Eigen::Index>(indices[k])); }
+            return m;
+        };
+
+        // replaces the linear coefficients of `coeff` by their least-squares
+        // optimum given the nonlinear ones, from the linearization at
+        // `coeff`; r follows. The model is linear in them, so this is exact.
+        Eigen::ColPivHouseholderQR<Matrix> qr;
+        auto project = [&](std::vector<Operon::Scalar>& coeff) -> double {
+            if (linear.empty()) { return 0.5 * static_cast<double>(r.squaredNorm()); } // NOLINT
+            Matrix const phi = columns(linear);
+            qr.compute(phi);
+            Vector const delta = qr.solve(-r);
+            if (!delta.allFinite()) { return std::numeric_limits<double>::quiet_NaN(); }
+            for (auto k = 0L; k < delta.size(); ++k) { coeff[linear[k]] += delta(k); }
+            r += phi * delta;
+            return 0.5 * static_cast<double>(r.squaredNorm()); // NOLINT
+        };
+
+        // Kaufman's Jacobian of the projected residual: df/db with its
+        // component in the span of Phi removed (qr holds Phi's factorization).
+        // Q is applied through its Householder reflectors rather than formed
+        // as a dense n x n matrix: zeroing the first rank rows of Q^T jb and
+        // mapping back keeps only the part orthogonal to Phi's columns.
+        auto reducedJacobian = [&]() -> Matrix {
+            Matrix jb = columns(nonlinear);
+            if (!linear.empty()) {
+                jb.applyOnTheLeft(qr.householderQ().adjoint());
+                jb.topRows(qr.rank()).setZero();
+                jb.applyOnTheLeft(qr.householderQ());
+            }
+            return jb;
+        };
+
+        diag.InitialCost = static_cast<Operon::Scalar>(linearize(x));
+        auto cost = project(x);
+
+        if (!nonlinear.empty() && std::isfinite(cost)) {
+            using Schedule = detail::TrustRegionSchedule;
+            Eigen::VectorXd scaling;
+            Eigen::MatrixXd hessian;
+            Eigen::VectorXd gradient;
+            // df/db must be taken at the projected linear coefficients
+            auto update = [&]() -> bool {
+                (void)linearize(x);
+                cost = project(x); // refreshes qr; the linear coefficients barely move
+                Eigen::MatrixXd jb = reducedJacobian().template cast<double>();
+                if (scaling.size() == 0) { scaling = (1.0 / (1.0 + jb.colwise().norm().array())).matrix().transpose(); }
+                jb = jb * scaling.asDiagonal();
+                hessian = jb.transpose() * jb;
+                gradient = -(jb.transpose() * r.template cast<double>());
+                return std::isfinite(cost) && hessian.allFinite() && gradient.allFinite();
+            };
+            auto converged = [&]() { return Schedule::Converged(gradient.cwiseAbs().maxCoeff(), cost); };
+
+            auto const p = std::ssize(nonlinear);
+            auto const maxAttempts = iterations * (static_cast<int>(p) + 1);
+            Schedule damping;
+            std::vector<Operon::Scalar> trial;
+
+            if (update() && !converged()) {
+                for (auto attempts = 1; attempts < maxAttempts && diag.Iterations < iterations; ++attempts) {
+                    Eigen::MatrixXd damped = hessian;
+                    for (auto i = 0L; i < p; ++i) { damped(i, i) += damping.Damp(hessian(i, i)); }
+                    Eigen::VectorXd const step = damped.ldlt().solve(gradient);
+                    Eigen::VectorXd const dx = scaling.asDiagonal() * step;
+
+                    double xnorm{0};
+                    for (auto i : nonlinear) { xnorm += static_cast<double>(x[i]) * static_cast<double>(x[i]); }
+                    if (Schedule::StepTooSmall(dx.norm(), std::sqrt(xnorm))) { break; }
+
+                    trial = x;
+                    for (auto i = 0L; i < p; ++i) { trial[nonlinear[i]] += static_cast<Operon::Scalar>(dx(i)); }
+                    (void)linearize(trial);
+                    auto const trialCost = project(trial);
+
+                    auto const costChange = 2 * (cost - trialCost);
+                    auto const modelCostChange = step.dot((2 * gradient) - (hessian * step));
+                    auto const rho = costChange / modelCostChange;
+                    if (rho > 0) {
+                        std::swap(x, trial);
+                        ++diag.Iterations;
+                        auto const previous = cost;
+                        if (!update()) { break; }
+                        if (Schedule::CostChangeTooSmall(costChange) || converged()) { break; }
+                        if (detail::StopEarly(this->Stopping(), previous, cost, gradient.cwiseAbs().maxCoeff())) { break; }
+                        damping.Accept(rho);
+                    } else {
+                        if (Schedule::CostChangeTooSmall(costChange)) { break; }
+                        damping.Reject();
+                    }
+                }
+            }
+        }
+
+        diag.FinalParameters = x;
+        diag.FinalCost = static_cast<Operon::Scalar>(cost);
+        return detail::MakeFitOutcome(std::move(diag));
+    }
+
+    [[nodiscard]] auto LinearWarmStartSupported() const -> bool final { return true; }
+
+    auto GetDispatchTable() const -> DTable const* { return dtable_.get(); }
+
+    [[nodiscard]] auto ComputeLikelihood(Operon::Span<Operon::Scalar const> x, Operon::Span<Operon::Scalar const> y, Operon::Span<Operon::Scalar const> w) const -> Operon::Scalar final
+    {
+        return GaussianLikelihood<Operon::Scalar>::ComputeLikelihood(x, y, w);
+    }
+
+    [[nodiscard]] auto ComputeFisherMatrix(Operon::Span<Operon::Scalar const> pred, Operon::Span<Operon::Scalar const> jac, Operon::Span<Operon::Scalar const> sigma) const -> Eigen::Matrix<Operon::Scalar, -1, -1> final {
+        return GaussianLikelihood<Operon::Scalar>::ComputeFisherMatrix(pred, jac, sigma);
+    }
+
+private:
+    gsl::not_null<DTable const*> dtable_;
+};
+
+// Trust-region Newton with the exact Hessian of the least-squares loss,
+// 0.5 * sum w_i (f_i - y_i)^2:
+//
+//   H = J' W J + sum_i w_i (f_i - y_i) d2f_i/dc2
+//
+// Levenberg-Marquardt keeps only the first (Gauss-Newton) term, which is
+// accurate near a zero-residual fit but not where the model leaves a large
+// residual and its coefficients are strongly coupled (exp(a * X1 + b * X2)
+// and the like); there LM creeps along a curved valley and needs many more
+// iterations. The second-order term comes from BuildHessianDag: the tree,
+// its first and its second derivatives share one dag, and a single
+// EvaluateRoots pass yields f, J and every d2f/dcidcj per row. Trees with
+// an op Deriv() has no rule for (see HasSymbolicDerivatives) fall back to
+// the interpreter's Jacobian and the Gauss-Newton term, i.e. plain LM.
+//
+// Steps solve (H + u D) s = -g, D being the clamped diagonal of J' W J, and
+// u follows TinySolver's schedule driven by the ratio of actual to
+// predicted decrease; an indefinite damped system or a non-descent step is
+// treated as a rejected step. Trial points need f only, from the plain
+// tree. The dag holds p (p + 1) / 2 Hessian columns, so this suits models
+// with a modest number of coefficients; FitDiagnostics::HessianEvaluations
+// counts the passes that paid for them.
+template <typename DTable>
+struct NewtonOptimizer final : public OptimizerBase {
+    explicit NewtonOptimizer(gsl::not_null<DTable const*> dtable, gsl::not_null<Problem const*> problem)
+        : OptimizerBase{problem}, dtable_{dtable}
+    {
+    }
+
+    [[nodiscard]] auto Optimize(Operon::RandomGenerator& /*unused*/, Operon::Tree const& tree) const -> FitOutcome final
+    {
+        using Vector = Eigen::Matrix<Operon::Scalar, -1, 1>;
+        using Matrix = Eigen::Matrix<Operon::Scalar, -1, -1>;
+
+        auto const* problem = this->GetProblem();
+        auto const* dataset = problem->GetDataset();
+        auto const range = problem->TrainingRange();
+        auto const n = static_cast<Eigen::Index>(range.Size());
+        auto const target = problem->TargetValues().subspan(range.Start(), range.Size());
+        auto weights = dataset->Weights().value_or(Operon::Span<Operon::Scalar const>{});
+        if (!weights.empty()) {
+            weights = weights.subspan(range.Start(), range.Size());
+            ValidateLMWeights(weights, range.Size());
+        }
+        auto const iterations = static_cast<int>(this->Iterations());
+
+        auto x = tree.GetCoefficients();
+        FitDiagnostics diag;
+        diag.InitialParameters = x;
+        if (x.empty() || iterations == 0) {
+            diag.FinalParameters = x;
+            return detail::MakeFitOutcome(std::move(diag));
+        }
+
+        auto const p = std::ssize(x);
+        auto const exact = HasSymbolicDerivatives(tree);
+
+        // roots: f, then df/dc_k, then the upper triangle of d2f/dc2
+        std::vector<std::size_t> roots;
+        Operon::Tree dag;
+        if (exact) {
+            auto hdag = BuildHessianDag(tree);
+            roots.reserve(1 + hdag.JacobianRoots.size() + hdag.HessianRoots.size());
+            roots.push_back(hdag.OriginalSize - 1);
+            roots.insert(roots.end(), hdag.JacobianRoots.begin(), hdag.JacobianRoots.end());
+            roots.insert(roots.end(), hdag.HessianRoots.begin(), hdag.HessianRoots.end());
+            dag = Operon::Tree{std::move(hdag.Nodes)};
+        }
+
+        Operon::Interpreter<Operon::Scalar, DTable> const interpreter{this->GetDispatchTable(), dataset, &tree};
+        Operon::Interpreter<Operon::Scalar, DTable> const dagInterpreter{this->GetDispatchTable(), dataset, exact ? &dag : &tree};
+        Eigen::Map<Vector const> y(target.data(), n);
+        Vector r(n);
+        Matrix jac(n, p);
+
+        Eigen::MatrixXd hessian;
+        Eigen::MatrixXd gaussNewton;
+        Eigen::VectorXd gradient;
+        double cost{0};
+
+        // gradient and Hessian of the loss at `coeff`
+        auto linearize = [&](std::vector<Operon::Scalar> const& coeff) -> bool {
+            Eigen::MatrixXd second;
+            if (exact) {
+                Matrix values = dagInterpreter.EvaluateRoots(coeff, range, roots).matrix();
+                values.col(0) -= y;
+                // sqrt(w) on every column: the weighted residual, Jacobian
+                // and sqrt(w_i) d2f_i, whose products give the w_i terms
+                ApplyLMJacobianWeights(weights, values.data(), range.Size(), roots.size());
+                r = values.col(0);
+                jac = values.middleCols(1, p);
+                auto const upper = (values.rightCols(std::ssize(roots) - 1 - p).transpose() * r).template cast<double>().eval();
+                second.resize(p, p);
+                for (auto i = 0L, k = 0L; i < p; ++i) {
+                    for (auto j = i; j < p; ++j, ++k) { second(i, j) = second(j, i) = upper(k); }
+                }
+            } else {
+                interpreter.EvaluateWithJacobian(coeff, range, { r.data(), range.Size() }, { jac.data(), jac.size() });
+                r -= y;
+                ApplyLMResidualWeights(weights, r.data(), range.Size());
+                ApplyLMJacobianWeights(weights, jac.data(), range.Size(), x.size());
+            }
+            ++diag.FunctionEvaluations;
+            ++diag.JacobianEvaluations;
+            if (exact) { ++diag.HessianEvaluations; }
+
+            Eigen::MatrixXd const j = jac.template cast<double>();
+            gaussNewton = j.transpose() * j;
+            hessian = gaussNewton;
+            if (second.size() != 0) { hessian += second; }
+            gradient = j.transpose() * r.template cast<double>();
+            cost = 0.5 * r.template cast<double>().squaredNorm(); // NOLINT
+            return std::isfinite(cost) && hessian.allFinite() && gradient.allFinite();
+        };
+
+        // loss only, for trial points
+        Vector f(n);
+        auto evaluate = [&](std::vector<Operon::Scalar> const& coeff) -> double {
+            interpreter.Evaluate(coeff, range, { f.data(), range.Size() });
+            ++diag.FunctionEvaluations;
+            f -= y;
+            ApplyLMResidualWeights(weights, f.data(), range.Size());
+            return 0.5 * f.template cast<double>().squaredNorm(); // NOLINT
+        };
+
+        auto ok = linearize(x);
+        diag.InitialCost = static_cast<Operon::Scalar>(cost);
+        // the warm start reuses that linearization, redone if it moved x
+        if (ok && this->LinearWarmStart()) {
+            auto const linear = LinearCoefficients(tree);
+            if (detail::ProjectLinearCoefficients(linear, { r.data(), range.Size() }, { jac.data(), static_cast<std::size_t>(jac.size()) }, x)) { ok = linearize(x); }
+        }
+
+        using Schedule = detail::TrustRegionSchedule;
+        auto converged = [&]() { return Schedule::Converged(gradient.cwiseAbs().maxCoeff(), cost); };
+
+        auto const maxAttempts = iterations * (static_cast<int>(p) + 1);
+        Schedule damping;
+        std::vector<Operon::Scalar> trial(x.size());
+        Eigen::LLT<Eigen::MatrixXd> llt;
+
+        if (ok && !converged()) {
+            for (auto attempts = 1; attempts < maxAttempts && diag.Iterations < iterations; ++attempts) {
+                Eigen::MatrixXd damped = hessian;
+                for (auto i = 0L; i < p; ++i) { damped(i, i) += damping.Damp(gaussNewton(i, i)); }
+                llt.compute(damped);
+                Eigen::VectorXd step;
+                double predicted{0};
+                if (llt.info() == Eigen::Success) {
+                    step = llt.solve(-gradient);
+                    predicted = -(gradient.dot(step) + 0.5 * step.dot(hessian * step)); // NOLINT
+                }
+                if (!(predicted > 0)) { // indefinite, or no descent: damp harder
+                    damping.Reject();
+                    continue;
+                }
+
+                auto const xnorm = Eigen::Map<Eigen::Matrix<Operon::Scalar, -1, 1> const>(x.data(), p).template cast<double>().norm();
+                if (Schedule::StepTooSmall(step.norm(), xnorm)) { break; }
+
+                for (auto i = 0L; i < p; ++i) { trial[i] = static_cast<Operon::Scalar>(x[i] + step(i)); }
+                auto const trialCost = evaluate(trial);
+                auto const actual = cost - trialCost;
+                auto const rho = actual / predicted;
+                if (rho > 0) {
+                    std::swap(x, trial);
+                    ++diag.Iterations;
+                    auto const previous = cost;
+                    if (!linearize(x)) { break; }
+                    if (Schedule::CostChangeTooSmall(2 * actual) || converged()) { break; }
+                    if (detail::StopEarly(this->Stopping(), previous, cost, gradient.cwiseAbs().maxCoeff())) { break; }
+                    damping.Accept(rho);
+                } else {
+                    if (Schedule::CostChangeTooSmall(2 * actual)) { break; }
+                    damping.Reject();
+                }
+            }
+        }
+
+        diag.FinalParameters = x;
+        diag.FinalCost = static_cast<Operon::Scalar>(cost);
+        return detail::MakeFitOutcome(std::move(diag));
+    }
+
+    [[nodiscard]] auto LinearWarmStartSupported() const -> bool final { return true; }
+
+    auto GetDispatchTable() const -> DTable const* { return dtable_.get(); }
+
+    [[nodiscard]] auto ComputeLikelihood(Operon::Span<Operon::Scalar const> x, Operon::Span<Operon::Scalar const> y, Operon::Span<Operon::Scalar const> w) const -> Operon::Scalar final
+    {
+        return GaussianLikelihood<Operon::Scalar>::ComputeLikelihood(x, y, w);
+    }
+
+    [[nodiscard]] auto ComputeFisherMatrix(Operon::Span<Operon::Scalar const> pred, Operon::Span<Operon::Scalar const> jac, Operon::Span<Operon::Scalar const> sigma) const -> Eigen::Matrix<Operon::Scalar, -1, -1> final {
+        return GaussianLikelihood<Operon::Scalar>::ComputeFisherMatrix(pred, jac, sigma);
+    }
+
+private:
+    gsl::not_null<DTable const*> dtable_;
+};
+
+// Robust coefficient fitting by iteratively reweighted least squares: fits
+// the coefficients under one of the M-estimator losses of
+// RobustLossFunction, minimizing
+//
+//   sigma^2 * sum_i rho(r_i / sigma)
+//
+// with r_i the sqrt(w)-weighted residual every LM optimizer uses (w being
+// Dataset::Weights) and sigma a robust scale estimate, so that outliers in
+// heavy-tailed targets stop dominating the fit. For small residuals this
+// is the usual 0.5 * sum w_i (f_i - y_i)^2.
+//
+// The work is a few passes of weighted least squares: each pass
+// re-estimates sigma from the current residuals, gives row i the weight
+// w_i * rho'(u_i) / u_i (u_i = r_i / sigma) and runs Levenberg-Marquardt
+// (the thread's TinySolver) from where the previous pass stopped. All
+// passes share one interpreter, cost function and solver - only the weight
+// column the cost function reads changes between them - and split the
+// iteration budget, so later passes, starting near the solution, take few
+// steps and a robust fit costs little more than a plain one. A pass that
+// does not lower the robust cost at its scale is discarded and ends the
+// fit; the reported costs use the scale of the last pass kept. Tukey's
+// loss is not convex and gives far-out rows no weight at all, so it
+// depends more than the others on the starting coefficients.
+//
+// Residuals and Jacobians come from the interpreter (LMCostFunction): the
+// JIT cost function (JitLMCostFunction) is not supported, and the CLI
+// refuses --robust-loss together with --jit.
+template <typename DTable>
+struct RobustLevenbergMarquardtOptimizer final : public OptimizerBase {
+    explicit RobustLevenbergMarquardtOptimizer(gsl::not_null<DTable const*> dtable, gsl::not_null<Problem const*> problem, RobustLossFunction loss = {})
+        : OptimizerBase{problem}, dtable_{dtable}, loss_{loss}
+    {
+    }
+
+    // the most reweighting passes of one fit
+    auto SetReweightings(std::size_t passes) const { reweightings_ = std::max<std::size_t>(passes, 1); }
+    [[nodiscard]] auto Reweightings() const -> std::size_t { return reweightings_; }
+    [[nodiscard]] auto Loss() const -> RobustLossFunction const& { return loss_; }
+
+    [[nodiscard]] auto Optimize(Operon::RandomGenerator& /*unused*/, Operon::Tree const& tree) const -> FitOutcome final
+    {
+        auto const* dtable = this->GetDispatchTable();
+        auto const* problem = this->GetProblem();
+        auto const* dataset = problem->GetDataset();
+        auto const range = problem->TrainingRange();
+        auto const n = range.Size();
+        auto const target = problem->TargetValues();
+        auto const iterations = static_cast<int>(this->Iterations());
+        auto dataWeights = dataset->Weights().value_or(Operon::Span<Operon::Scalar const>{});
+        if (!dataWeights.empty()) {
+            dataWeights = dataWeights.subspan(range.Start(), n);
+            ValidateLMWeights(dataWeights, n);
+        }
+
+        auto x = tree.GetCoefficients();
+        FitDiagnostics diag;
+        diag.InitialParameters = x;
+        if (x.empty() || iterations == 0) {
+            diag.FinalParameters = x;
+            return detail::MakeFitOutcome(std::move(diag));
+        }
+
+        // the weight column read by the cost function, indexed like the
+        // dataset as LMCostFunction expects; only the training rows are used
+        // (and zeroed here), and the column is kept per thread, so it is
+        // allocated once rather than per fit
+        detail::ThreadWorkspace<Buffers> const workspace;
+        auto& [weights, kept, scratch] = *workspace;
+        weights.resize(std::max(weights.size(), range.End()));
+        auto rowWeights = Operon::Span<Operon::Scalar>{weights}.subspan(range.Start(), n);
+        std::ranges::fill(rowWeights, Operon::Scalar{0});
+
+        Operon::Interpreter<Operon::Scalar, DTable> const interpreter{dtable, dataset, &tree};
+        Operon::LMCostFunction cf{gsl::not_null<Operon::InterpreterBase<Operon::Scalar> const*>{&interpreter}, target, range, weights};
+        detail::RowBlockFit<DTable> const rowBlocks{*this, dtable, dataset, &tree};
+        rowBlocks.Bind(cf);
+
+        // sqrt(w) (f - y) at `coeff`, without the robust weights
+        using Residuals = Eigen::Array<Operon::Scalar, -1, 1>;
+        Eigen::Map<Residuals const> const y(target.data() + range.Start(), static_cast<Eigen::Index>(n));
+        auto residuals = [&](std::vector<Operon::Scalar> const& coeff, Residuals& r) {
+            interpreter.Evaluate(coeff, range, { r.data(), n });
+            ++diag.FunctionEvaluations;
+            r -= y;
+            ApplyLMResidualWeights(dataWeights, r.data(), n);
+        };
+        auto robustCost = [&](Residuals const& r, double sigma) {
+            double sum{0};
+            for (auto i = 0L; i < r.size(); ++i) { sum += loss_(r(i) / sigma); }
+            return sigma * sigma * sum;
+        };
+
+        // the noise scale, from the rows that carry weight
+        auto scaleOf = [&](Residuals const& r) {
+            if (dataWeights.empty()) { return RobustLossFunction::Scale({ r.data(), n }, scratch); }
+            kept.clear();
+            for (auto i = 0UL; i < n; ++i) {
+                if (dataWeights[i] > 0) { kept.push_back(r(static_cast<Eigen::Index>(i))); }
+            }
+            return RobustLossFunction::Scale(kept, scratch);
+        };
+
+        Residuals initial(static_cast<Eigen::Index>(n));
+        residuals(x, initial);
+        Residuals current = initial;
+        Residuals next(static_cast<Eigen::Index>(n));
+        auto scale = scaleOf(initial);
+
+        using Solver = ceres::TinySolver<decltype(cf)>;
+        detail::ThreadWorkspace<Solver> const workspace;
+        auto& solver = *workspace;
+        auto const& stopping = this->Stopping();
+        auto const p = std::ssize(x);
+        typename Solver::ParameterVector m(p);
+        std::vector<Operon::Scalar> trial(x.size());
+
+        // a pass improving the robust cost by less than this fraction is the last
+        constexpr double passTolerance{1e-4};
+        auto remaining = iterations;
+        for (auto pass = 0UL; pass < reweightings_ && remaining > 0; ++pass) {
+            // at a fixed scale, the weighted fit cannot raise the robust cost
+            // (for Huber and Cauchy), so a pass is judged at its own scale
+            auto const sigma = scaleOf(current);
+            if (!std::isfinite(sigma) || sigma <= 0) { break; }
+            for (auto i = 0UL; i < n; ++i) {
+                auto const w = dataWeights.empty() ? 1.0 : static_cast<double>(dataWeights[i]);
+                rowWeights[i] = static_cast<Operon::Scalar>(w * loss_.Weight(current(static_cast<Eigen::Index>(i)) / sigma));
+            }
+
+            solver.options = {};
+            solver.summary = {};
+            solver.options.max_num_accepted_steps = remaining;
+            solver.options.max_num_iterations = remaining * (static_cast<int>(p) + 1);
+            solver.options.relative_function_tolerance = static_cast<typename Solver::Scalar>(stopping.RelativeImprovement);
+            solver.options.gradient_tolerance = std::max(solver.options.gradient_tolerance, static_cast<typename Solver::Scalar>(stopping.GradientNorm));
+            m = Eigen::Map<Eigen::Matrix<Operon::Scalar, -1, 1> const>(x.data(), p).template cast<typename Solver::Scalar>();
+            solver.Solve(cf, &m);
+            if (solver.summary.iterations <= 0) { break; }
+            remaining -= solver.summary.iterations;
+            diag.Iterations += solver.summary.iterations;
+
+            for (auto i = 0L; i < p; ++i) { trial[i] = static_cast<Operon::Scalar>(m(i)); }
+            residuals(trial, next);
+            auto const before = robustCost(current, sigma);
+            auto const after = robustCost(next, sigma);
+            if (!(after < before)) { break; }
+            std::swap(x, trial);
+            current.swap(next);
+            scale = sigma;
+            if (before - after < passTolerance * before) { break; }
+        }
+
+        // both costs at the scale of the last pass kept, the initial one if none was
+        auto const scaled = std::isfinite(scale) && scale > 0;
+        auto cost = [&](Residuals const& r) { return scaled ? robustCost(r, scale) : 0.5 * static_cast<double>(r.square().sum()); }; // NOLINT
+        diag.InitialCost = static_cast<Operon::Scalar>(cost(initial));
+        diag.FinalParameters = x;
+        diag.FinalCost = static_cast<Operon::Scalar>(cost(current));
+        diag.FunctionEvaluations += static_cast<int>(cf.ResidualCalls());
+        diag.JacobianEvaluations = static_cast<int>(cf.JacobianCalls());
+        return detail::MakeFitOutcome(std::move(diag));
+    }
+
+    auto GetDispatchTable() const -> DTable const* { return dtable_.get(); }
+
+    [[nodiscard]] auto ComputeLikelihood(Operon::Span<Operon::Scalar const> x, Operon::Span<Operon::Scalar const> y, Operon::Span<Operon::Scalar const> w) const -> Operon::Scalar final
+    {
+        return GaussianLikelihood<Operon::Scalar>::ComputeLikelihood(x, y, w);
+    }
+
+    [[nodiscard]] auto ComputeFisherMatrix(Operon::Span<Operon::Scalar const> pred, Operon::Span<Operon::Scalar const> jac, Operon::Span<Operon::Scalar const> sigma) const -> Eigen::Matrix<Operon::Scalar, -1, -1> final {
+        return GaussianLikelihood<Operon::Scalar>::ComputeFisherMatrix(pred, jac, sigma);
+    }
+
+private:
+    // per-thread scratch of a fit: the weight column and the buffers of
+    // the scale estimate
+    struct Buffers {
+        std::vector<Operon::Scalar> Weights;
+        std::vector<Operon::Scalar> Kept;
+        std::vector<Operon::Scalar> Scratch;
+    };
+
+    gsl::not_null<DTable const*> dtable_;
+    RobustLossFunction loss_;
+    mutable std::size_t reweightings_{5}; // NOLINT
+};
+
 template<typename DTable, Concepts::OptimizerLoss LossFunction = GaussianLoss<Operon::Scalar>>
 struct LBFGSOptimizer final : public OptimizerBase {
     LBFGSOptimizer(gsl::not_null<DTable const*> dtable, gsl::not_null<Problem const*> problem)
@@ -318,6 +1531,8 @@ struct LBFGSOptimizer final : public OptimizerBase {
         return detail::MakeFitOutcome(std::move(diag));
     }
 
+    [[nodiscard]] auto StoppingSupported() const -> bool final { return false; }
+
     auto GetDispatchTable() const -> DTable const* { return dtable_.get(); }
 
     [[nodiscard]] auto ComputeLikelihood(Operon::Span<Operon::Scalar const> x, Operon::Span<Operon::Scalar const> y, Operon::Span<Operon::Scalar const> w) const -> Operon::Scalar override
@@ -347,6 +1562,8 @@ struct SGDOptimizer final : public OptimizerBase {
         , update_{update.Clone(0)}
     { }
 
+    [[nodiscard]] auto StoppingSupported() const -> bool final { return false; }
+
     auto GetDispatchTable() const -> DTable const* { return dtable_.get(); }
 
     [[nodiscard]] auto Optimize(Operon::RandomGenerator& rng, Operon::Tree const& tree) const -> FitOutcome final
@@ -462,8 +1679,11 @@ struct JitLevenbergMarquardtOptimizer : public OptimizerBase {
 
         Operon::Interpreter<Operon::Scalar, DTable> interpreter{dtable, dataset, &tree};
 
-        JIT::CompileMeta const* meta = jitEval_->GetOrCompileJacobian(tree);
-        if (!JacobianOnly && (!meta || !meta->fn)) { meta = jitEval_->GetOrCompile(tree); }
+        // a tree reading a Float64 column is fitted by the interpreter, see
+        // JIT::ReadsFloat64Columns
+        bool const wide = JIT::ReadsFloat64Columns(tree, *dataset);
+        JIT::CompileMeta const* meta = wide ? nullptr : jitEval_->GetOrCompileJacobian(tree);
+        if (!wide && !JacobianOnly && (!meta || !meta->fn)) { meta = jitEval_->GetOrCompile(tree); }
 
         FitDiagnostics diag;
         auto x0 = tree.GetCoefficients();
@@ -482,16 +1702,17 @@ struct JitLevenbergMarquardtOptimizer : public OptimizerBase {
                 target, range, weights};
             Eigen::LevenbergMarquardt<decltype(cf)> lm(cf);
             if (!x0.empty()) {
+                std::optional<double> initialCost;
+                if (this->LinearWarmStart()) { initialCost = detail::ProjectLinearCoefficients(cf, tree, x0); }
                 lm.setMaxfev(std::max<Eigen::Index>(
                     static_cast<Eigen::Index>(iters) * (static_cast<Eigen::Index>(x0.size()) + 1), 1));
                 Eigen::Map<Eigen::Matrix<Operon::Scalar, -1, 1>> m0(x0.data(), std::ssize(x0));
                 Eigen::Matrix<Operon::Scalar, -1, 1> m = m0;
                 Eigen::LevenbergMarquardtSpace::Status status = lm.minimizeInit(m);
                 diag.InitialCost = diag.FinalCost = lm.fnorm() * lm.fnorm() * 0.5;
+                if (initialCost) { diag.InitialCost = static_cast<Operon::Scalar>(*initialCost); }
                 if (status != Eigen::LevenbergMarquardtSpace::ImproperInputParameters) {
-                    do { status = lm.minimizeOneStep(m); }
-                    while (status == Eigen::LevenbergMarquardtSpace::Running
-                            && lm.iterations() < static_cast<Eigen::Index>(iters));
+                    Minimize(lm, m, status, iters);
                 }
                 m0 = m;
             }
@@ -544,15 +1765,16 @@ struct JitLevenbergMarquardtOptimizer : public OptimizerBase {
         lm.setMaxfev(std::max<Eigen::Index>(
             static_cast<Eigen::Index>(iters) * (static_cast<Eigen::Index>(x0.size()) + 1), 1));
 
+        std::optional<double> initialCost;
+        if (this->LinearWarmStart()) { initialCost = detail::ProjectLinearCoefficients(cf, tree, x0); }
         Eigen::Map<Eigen::Matrix<Operon::Scalar, -1, 1>> m0(x0.data(), std::ssize(x0));
         Eigen::Matrix<Operon::Scalar, -1, 1> m = m0;
 
         Eigen::LevenbergMarquardtSpace::Status status = lm.minimizeInit(m);
         diag.InitialCost = diag.FinalCost = lm.fnorm() * lm.fnorm() * 0.5;
+        if (initialCost) { diag.InitialCost = static_cast<Operon::Scalar>(*initialCost); }
         if (status != Eigen::LevenbergMarquardtSpace::ImproperInputParameters) {
-            do { status = lm.minimizeOneStep(m); }
-            while (status == Eigen::LevenbergMarquardtSpace::Running
-                    && lm.iterations() < static_cast<Eigen::Index>(iters));
+            Minimize(lm, m, status, iters);
         }
         m0 = m;
 
@@ -564,6 +1786,8 @@ struct JitLevenbergMarquardtOptimizer : public OptimizerBase {
         return detail::MakeFitOutcome(std::move(diag));
     }
 
+    [[nodiscard]] auto LinearWarmStartSupported() const -> bool final { return true; }
+
     auto GetDispatchTable() const -> DTable const* { return dtable_.get(); }
 
     [[nodiscard]] auto ComputeLikelihood(Operon::Span<Operon::Scalar const> x, Operon::Span<Operon::Scalar const> y, Operon::Span<Operon::Scalar const> w) const -> Operon::Scalar final
@@ -577,6 +1801,24 @@ struct JitLevenbergMarquardtOptimizer : public OptimizerBase {
     }
 
 private:
+    // the Eigen backend's loop, early stopping included (see StoppingRules)
+    template<typename Solver>
+    auto Minimize(Solver& lm, Eigen::Matrix<Operon::Scalar, -1, 1>& m, Eigen::LevenbergMarquardtSpace::Status& status, std::size_t iterations) const -> void
+    {
+        auto const& stopping = this->Stopping();
+        if (stopping.GradientNorm > 0) { lm.setGtol(static_cast<Operon::Scalar>(stopping.GradientNorm)); }
+        do {
+            auto const previous = static_cast<double>(lm.fnorm());
+            status = lm.minimizeOneStep(m);
+            auto const current = static_cast<double>(lm.fnorm());
+            if (status == Eigen::LevenbergMarquardtSpace::Running && current < previous
+                && detail::StopEarly({ .RelativeImprovement = stopping.RelativeImprovement }, previous * previous, current * current, std::numeric_limits<double>::infinity())) {
+                break;
+            }
+        } while (status == Eigen::LevenbergMarquardtSpace::Running
+                  && lm.iterations() < static_cast<Eigen::Index>(iterations));
+    }
+
     gsl::not_null<DTable const*>            dtable_;
     gsl::not_null<JIT::JitEvaluator const*> jitEval_;
 };
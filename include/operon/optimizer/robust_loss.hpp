@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright 2019-2025 Heal Research
+// SPDX-FileCopyrightText: Copyright 2025-present Bogdan Burlacu and contributors
+
+#ifndef OPERON_OPTIMIZER_ROBUST_LOSS_HPP
+#define OPERON_OPTIMIZER_ROBUST_LOSS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <vector>
+
+#include "operon/core/types.hpp"
+
+namespace Operon {
+
+// M-estimator losses for coefficient fitting under heavy-tailed noise. Each
+// is a function rho(u) of a residual u standardized by a robust estimate of
+// the noise scale: quadratic near zero, so a clean fit costs what least
+// squares would, and growing slower than u^2 in the tails - Huber linearly,
+// Cauchy logarithmically and Tukey's biweight not at all past its cutoff,
+// where an outlier stops pulling on the fit altogether.
+enum class RobustLoss : std::uint8_t { Huber, Cauchy, Tukey };
+
+struct RobustLossFunction {
+    RobustLoss Loss{RobustLoss::Huber};
+    // the tuning constant c; 0 picks the usual one, giving 95% of least
+    // squares' efficiency when the noise is Gaussian after all
+    double Tuning{0};
+
+    [[nodiscard]] auto C() const -> double
+    {
+        if (Tuning > 0) { return Tuning; }
+        switch (Loss) {
+        case RobustLoss::Huber: return 1.345;  // NOLINT
+        case RobustLoss::Cauchy: return 2.385; // NOLINT
+        case RobustLoss::Tukey: return 4.685;  // NOLINT
+        }
+        return 1;
+    }
+
+    // rho(u)
+    [[nodiscard]] auto operator()(double u) const -> double
+    {
+        auto const c = C();
+        auto const a = std::abs(u);
+        switch (Loss) {
+        case RobustLoss::Huber:
+            return a <= c ? 0.5 * u * u : c * (a - (0.5 * c)); // NOLINT
+        case RobustLoss::Cauchy:
+            return 0.5 * c * c * std::log1p((u / c) * (u / c)); // NOLINT
+        case RobustLoss::Tukey: {
+            if (a > c) { return c * c / 6; } // NOLINT
+            auto const t = 1 - ((u / c) * (u / c));
+            return c * c / 6 * (1 - (t * t * t)); // NOLINT
+        }
+        }
+        return 0.5 * u * u; // NOLINT
+    }
+
+    // The weight of a residual in iteratively reweighted least squares,
+    // rho'(u) / u: minimizing sum w(u_i) u_i^2 / 2 with the weights held
+    // fixed is one step towards minimizing sum rho(u_i).
+    [[nodiscard]] auto Weight(double u) const -> double
+    {
+        auto const c = C();
+        auto const a = std::abs(u);
+        switch (Loss) {
+        case RobustLoss::Huber:
+            return a <= c ? 1 : c / a;
+        case RobustLoss::Cauchy:
+            return 1 / (1 + ((u / c) * (u / c)));
+        case RobustLoss::Tukey: {
+            if (a >= c) { return 0; }
+            auto const t = 1 - ((u / c) * (u / c));
+            return t * t;
+        }
+        }
+        return 1;
+    }
+
+    // The noise scale behind `residuals`: their median absolute value,
+    // normalized to estimate sigma under Gaussian noise, and unmoved by up to
+    // half of them being outliers. When more than half fit exactly, the
+    // normalized mean absolute value is used instead, and 0 means all do.
+    // NaN if any residual is not finite. `scratch` holds a copy for the
+    // partial sort.
+    static auto Scale(Operon::Span<Operon::Scalar const> residuals, std::vector<Operon::Scalar>& scratch) -> double
+    {
+        if (residuals.empty()) { return 0; }
+        if (!std::ranges::all_of(residuals, [](auto r) { return std::isfinite(r); })) { return std::numeric_limits<double>::quiet_NaN(); }
+        scratch.resize(residuals.size());
+        std::ranges::transform(residuals, scratch.begin(), [](auto r) { return std::abs(r); });
+        auto const mid = scratch.begin() + std::ssize(scratch) / 2;
+        std::ranges::nth_element(scratch, mid);
+        constexpr auto madToSigma{1.4826};
+        if (*mid > 0) { return madToSigma * *mid; }
+        double sum{0};
+        for (auto const a : scratch) { sum += a; }
+        return std::sqrt(std::numbers::pi / 2) * sum / static_cast<double>(scratch.size());
+    }
+};
+} // namespace Operon
+
+#endif
@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright 2019-2025 Heal Research
+// SPDX-FileCopyrightText: Copyright 2025-present Bogdan Burlacu and contributors
+#ifndef OPERON_SOLVER_BATCH_CHOLESKY_HPP
+#define OPERON_SOLVER_BATCH_CHOLESKY_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Operon {
+
+// Solves `batch` independent symmetric positive definite systems A_b x_b = y_b
+// of the same size p in place, with Cholesky factorization. The systems are
+// stored structure-of-arrays - element (i, j) of system b is
+// a[((i * p) + j) * batch + b], element i of its right-hand side
+// y[(i * batch) + b] - so every loop below runs innermost over the batch,
+// with unit stride and no cross-lane dependencies, and vectorizes across
+// systems. That is what makes the many tiny solves of a batched
+// Levenberg-Marquardt iteration cheap: a single 5x5 factorization is too
+// small for any SIMD width, but 16 of them side by side fill the lanes.
+//
+// Only the lower triangle of A is read; it is overwritten by the factor L,
+// and y by the solution. ok[b] is cleared for systems that are not
+// numerically positive definite (their solution is garbage); it is left
+// untouched otherwise, so the caller initializes it.
+template<typename T>
+auto BatchCholeskySolve(std::size_t p, std::size_t batch, std::span<T> a, std::span<T> y, std::span<std::uint8_t> ok) -> void
+{
+    auto at = [&](std::size_t i, std::size_t j) { return a.data() + (((i * p) + j) * batch); };
+    auto rhs = [&](std::size_t i) { return y.data() + (i * batch); };
+
+    // factorization, column by column (left-looking)
+    for (auto j = 0UL; j < p; ++j) {
+        T* ajj = at(j, j);
+        for (auto k = 0UL; k < j; ++k) {
+            T const* ljk = at(j, k);
+            for (auto b = 0UL; b < batch; ++b) { ajj[b] -= ljk[b] * ljk[b]; }
+        }
+        for (auto b = 0UL; b < batch; ++b) {
+            auto const d = ajj[b];
+            ok[b] = static_cast<std::uint8_t>(ok[b] & static_cast<std::uint8_t>(d > T{0} && std::isfinite(d)));
+            ajj[b] = d > T{0} ? std::sqrt(d) : T{1};
+        }
+        for (auto i = j + 1; i < p; ++i) {
+            T* aij = at(i, j);
+            for (auto k = 0UL; k < j; ++k) {
+                T const* lik = at(i, k);
+                T const* ljk = at(j, k);
+                for (auto b = 0UL; b < batch; ++b) { aij[b] -= lik[b] * ljk[b]; }
+            }
+            for (auto b = 0UL; b < batch; ++b) { aij[b] /= ajj[b]; }
+        }
+    }
+
+    // forward substitution L z = y
+    for (auto i = 0UL; i < p; ++i) {
+        T* yi = rhs(i);
+        for (auto k = 0UL; k < i; ++k) {
+            T const* lik = at(i, k);
+            T const* yk = rhs(k);
+            for (auto b = 0UL; b < batch; ++b) { yi[b] -= lik[b] * yk[b]; }
+        }
+        T const* lii = at(i, i);
+        for (auto b = 0UL; b < batch; ++b) { yi[b] /= lii[b]; }
+    }
+
+    // back substitution L' x = z
+    for (auto i = p; i-- > 0;) {
+        T* yi = rhs(i);
+        for (auto k = i + 1; k < p; ++k) {
+            T const* lki = at(k, i);
+            T const* yk = rhs(k);
+            for (auto b = 0UL; b < batch; ++b) { yi[b] -= lki[b] * yk[b]; }
+        }
+        T const* lii = at(i, i);
+        for (auto b = 0UL; b < batch; ++b) { yi[b] /= lii[b]; }
+    }
+}
+
+} // namespace Operon
+
+#endif
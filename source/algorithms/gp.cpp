@@ -17,6 +17,7 @@
 // NOLINTEND(misc-include-cleaner)
 
 #include "operon/algorithms/gp.hpp"
+#include "operon/algorithms/numa_pinning.hpp"
 #include "operon/algorithms/phase_timer.hpp"
 #include "operon/core/contracts.hpp" // for ENSURE
 #include "operon/core/types.hpp"
@@ -120,8 +121,11 @@ auto GeneticProgrammingAlgorithm::Run(tf::Executor& executor, Operon::RandomGene
                 // eval) so that an evaluator snapshotting the population in
                 // Prepare() (e.g. DiversityEvaluator) sees post-optimization
                 // genotypes rather than the raw initial ones.
-                auto localSearch = subflow.for_each_index(size_t { 0 }, parents.size(), size_t { 1 }, [&](size_t i) -> void {
-                                       originalCoeffs[i] = LocalSearch(rngs[i], parents[i], *evaluator, generator->Optimizer(), config.LocalSearchProbability, config.LamarckianProbability);
+                // in blocks, so a batched optimizer can solve a block in lockstep
+                auto localSearch = subflow.for_each_index(size_t { 0 }, parents.size(), LocalSearchBlockSize, [&](size_t i) -> void {
+                                       auto const m = std::min(LocalSearchBlockSize, parents.size() - i);
+                                       auto block = LocalSearchBatch(Operon::Span<Operon::RandomGenerator>(rngs).subspan(i, m), parents.subspan(i, m), *evaluator, generator->Optimizer(), config.LocalSearchProbability, config.LamarckianProbability);
+                                       std::ranges::move(block, originalCoeffs.begin() + static_cast<std::ptrdiff_t>(i));
                                     })
                                 .name("local search on initial population");
                 auto restoreCoeffs = subflow.for_each_index(size_t { 0 }, parents.size(), size_t { 1 }, [&](size_t i) -> void {
@@ -149,14 +153,25 @@ auto GeneticProgrammingAlgorithm::Run(tf::Executor& executor, Operon::RandomGene
                                         // this the cache would stamp entries with the prior
                                         // generation's number (see incrementGeneration).
                                         if (auto* cache = config.Cache) { cache->SetGeneration(Generation() + 1); }
+                                        if (auto* semantic = config.Semantic) { semantic->SetGeneration(Generation() + 1); }
                                     }).name("prepare generator");
-            auto generateOffspring = subflow.for_each_index(size_t { 0 }, offspring.size(), size_t { 1 }, [&](size_t i) -> void {
+            // in blocks when the optimizer fits a batch in lockstep, see
+            // OffspringGeneratorBase::GenerateBatch; slots a generator left
+            // empty are retried one at a time
+            auto const* optimizer = generator->Optimizer();
+            auto const block = optimizer != nullptr && optimizer->Batched() ? LocalSearchBlockSize : size_t { 1 };
+            auto generateOffspring = subflow.for_each_index(size_t { 0 }, offspring.size(), block, [&, block](size_t i) -> void {
                                                 slots[executor.this_worker_id()].resize(trainSize);
                                                 auto buf = Operon::Span<Operon::Scalar>(slots[executor.this_worker_id()]);
-                                                while (!stop()) {
-                                                    if (auto result = (*generator)(rngs[i], config.CrossoverProbability, config.MutationProbability, config.LocalSearchProbability, config.LamarckianProbability, buf); result.has_value()) {
-                                                        offspring[i] = std::move(result.value());
-                                                        return;
+                                                auto const m = std::min(block, offspring.size() - i);
+                                                if (stop()) { return; }
+                                                auto const filled = generator->GenerateBatch(Operon::Span<Operon::RandomGenerator>(rngs).subspan(i, m), config.CrossoverProbability, config.MutationProbability, config.LocalSearchProbability, config.LamarckianProbability, buf, offspring.subspan(i, m));
+                                                for (auto k = 0UL; k < m; ++k) {
+                                                    while (filled[k] == 0 && !stop()) {
+                                                        if (auto result = (*generator)(rngs[i + k], config.CrossoverProbability, config.MutationProbability, config.LocalSearchProbability, config.LamarckianProbability, buf); result.has_value()) {
+                                                            offspring[i + k] = std::move(result.value());
+                                                            break;
+                                                        }
                                                     }
                                                 }
                                             })
@@ -209,7 +224,10 @@ auto GeneticProgrammingAlgorithm::Run(Operon::RandomGenerator& random, Operon::R
     if (threads == 0) {
         threads = std::thread::hardware_concurrency();
     }
-    tf::Executor executor(threads);
+    // pin workers per NUMA node when the dataset carries node-local
+    // replicas, otherwise the far socket's workers would still read remotely
+    auto const replicated = GetProblem()->GetDataset()->ReplicaCount() > 0;
+    tf::Executor executor(threads, replicated ? NumaWorkerPinning::Make(threads) : nullptr);
     Run(executor, random, std::move(report), warmStart);
 }
 } // namespace Operon
@@ -14,6 +14,7 @@
 #include <vector> // for vector, vector::size_type
 
 #include "operon/algorithms/nsga2.hpp"
+#include "operon/algorithms/numa_pinning.hpp"
 #include "operon/algorithms/phase_timer.hpp"
 #include "operon/core/contracts.hpp" // for ENSURE
 #include "operon/core/problem.hpp" // for Problem
@@ -224,8 +225,11 @@ auto NSGA2::Run(tf::Executor& executor, Operon::RandomGenerator& random, Operon:
                 // eval) so that an evaluator snapshotting the population in
                 // Prepare() (e.g. DiversityEvaluator) sees post-optimization
                 // genotypes rather than the raw initial ones.
-                auto localSearch = subflow.for_each_index(size_t { 0 }, parents.size(), size_t { 1 }, [&](size_t i) -> void {
-                                       originalCoeffs[i] = LocalSearch(rngs[i], parents[i], *evaluator, generator->Optimizer(), config.LocalSearchProbability, config.LamarckianProbability);
+                // in blocks, so a batched optimizer can solve a block in lockstep
+                auto localSearch = subflow.for_each_index(size_t { 0 }, parents.size(), LocalSearchBlockSize, [&](size_t i) -> void {
+                                       auto const m = std::min(LocalSearchBlockSize, parents.size() - i);
+                                       auto block = LocalSearchBatch(Operon::Span<Operon::RandomGenerator>(rngs).subspan(i, m), parents.subspan(i, m), *evaluator, generator->Optimizer(), config.LocalSearchProbability, config.LamarckianProbability);
+                                       std::ranges::move(block, originalCoeffs.begin() + static_cast<std::ptrdiff_t>(i));
                                     })
                                 .name("local search on initial population");
                 auto restoreCoeffs = subflow.for_each_index(size_t { 0 }, parents.size(), size_t { 1 }, [&](size_t i) -> void {
@@ -249,17 +253,28 @@ auto NSGA2::Run(tf::Executor& executor, Operon::RandomGenerator& random, Operon:
                                         // this the cache would stamp entries with the prior
                                         // generation's number (see incrementGeneration).
                                         if (auto* cache = config.Cache) { cache->SetGeneration(Generation() + 1); }
+                                        if (auto* semantic = config.Semantic) { semantic->SetGeneration(Generation() + 1); }
                                     }).name("prepare generator");
-            auto generateOffspring = subflow.for_each_index(size_t { 0 }, offspring.size(), size_t { 1 }, [&](size_t i) -> void {
+            // in blocks when the optimizer fits a batch in lockstep, see
+            // OffspringGeneratorBase::GenerateBatch; slots a generator left
+            // empty are retried one at a time
+            auto const* optimizer = generator->Optimizer();
+            auto const block = optimizer != nullptr && optimizer->Batched() ? LocalSearchBlockSize : size_t { 1 };
+            auto generateOffspring = subflow.for_each_index(size_t { 0 }, offspring.size(), block, [&, block](size_t i) -> void {
                                                 slots[executor.this_worker_id()].resize(trainSize);
                                                 auto buf = Operon::Span<Operon::Scalar>(slots[executor.this_worker_id()]);
-                                                while (!stop()) {
-                                                    auto result = (*generator)(rngs[i], config.CrossoverProbability, config.MutationProbability, config.LocalSearchProbability, config.LamarckianProbability, buf);
-                                                    if (result) {
-                                                        offspring[i] = std::move(*result);
-                                                        ENSURE(offspring[i].Genotype.Length() > 0);
-                                                        return;
+                                                auto const m = std::min(block, offspring.size() - i);
+                                                if (stop()) { return; }
+                                                auto filled = generator->GenerateBatch(Operon::Span<Operon::RandomGenerator>(rngs).subspan(i, m), config.CrossoverProbability, config.MutationProbability, config.LocalSearchProbability, config.LamarckianProbability, buf, offspring.subspan(i, m));
+                                                for (auto k = 0UL; k < m; ++k) {
+                                                    while (filled[k] == 0 && !stop()) {
+                                                        auto result = (*generator)(rngs[i + k], config.CrossoverProbability, config.MutationProbability, config.LocalSearchProbability, config.LamarckianProbability, buf);
+                                                        if (result) {
+                                                            offspring[i + k] = std::move(*result);
+                                                            filled[k] = 1;
+                                                        }
                                                     }
+                                                    if (filled[k] != 0) { ENSURE(offspring[i + k].Genotype.Length() > 0); }
                                                 }
                                             })
                                          .name("generate offspring");
@@ -322,7 +337,10 @@ auto NSGA2::Run(Operon::RandomGenerator& random, Operon::ReportCallback report,
     if (threads == 0U) {
         threads = std::thread::hardware_concurrency();
     }
-    tf::Executor executor(threads);
+    // pin workers per NUMA node when the dataset carries node-local
+    // replicas, otherwise the far socket's workers would still read remotely
+    auto const replicated = GetProblem()->GetDataset()->ReplicaCount() > 0;
+    tf::Executor executor(threads, replicated ? NumaWorkerPinning::Make(threads) : nullptr);
     Run(executor, random, std::move(report), warmStart);
 }
 } // namespace Operon
@@ -4,15 +4,21 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <numeric>
+#include <optional>
 #include <stdexcept>
+#include <thread>
+#include <type_traits>
 
 #include <fast_float/fast_float.h>
 #include <fmt/format.h>
 #include <parser.hpp>
+#include <taskflow/algorithm/for_each.hpp> // NOLINT(misc-include-cleaner)
 #include <vstat/vstat.hpp>
 
 #include "operon/core/dataset.hpp"
+#include "operon/core/numa.hpp"
 #include "operon/core/types.hpp"
 #include "operon/hash/hash.hpp"
 
@@ -57,63 +63,126 @@ namespace {
     {
         return s.to_mdspan();
     }
-} // namespace
 
-auto Dataset::ReadCsv(std::string const& path, bool hasHeader) -> std::pair<Dataset::Storage, int>
-{
-    std::ifstream f(path);
-    aria::csv::CsvParser parser(f);
-
-    auto nrow = static_cast<int>(std::count(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>(), '\n'));
-    f.clear();
-    f.seekg(0);
+    // Parses the CSV into a flat column-major buffer (buf[col * nrow + row])
+    // of T, with variables named from the header (or default names). T is
+    // Scalar for the regular loader and double for ReadFloat64, so each
+    // field is rounded exactly once.
+    template<typename T>
+    auto ReadCsvColumns(std::string const& path, bool hasHeader) -> std::tuple<std::vector<T>, int, Dataset::Variables>
+    {
+        std::ifstream f(path);
+        aria::csv::CsvParser parser(f);
+
+        auto nrow = static_cast<int>(std::count(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>(), '\n'));
+        f.clear();
+        f.seekg(0);
+
+        auto ncol { 0 };
+        Dataset::Variables variables;
+
+        if (hasHeader) {
+            --nrow;
+            for (auto const& row : parser) {
+                for (auto const& field : row) {
+                    Hasher const hash;
+                    auto h = hash(field);
+                    variables.insert({ h, { .Name = field, .Hash = h, .Index = ncol++ } });
+                }
+                break;
+            }
+        }
 
-    auto ncol { 0 };
+        // flat column-major buffer: buf[col * nrow + row]
+        std::vector<T> buf;
+        if (ncol > 0) {
+            buf.resize(static_cast<size_t>(nrow) * ncol);
+        }
+        std::vector<T> rowBuf;
+        auto rowIdx = 0;
 
-    if (hasHeader) {
-        --nrow;
         for (auto const& row : parser) {
+            rowBuf.clear();
             for (auto const& field : row) {
-                Hasher const hash;
-                auto h = hash(field);
-                variables_.insert({ h, { .Name = field, .Hash = h, .Index = ncol++ } });
+                T v { 0 };
+                auto const status = fast_float::from_chars(field.data(), field.data() + field.size(), v);
+                if (status.ec != std::errc()) {
+                    throw std::runtime_error(fmt::format("failed to parse field at line {}\n", rowIdx));
+                }
+                rowBuf.push_back(v);
             }
-            break;
+
+            if (ncol == 0) {
+                ENSURE(!hasHeader);
+                ncol = static_cast<int>(rowBuf.size());
+                buf.resize(static_cast<size_t>(nrow) * ncol);
+                variables = DefaultVariables(ncol);
+            }
+
+            for (auto j = 0; j < ncol; ++j) {
+                buf[(static_cast<size_t>(j) * nrow) + rowIdx] = rowBuf[j];
+            }
+            ++rowIdx;
         }
-    }
 
-    // flat column-major buffer: buf[col * nrow + row]
-    std::vector<Operon::Scalar> buf;
-    if (ncol > 0) {
-        buf.resize(static_cast<size_t>(nrow) * ncol);
+        return { std::move(buf), nrow, std::move(variables) };
     }
-    std::vector<Operon::Scalar> rowBuf;
-    auto rowIdx = 0;
 
-    for (auto const& row : parser) {
-        rowBuf.clear();
-        for (auto const& field : row) {
-            Operon::Scalar v { 0 };
-            auto const status = fast_float::from_chars(field.data(), field.data() + field.size(), v);
-            if (status.ec != std::errc()) {
-                throw std::runtime_error(fmt::format("failed to parse field at line {}\n", rowIdx));
+    // Statistics of `values` (Scalar, or the binary64 copy of a Float64
+    // column), weighted by `w` when it is not empty; see ColumnStatistics
+    // for the rows that are skipped.
+    template<typename T>
+    auto ColumnStatisticsOf(Span<T const> values, Span<Scalar const> w) -> ColumnStatistics
+    {
+        auto const nan = std::numeric_limits<double>::quiet_NaN();
+        ColumnStatistics stats { .Mean = nan, .Variance = nan, .Min = nan, .Max = nan, .Count = 0 };
+
+        if (w.empty() && std::ranges::all_of(values, [](auto v) { return std::isfinite(v); })) {
+            // common case: vstat's vectorized pass plus one minmax sweep
+            if (!values.empty()) {
+                auto const acc = vstat::univariate::accumulate<T>(values.begin(), values.end());
+                auto const [min, max] = std::ranges::minmax(values);
+                stats = { .Mean = acc.mean, .Variance = acc.variance, .Min = min, .Max = max, .Count = values.size() };
             }
-            rowBuf.push_back(v);
+            return stats;
         }
 
-        if (ncol == 0) {
-            ENSURE(!hasHeader);
-            ncol = static_cast<int>(rowBuf.size());
-            buf.resize(static_cast<size_t>(nrow) * ncol);
-            variables_ = DefaultVariables(ncol);
+        // West's weighted incremental update, skipping rows with a
+        // non-finite value or a non-finite/zero weight
+        double sumWeights { 0 };
+        double mean { 0 };
+        double m2 { 0 };
+        auto min = std::numeric_limits<double>::infinity();
+        auto max = -std::numeric_limits<double>::infinity();
+        for (auto k = 0UL; k < values.size(); ++k) {
+            auto const y = static_cast<double>(values[k]);
+            auto const wk = w.empty() ? 1.0 : static_cast<double>(w[k]);
+            if (!std::isfinite(y) || !std::isfinite(wk) || wk == 0.0) { continue; }
+            auto const next = sumWeights + wk;
+            auto const delta = y - mean;
+            auto const r = delta * wk / next;
+            mean += r;
+            m2 += sumWeights * delta * r;
+            sumWeights = next;
+            min = std::min(min, y);
+            max = std::max(max, y);
+            ++stats.Count;
         }
-
-        for (auto j = 0; j < ncol; ++j) {
-            buf[(static_cast<size_t>(j) * nrow) + rowIdx] = rowBuf[j];
+        if (stats.Count > 0) {
+            stats.Mean = mean;
+            stats.Variance = sumWeights > 0 ? m2 / sumWeights : 0.0;
+            stats.Min = min;
+            stats.Max = max;
         }
-        ++rowIdx;
+        return stats;
     }
+} // namespace
 
+auto Dataset::ReadCsv(std::string const& path, bool hasHeader) -> std::pair<Dataset::Storage, int>
+{
+    auto [buf, nrow, vars] = ReadCsvColumns<Scalar>(path, hasHeader);
+    variables_ = std::move(vars);
+    auto const ncol = static_cast<int>(variables_.size());
     auto const pr = (nrow + 7) & ~7; // NOLINT(hicpp-signed-bitwise) padded rows
     Storage s(pr, ncol);
     auto* dst = s.container().data();
@@ -131,6 +200,102 @@ Dataset::Dataset(std::string const& path, bool hasHeader)
     view_ = MakeView(storage_);
 }
 
+auto Dataset::FromFloat64(std::vector<std::string> const& vars, std::vector<std::vector<double>> const& vals, double tolerance) -> std::pair<Dataset, std::vector<ColumnPrecisionReport>>
+{
+    if (vals.empty()) {
+        throw std::runtime_error("FromFloat64: no columns\n");
+    }
+    auto const nrow = static_cast<int>(vals.front().size());
+    std::vector<double> columns;
+    columns.reserve(vals.size() * vals.front().size());
+    for (auto const& v : vals) {
+        EXPECT(std::ssize(v) == nrow);
+        columns.insert(columns.end(), v.begin(), v.end());
+    }
+    return FromFloat64Columns(VariablesFromNames(vars), columns, nrow, tolerance);
+}
+
+auto Dataset::ReadFloat64(std::string const& path, bool hasHeader, double tolerance) -> std::pair<Dataset, std::vector<ColumnPrecisionReport>>
+{
+    auto [columns, nrow, vars] = ReadCsvColumns<double>(path, hasHeader);
+    return FromFloat64Columns(std::move(vars), columns, nrow, tolerance);
+}
+
+auto Dataset::FromFloat64Columns(Variables vars, std::vector<double> const& columns, int rows, double tolerance) -> std::pair<Dataset, std::vector<ColumnPrecisionReport>>
+{
+    auto const ncol = std::ssize(vars);
+    if (ncol == 0 || rows == 0) {
+        throw std::runtime_error("FromFloat64: empty dataset\n");
+    }
+    std::vector<std::vector<Scalar>> narrow(static_cast<std::size_t>(ncol));
+    for (auto j = 0; j < ncol; ++j) {
+        auto const* col = columns.data() + (static_cast<ptrdiff_t>(j) * rows);
+        narrow[j].assign(col, col + rows);
+    }
+    Dataset ds(narrow);
+    ds.variables_ = std::move(vars);
+    auto reports = ds.AdoptFloat64(columns, rows, tolerance);
+    return { std::move(ds), std::move(reports) };
+}
+
+// Audits the Scalar narrowing of each float64 source column against the
+// values already in storage_ and keeps a Float64 copy of the columns that
+// fail `tolerance` (see FromFloat64). In double builds narrowing is exact,
+// so every column stays native.
+auto Dataset::AdoptFloat64(std::vector<double> const& columns, int rows, double tolerance) -> std::vector<ColumnPrecisionReport>
+{
+    auto const stride = static_cast<ptrdiff_t>(view_.extent(0)); // paddedRows
+    std::vector<ColumnPrecisionReport> reports;
+    reports.reserve(Cols<std::size_t>());
+    for (auto const& [hash, var] : variables_.values()) {
+        auto const* src = columns.data() + (static_cast<ptrdiff_t>(var.Index) * rows);
+        auto const* col = ColSpan(static_cast<int>(var.Index)).data();
+        ColumnPrecisionReport report { .Hash = hash, .Precision = ColumnPrecision::Float32 };
+        auto min = std::numeric_limits<double>::infinity();
+        auto max = -std::numeric_limits<double>::infinity();
+        double ssr { 0 };
+        std::size_t compared { 0 };
+        for (auto k = 0; k < rows; ++k) {
+            auto const x = src[k];
+            auto const y = static_cast<double>(col[k]);
+            if (!std::isfinite(x)) { continue; }
+            min = std::min(min, x);
+            max = std::max(max, x);
+            if (!std::isfinite(y)) {
+                ++report.Overflow;
+                continue;
+            }
+            auto const err = std::abs(x - y);
+            report.MaxAbsError = std::max(report.MaxAbsError, err);
+            if (x != 0) {
+                report.MaxRelError = std::max(report.MaxRelError, err / std::abs(x));
+            }
+            ssr += err * err;
+            ++compared;
+        }
+        if (compared > 0) {
+            report.RootMeanSquaredError = std::sqrt(ssr / static_cast<double>(compared));
+        }
+        auto const spread = max - min;
+        report.RangeRelError = spread > 0 ? report.MaxAbsError / spread
+                             : report.MaxAbsError > 0 ? std::numeric_limits<double>::infinity() : 0.0;
+
+        if (report.Overflow > 0 || report.RangeRelError > tolerance) {
+            if (compressed_.empty()) {
+                compressed_.resize(Cols<std::size_t>());
+            }
+            auto& c = compressed_[var.Index];
+            c.Precision = ColumnPrecision::Float64;
+            c.Wide.assign(static_cast<std::size_t>(stride), 0.0); // padded tail stays zero
+            std::copy_n(src, rows, c.Wide.data());
+            report.Precision = ColumnPrecision::Float64;
+        }
+        reports.push_back(report);
+    }
+    std::ranges::sort(reports, std::less{}, [&](auto const& r) { return variables_.find(r.Hash)->second.Index; });
+    return reports;
+}
+
 Dataset::Dataset(std::vector<std::string> const& vars, std::vector<std::vector<Scalar>> const& vals)
     : variables_(VariablesFromNames(vars))
     , storage_(StorageFromCols(vals))
@@ -179,6 +344,8 @@ Dataset::Dataset(Dataset const& rhs)
     : variables_(rhs.variables_)
     , rows_(rhs.rows_)
     , weights_(rhs.weights_)
+    , compressed_(rhs.compressed_)
+    , statistics_(rhs.statistics_)
 {
     auto const pr = static_cast<ptrdiff_t>(rhs.view_.extent(0)); // paddedRows
     auto const ncols = static_cast<int>(rhs.view_.extent(1));
@@ -193,6 +360,9 @@ Dataset::Dataset(Dataset&& rhs) noexcept
     , view_(rhs.view_)
     , rows_(rhs.rows_)
     , weights_(std::move(rhs.weights_))
+    , compressed_(std::move(rhs.compressed_))
+    , statistics_(std::move(rhs.statistics_))
+    , replicas_(std::move(rhs.replicas_))
 {
 }
 
@@ -204,6 +374,9 @@ auto Dataset::operator=(Dataset&& rhs) noexcept -> Dataset&
         view_ = rhs.view_;
         rows_ = rhs.rows_;
         weights_ = std::move(rhs.weights_);
+        compressed_ = std::move(rhs.compressed_);
+        statistics_ = std::move(rhs.statistics_);
+        replicas_ = std::move(rhs.replicas_);
     }
     return *this;
 }
@@ -215,6 +388,9 @@ void Dataset::Swap(Dataset& rhs) noexcept
     std::swap(view_, rhs.view_);
     std::swap(rows_, rhs.rows_);
     std::swap(weights_, rhs.weights_);
+    std::swap(compressed_, rhs.compressed_);
+    statistics_.Swap(rhs.statistics_);
+    std::swap(replicas_, rhs.replicas_);
 }
 
 auto Dataset::operator==(Dataset const& rhs) const noexcept -> bool
@@ -288,12 +464,15 @@ auto Dataset::GetValues(Operon::Hash hash) const noexcept -> Span<Scalar const>
         fmt::print(stderr, "GetValues: cannot find variable with hash value {}", hash);
         std::abort();
     }
-    return ColSpan(static_cast<int>(it->second.Index));
+    return GetValues(static_cast<int64_t>(it->second.Index));
 }
 
 auto Dataset::GetValues(int64_t index) const noexcept -> Span<Scalar const>
 {
-    return ColSpan(static_cast<int>(index)); // NOLINT(cppcoreguidelines-narrowing-conversions)
+    if (replicas_.empty()) {
+        return ColSpan(static_cast<int>(index)); // NOLINT(cppcoreguidelines-narrowing-conversions)
+    }
+    return { GetPaddedValues(index), static_cast<size_t>(rows_) };
 }
 
 auto Dataset::GetVariable(std::string const& name) const noexcept -> tl::expected<Variable, DatasetError>
@@ -329,6 +508,7 @@ void Dataset::SetWeights(Span<Scalar const> w)
     // placeholder values (see GaussianLoss's/LMCostFunction's ctors, which
     // validate only the in-range slice they will actually use).
     weights_.emplace(w.begin(), w.end());
+    statistics_.InvalidateWeighted();
 }
 
 auto Dataset::Weights() const noexcept -> std::optional<Span<Scalar const>>
@@ -339,7 +519,7 @@ auto Dataset::Weights() const noexcept -> std::optional<Span<Scalar const>>
     return Span<Scalar const> { weights_->data(), weights_->size() };
 }
 
-void Dataset::Shuffle(Operon::RandomGenerator& random)
+void Dataset::Shuffle(Operon::RandomGenerator& random, std::size_t nthread)
 {
     if (IsView()) {
         throw std::runtime_error("Cannot shuffle a non-owning dataset.\n");
@@ -347,14 +527,7 @@ void Dataset::Shuffle(Operon::RandomGenerator& random)
     std::vector<int> perm(Rows());
     std::iota(perm.begin(), perm.end(), 0);
     std::shuffle(perm.begin(), perm.end(), random);
-    PermuteRows(perm);
-    if (weights_) {
-        Vector<Scalar> tmp(weights_->size());
-        for (auto i = 0; i < Rows(); ++i) {
-            tmp[i] = (*weights_)[perm[i]];
-        }
-        *weights_ = std::move(tmp);
-    }
+    PermuteRows(perm, nthread);
 }
 
 void Dataset::Normalize(size_t i, Range range)
@@ -365,12 +538,22 @@ void Dataset::Normalize(size_t i, Range range)
     EXPECT(range.Start() + range.Size() <= static_cast<size_t>(Rows()));
     auto const stride = static_cast<ptrdiff_t>(view_.extent(0)); // paddedRows
     auto* col = storage_.container().data() + (static_cast<ptrdiff_t>(i) * stride); // NOLINT(bugprone-implicit-widening-of-multiplication-result)
-    auto* begin = col + range.Start();
-    auto* end = begin + range.Size();
-    auto [minIt, maxIt] = std::minmax_element(begin, end);
-    auto const min = *minIt;
-    auto const rng = *maxIt - min;
-    std::transform(col, col + Rows(), col, [min, rng](auto v) -> Scalar { return (v - min) / rng; });
+    // the statistics skip non-finite values and, for a Float64 column, are
+    // those of the exact values
+    auto const stats = GetColumnStatistics(static_cast<int64_t>(i), range);
+    if (auto* wide = WideColumn(static_cast<int64_t>(i)); wide != nullptr) {
+        // Float64 column: transform the exact values, Recompress narrows
+        auto const min = stats.Min;
+        auto const rng = stats.Max - min;
+        std::transform(wide, wide + Rows(), wide, [min, rng](auto v) -> double { return (v - min) / rng; });
+    } else {
+        auto const min = static_cast<Scalar>(stats.Min);
+        auto const rng = static_cast<Scalar>(stats.Max) - min;
+        std::transform(col, col + Rows(), col, [min, rng](auto v) -> Scalar { return (v - min) / rng; });
+    }
+    statistics_.Invalidate(static_cast<int64_t>(i));
+    Recompress(static_cast<int64_t>(i));
+    SyncReplicas(static_cast<int64_t>(i));
 }
 
 void Dataset::Standardize(size_t i, Range range)
@@ -381,11 +564,19 @@ void Dataset::Standardize(size_t i, Range range)
     EXPECT(range.Start() + range.Size() <= static_cast<size_t>(Rows()));
     auto const stride = static_cast<ptrdiff_t>(view_.extent(0)); // paddedRows
     auto* col = storage_.container().data() + (static_cast<ptrdiff_t>(i) * stride); // NOLINT(bugprone-implicit-widening-of-multiplication-result)
-    auto* begin = col + range.Start();
-    auto const stats = vstat::univariate::accumulate<Scalar>(begin, begin + range.Size());
-    auto const stddev = std::sqrt(stats.variance);
-    auto const mu = stats.mean;
-    std::transform(col, col + Rows(), col, [mu, stddev](auto v) -> Scalar { return (v - mu) / stddev; });
+    auto const stats = GetColumnStatistics(static_cast<int64_t>(i), range); // see Normalize
+    if (auto* wide = WideColumn(static_cast<int64_t>(i)); wide != nullptr) {
+        auto const stddev = std::sqrt(stats.Variance);
+        auto const mu = stats.Mean;
+        std::transform(wide, wide + Rows(), wide, [mu, stddev](auto v) -> double { return (v - mu) / stddev; });
+    } else {
+        auto const stddev = std::sqrt(stats.Variance);
+        auto const mu = stats.Mean;
+        std::transform(col, col + Rows(), col, [mu, stddev](auto v) -> Scalar { return (v - mu) / stddev; });
+    }
+    statistics_.Invalidate(static_cast<int64_t>(i));
+    Recompress(static_cast<int64_t>(i));
+    SyncReplicas(static_cast<int64_t>(i));
 }
 
 void Dataset::SetValues(Operon::Hash hash, Range range, Span<Scalar const> values)
@@ -403,9 +594,15 @@ void Dataset::SetValues(Operon::Hash hash, Range range, Span<Scalar const> value
     auto const stride = static_cast<ptrdiff_t>(view_.extent(0)); // paddedRows
     auto* col = storage_.container().data() + (static_cast<ptrdiff_t>(it->second.Index) * stride); // NOLINT(bugprone-implicit-widening-of-multiplication-result)
     std::copy(values.begin(), values.end(), col + range.Start());
+    if (auto* wide = WideColumn(it->second.Index); wide != nullptr) {
+        std::copy(values.begin(), values.end(), wide + range.Start());
+    }
+    statistics_.Invalidate(it->second.Index);
+    Recompress(it->second.Index);
+    SyncReplicas(it->second.Index);
 }
 
-void Dataset::PermuteRows(std::vector<int> const& perm)
+void Dataset::PermuteRows(std::vector<int> const& perm, std::size_t nthread)
 {
     if (IsView()) {
         throw std::runtime_error("Cannot permute a non-owning dataset.\n");
@@ -415,20 +612,308 @@ void Dataset::PermuteRows(std::vector<int> const& perm)
     auto const stride = static_cast<ptrdiff_t>(view_.extent(0)); // paddedRows
     auto const ncols = Cols();
     auto* data = storage_.container().data();
-    std::vector<Scalar> tmp(nrows);
+
+    // Columns are permuted in groups, the weights riding along as one more
+    // column: one sweep over `perm` gathers every column of the group, so
+    // the index array is streamed once per group instead of once per
+    // column and the group's independent random loads overlap. Each group
+    // is gathered into a single scratch buffer and copied back (the
+    // permutation is arbitrary, so it cannot be applied in place). Both
+    // passes are split into blocks of rows that run in parallel, so the
+    // scratch holds one group whatever the thread count and each block
+    // writes a contiguous slice of it.
+    std::vector<Scalar*> cols(static_cast<std::size_t>(ncols));
     for (auto j = 0; j < ncols; ++j) {
-        auto* col = data + (static_cast<ptrdiff_t>(j) * stride);
-        for (auto k = 0; k < nrows; ++k) {
-            tmp[k] = col[perm[k]];
+        cols[j] = data + (static_cast<ptrdiff_t>(j) * stride);
+    }
+    if (weights_) { cols.push_back(weights_->data()); }
+
+    constexpr std::size_t group { 4 };
+    constexpr int block { 1 << 14 };
+    auto const nblocks = (nrows + block - 1) / block;
+
+    // Thread count is capped at the number of row blocks. Small datasets
+    // are not worth an executor.
+    constexpr std::size_t parallelThreshold { 1UL << 20U };
+    if (nthread == 0) { nthread = std::thread::hardware_concurrency(); }
+    nthread = std::clamp<std::size_t>(nthread, 1, static_cast<std::size_t>(std::max(nblocks, 1)));
+    if (static_cast<std::size_t>(nrows) * static_cast<std::size_t>(ncols) < parallelThreshold) { nthread = 1; }
+
+    std::optional<tf::Executor> executor;
+    if (nthread > 1) { executor.emplace(nthread); }
+    auto forEachBlock = [&](auto&& f) {
+        auto rows = [&](int b) { f(b * block, std::min(nrows, (b + 1) * block)); };
+        if (!executor) {
+            for (auto b = 0; b < nblocks; ++b) { rows(b); }
+            return;
+        }
+        tf::Taskflow taskflow;
+        taskflow.for_each_index(0, nblocks, 1, rows);
+        executor->run(taskflow).get(); // .wait_for_all() would silently drop an exception thrown by any task
+    };
+
+    auto const n = static_cast<std::size_t>(nrows);
+    std::vector<Scalar> scratch(std::min(group, cols.size()) * n);
+    for (auto c0 = 0UL; c0 < cols.size(); c0 += group) {
+        auto const cn = std::min(group, cols.size() - c0);
+        auto* const* g = cols.data() + c0;
+        forEachBlock([&](int k0, int k1) {
+            for (auto k = k0; k < k1; ++k) {
+                auto const src = perm[k];
+                for (auto c = 0UL; c < cn; ++c) { scratch[(c * n) + k] = g[c][src]; }
+            }
+        });
+        forEachBlock([&](int k0, int k1) {
+            // tail (col+nrows .. col+stride-1) remains zero
+            for (auto c = 0UL; c < cn; ++c) { std::copy(scratch.data() + (c * n) + k0, scratch.data() + (c * n) + k1, g[c] + k0); }
+        });
+    }
+
+    // Float64 copies are permuted separately (rarely more than a few columns)
+    std::vector<double> wideScratch;
+    for (auto j = 0; j < ncols; ++j) {
+        if (auto* wide = WideColumn(j); wide != nullptr) {
+            wideScratch.resize(n);
+            forEachBlock([&](int k0, int k1) { for (auto k = k0; k < k1; ++k) { wideScratch[k] = wide[perm[k]]; } });
+            forEachBlock([&](int k0, int k1) { std::copy(wideScratch.data() + k0, wideScratch.data() + k1, wide + k0); });
+        }
+        Recompress(j);
+    }
+    statistics_.Invalidate();
+    SyncReplicas();
+}
+
+auto Dataset::AuditColumnPrecision(Operon::Hash hash, ColumnPrecision precision) const -> ColumnPrecisionReport
+{
+    auto it = variables_.find(hash);
+    if (it == variables_.end()) {
+        throw std::runtime_error(fmt::format("AuditColumnPrecision: cannot find variable with hash value {}\n", hash));
+    }
+    ColumnPrecisionReport report { .Hash = hash, .Precision = precision };
+    if (precision == ColumnPrecision::Float32 || precision == ColumnPrecision::Float64) {
+        return report; // lossless from the native column
+    }
+    auto const values = ColSpan(static_cast<int>(it->second.Index));
+    double ssr { 0 };
+    auto min = std::numeric_limits<double>::infinity();
+    auto max = -std::numeric_limits<double>::infinity();
+    for (auto const v : values) {
+        if (std::isfinite(v)) {
+            min = std::min(min, static_cast<double>(v));
+            max = std::max(max, static_cast<double>(v));
         }
-        std::copy(tmp.begin(), tmp.end(), col);
-        // tail (col+nrows .. col+stride-1) remains zero
+        auto const x = static_cast<float>(v);
+        auto const y = Decompress(precision, Compress(precision, x));
+        if (std::isfinite(x) && !std::isfinite(y)) {
+            ++report.Overflow;
+            continue;
+        }
+        auto const err = std::abs(static_cast<double>(v) - static_cast<double>(y));
+        if (!std::isfinite(err)) { continue; }
+        report.MaxAbsError = std::max(report.MaxAbsError, err);
+        if (v != Scalar { 0 }) {
+            report.MaxRelError = std::max(report.MaxRelError, err / std::abs(static_cast<double>(v)));
+        }
+        ssr += err * err;
+    }
+    if (!values.empty()) {
+        report.RootMeanSquaredError = std::sqrt(ssr / static_cast<double>(values.size()));
+    }
+    if (max > min) {
+        report.RangeRelError = report.MaxAbsError / (max - min);
+    }
+    return report;
+}
+
+auto Dataset::SetColumnPrecision(Operon::Hash hash, ColumnPrecision precision) -> ColumnPrecisionReport
+{
+    if (IsView()) {
+        throw std::runtime_error("Cannot compress a non-owning dataset.\n");
+    }
+    auto report = AuditColumnPrecision(hash, precision);
+    auto const index = variables_.find(hash)->second.Index;
+    if (compressed_.empty()) {
+        compressed_.resize(Cols<std::size_t>());
+    }
+    if (precision == ColumnPrecision::Float64 && std::is_same_v<Scalar, double>) {
+        precision = ColumnPrecision::Float32; // already native
+    }
+    auto& c = compressed_[index];
+    c.Precision = precision;
+    if (precision != ColumnPrecision::Float16 && precision != ColumnPrecision::BFloat16) {
+        c.Values = {};
+        c.Values.shrink_to_fit();
+    }
+    if (precision != ColumnPrecision::Float64) {
+        c.Wide = {};
+        c.Wide.shrink_to_fit();
+    } else if (c.Wide.empty()) {
+        auto const stride = static_cast<ptrdiff_t>(view_.extent(0)); // paddedRows
+        auto const* col = view_.data_handle() + (index * stride);
+        c.Wide.assign(col, col + stride);
+    }
+    if (precision == ColumnPrecision::Float32) {
+        return report;
+    }
+    statistics_.Invalidate(index);
+    Recompress(index);
+    SyncReplicas(index);
+    return report;
+}
+
+auto Dataset::GetColumnStatistics(int64_t index, Range range, bool weighted) const -> ColumnStatistics
+{
+    EXPECT(index >= 0 && index < Cols<int64_t>());
+    EXPECT(range.Start() + range.Size() <= static_cast<size_t>(Rows()));
+    weighted = weighted && weights_.has_value();
+    StatisticsCache::Key const key { index, range.Start(), range.Size(), weighted };
+    if (auto cached = statistics_.Find(key); cached) {
+        return *cached;
+    }
+
+    // a Float64 column's statistics are those of its exact values
+    auto const w = weighted ? Span<Scalar const>{ weights_->data() + range.Start(), range.Size() } : Span<Scalar const>{};
+    auto const wide = GetCompressedValues(index).Wide;
+    auto const stats = wide.empty()
+        ? ColumnStatisticsOf(ColSpan(static_cast<int>(index)).subspan(range.Start(), range.Size()), w)
+        : ColumnStatisticsOf(wide.subspan(range.Start(), range.Size()), w);
+    statistics_.Insert(key, stats);
+    return stats;
+}
+
+auto Dataset::GetColumnStatistics(Operon::Hash hash, Range range, bool weighted) const -> ColumnStatistics
+{
+    auto it = variables_.find(hash);
+    if (it == variables_.end()) {
+        throw std::runtime_error(fmt::format("GetColumnStatistics: cannot find variable with hash value {}\n", hash));
+    }
+    return GetColumnStatistics(static_cast<int64_t>(it->second.Index), range, weighted);
+}
+
+// Re-encodes column `index` from its full-precision values (after a
+// mutation, or on first compression) and rounds the full-precision column
+// to the encoded values so both copies agree. For Float64 columns the
+// direction is reversed: the wide copy is the source of truth (mutations
+// update it first) and the native column is narrowed from it. No-op for
+// Float32 columns.
+void Dataset::Recompress(int64_t index)
+{
+    if (compressed_.empty()) { return; }
+    auto& c = compressed_[index];
+    if (c.Precision == ColumnPrecision::Float32) { return; }
+    auto const stride = static_cast<ptrdiff_t>(view_.extent(0)); // paddedRows
+    auto* col = storage_.container().data() + (static_cast<ptrdiff_t>(index) * stride); // NOLINT(bugprone-implicit-widening-of-multiplication-result)
+    if (c.Precision == ColumnPrecision::Float64) {
+        std::transform(c.Wide.begin(), c.Wide.end(), col, [](auto v) { return static_cast<Scalar>(v); });
+        return;
+    }
+    c.Values.resize(static_cast<std::size_t>(stride)); // padded tail encodes 0.0 -> 0x0000
+    for (auto k = 0; k < stride; ++k) {
+        c.Values[k] = Compress(c.Precision, static_cast<float>(col[k]));
+        col[k] = static_cast<Scalar>(Decompress(c.Precision, c.Values[k]));
+    }
+}
+
+auto Dataset::GetColumnPrecision(int64_t index) const noexcept -> ColumnPrecision
+{
+    return compressed_.empty() ? ColumnPrecision::Float32 : compressed_[index].Precision;
+}
+
+auto Dataset::GetColumnPrecision(Operon::Hash hash) const noexcept -> ColumnPrecision
+{
+    auto it = variables_.find(hash);
+    if (it == variables_.end()) {
+        fmt::print(stderr, "GetColumnPrecision: cannot find variable with hash value {}", hash);
+        std::abort();
+    }
+    return GetColumnPrecision(static_cast<int64_t>(it->second.Index));
+}
+
+auto Dataset::GetCompressedValues(int64_t index) const noexcept -> CompressedColumn
+{
+    if (compressed_.empty() || compressed_[index].Precision == ColumnPrecision::Float32) {
+        return {};
+    }
+    auto const& c = compressed_[index];
+    return { .Values = { c.Values.data(), c.Values.size() }, .Precision = c.Precision, .Wide = { c.Wide.data(), c.Wide.size() } };
+}
+
+auto Dataset::WideColumn(int64_t index) noexcept -> double*
+{
+    if (compressed_.empty() || compressed_[index].Precision != ColumnPrecision::Float64) {
+        return nullptr;
+    }
+    return compressed_[index].Wide.data();
+}
+
+auto Dataset::GetCompressedValues(Operon::Hash hash) const noexcept -> CompressedColumn
+{
+    auto it = variables_.find(hash);
+    if (it == variables_.end()) {
+        fmt::print(stderr, "GetCompressedValues: cannot find variable with hash value {}", hash);
+        std::abort();
     }
+    return GetCompressedValues(static_cast<int64_t>(it->second.Index));
 }
 
 auto Dataset::GetPaddedValues(int64_t index) const noexcept -> Scalar const*
 {
-    return view_.data_handle() + (static_cast<std::ptrdiff_t>(index) * view_.extent(0));
+    return LocalData() + (static_cast<std::ptrdiff_t>(index) * view_.extent(0));
+}
+
+auto Dataset::LocalData() const noexcept -> Scalar const*
+{
+    if (replicas_.empty()) {
+        return view_.data_handle();
+    }
+    auto const node = static_cast<std::size_t>(Numa::CurrentNode()) % replicas_.size();
+    return replicas_[node].container().data();
+}
+
+auto Dataset::EnableNumaReplication() -> int
+{
+    auto const nodes = Numa::NodeCount();
+    if (nodes < 2) {
+        replicas_.clear();
+        return 0;
+    }
+    auto const pr = static_cast<std::ptrdiff_t>(view_.extent(0)); // paddedRows
+    auto const nc = static_cast<std::ptrdiff_t>(view_.extent(1));
+    auto const* src = view_.data_handle();
+
+    std::vector<Storage> replicas(nodes);
+    std::vector<std::thread> threads;
+    threads.reserve(nodes);
+    for (auto node = 0; node < nodes; ++node) {
+        threads.emplace_back([&, node]() {
+            // allocate and fill from a thread on the target node: the
+            // zero-initialization in Storage's constructor is the first touch
+            (void)Numa::PinCurrentThread(node);
+            replicas[node] = Storage(pr, nc);
+            std::copy_n(src, pr * nc, replicas[node].container().data());
+        });
+    }
+    for (auto& t : threads) { t.join(); }
+    replicas_ = std::move(replicas);
+    return static_cast<int>(replicas_.size());
+}
+
+// Copies column `index` (every column when index < 0) from the canonical
+// storage into each replica. Pages were already placed by the first touch
+// in EnableNumaReplication, so the copy can run on any thread.
+void Dataset::SyncReplicas(int64_t index)
+{
+    if (replicas_.empty()) { return; }
+    auto const pr = static_cast<std::ptrdiff_t>(view_.extent(0)); // paddedRows
+    auto const* src = view_.data_handle();
+    for (auto& r : replicas_) {
+        auto* dst = r.container().data();
+        if (index < 0) {
+            std::copy_n(src, r.container().size(), dst);
+        } else {
+            std::copy_n(src + (index * pr), pr, dst + (index * pr));
+        }
+    }
 }
 
 auto Dataset::GetPaddedValues(Operon::Hash hash) const noexcept -> Scalar const*
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright 2019-2025 Heal Research
+// SPDX-FileCopyrightText: Copyright 2025-present Bogdan Burlacu and contributors
+
+#include "operon/core/numa.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace Operon::Numa {
+
+namespace {
+    struct Topology {
+        std::vector<std::vector<int>> Cpus; // per node
+        std::vector<int> CpuToNode;         // per cpu, -1 when offline/unknown
+    };
+
+    // Parses the kernel's cpulist format, e.g. "0-15,32-47".
+    auto ParseCpuList(std::string const& text) -> std::vector<int>
+    {
+        std::vector<int> cpus;
+        std::stringstream ss(text);
+        std::string item;
+        while (std::getline(ss, item, ',')) {
+            if (item.empty() || item == "\n") { continue; }
+            auto const dash = item.find('-');
+            try {
+                auto const lo = std::stoi(item.substr(0, dash));
+                auto const hi = dash == std::string::npos ? lo : std::stoi(item.substr(dash + 1));
+                for (auto c = lo; c <= hi; ++c) { cpus.push_back(c); }
+            } catch (std::exception const&) {
+                return {};
+            }
+        }
+        return cpus;
+    }
+
+    auto ReadTopology() -> Topology
+    {
+        Topology topo;
+#if defined(__linux__)
+        namespace fs = std::filesystem;
+        std::error_code ec;
+        fs::path const root { "/sys/devices/system/node" };
+        for (auto node = 0;; ++node) {
+            auto const dir = root / ("node" + std::to_string(node));
+            if (!fs::exists(dir, ec)) { break; }
+            std::ifstream f(dir / "cpulist");
+            std::string text;
+            std::getline(f, text);
+            auto cpus = ParseCpuList(text);
+            if (cpus.empty()) { continue; } // memory-only node: nothing to pin or replicate for
+            for (auto c : cpus) {
+                if (std::cmp_greater_equal(c, topo.CpuToNode.size())) { topo.CpuToNode.resize(c + 1, -1); }
+                topo.CpuToNode[c] = static_cast<int>(topo.Cpus.size());
+            }
+            topo.Cpus.push_back(std::move(cpus));
+        }
+#endif
+        if (topo.Cpus.empty()) { topo.Cpus.emplace_back(); }
+        return topo;
+    }
+
+    auto GetTopology() -> Topology const&
+    {
+        static Topology const topo = ReadTopology();
+        return topo;
+    }
+} // namespace
+
+auto NodeCount() -> int
+{
+    return static_cast<int>(GetTopology().Cpus.size());
+}
+
+auto CurrentNode() noexcept -> int
+{
+#if defined(__linux__)
+    auto const& topo = GetTopology();
+    if (topo.Cpus.size() < 2) { return 0; }
+    auto const cpu = sched_getcpu();
+    if (cpu < 0 || std::cmp_greater_equal(cpu, topo.CpuToNode.size())) { return 0; }
+    return std::max(topo.CpuToNode[cpu], 0);
+#else
+    return 0;
+#endif
+}
+
+auto NodeCpus(int node) -> std::vector<int>
+{
+    auto const& topo = GetTopology();
+    if (node < 0 || node >= std::ssize(topo.Cpus)) { return {}; }
+    return topo.Cpus[node];
+}
+
+auto PinCurrentThread(int node) -> bool
+{
+#if defined(__linux__)
+    auto const cpus = NodeCpus(node);
+    if (cpus.empty()) { return false; }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (auto c : cpus) {
+        if (c < CPU_SETSIZE) { CPU_SET(c, &set); }
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)node;
+    return false;
+#endif
+}
+
+} // namespace Operon::Numa
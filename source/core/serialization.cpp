@@ -130,7 +130,7 @@ auto ProxiesToTree(std::vector<NodeProxy> const& proxies) -> Operon::Tree
 
 auto IndividualToProxy(Operon::Individual const& ind) -> IndividualProxy
 {
-    return { { NodesToProxies(ind.Genotype.Nodes()) }, ind.Fitness, ind.Rank, ind.Distance };
+    return { { NodesToProxies(ind.Genotype.Nodes()) }, { ind.Fitness.begin(), ind.Fitness.end() }, ind.Rank, ind.Distance };
 }
 
 auto ProxyToIndividual(IndividualProxy const& p) -> Operon::Individual
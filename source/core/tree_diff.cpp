@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <array>
 #include <bit>
+#include <cstdint>
 #include <limits>
 #include <stdexcept>
 
@@ -676,4 +677,48 @@ auto BuildHessianDag(Tree const& tree) -> HessianDag {
     return result;
 }
 
+auto HasSymbolicDerivatives(Tree const& tree) -> bool {
+    RegisterBuiltinSymbolicDerivs();
+    // mirrors the case analysis in Deriv()
+    return std::ranges::all_of(tree.Nodes(), [](Node const& n) {
+        if (n.IsLeaf()) { return true; }
+        if (n.IsAddition() || n.IsMultiplication() || n.IsSubtraction() || n.IsPow()) { return true; }
+        if (n.IsDivision()) { return n.Arity <= 2; }
+        if (n.IsAq() || n.IsPowabs() || n.IsOp<BuiltinOp::Fmin, BuiltinOp::Fmax>()) { return false; }
+        if (n.Arity == 2) { return BinaryDerivRules().Contains(n.HashValue); }
+        if (n.Arity == 1) { return SymbolicDerivRules().Contains(n.HashValue); }
+        return false;
+    });
+}
+
+auto LinearCoefficients(Tree const& tree) -> Operon::Vector<std::size_t> {
+    auto const& nodes = tree.Nodes();
+    Operon::Vector<std::size_t> linear;
+    if (nodes.empty()) { return linear; }
+
+    // top-down (postfix: parents after their children) propagation of "the
+    // output is linear in this subtree's value"
+    Operon::Vector<std::uint8_t> additive(nodes.size(), 0);
+    additive.back() = 1;
+    for (auto i = nodes.size(); i-- > 0;) {
+        auto const& n = nodes[i];
+        if (additive[i] == 0 || n.IsLeaf()) { continue; }
+        if (n.IsAddition() || n.IsSubtraction()) {
+            for (auto j : tree.Indices(i)) { additive[j] = 1; }
+        } else if (n.IsMultiplication()) {
+            for (auto j : tree.Indices(i)) {
+                if (nodes[j].IsLeaf() && nodes[j].Optimize) { additive[j] = 1; break; }
+            }
+        }
+    }
+
+    std::size_t k{0};
+    for (auto i = 0UL; i < nodes.size(); ++i) {
+        if (!nodes[i].Optimize) { continue; }
+        if (additive[i] != 0 && nodes[i].IsLeaf()) { linear.push_back(k); }
+        ++k;
+    }
+    return linear;
+}
+
 } // namespace Operon
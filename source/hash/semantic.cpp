@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright 2019-2025 Heal Research
+// SPDX-FileCopyrightText: Copyright 2025-present Bogdan Burlacu and contributors
+
+#include "operon/hash/semantic.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "operon/hash/hash.hpp"
+#include "operon/interpreter/interpreter.hpp"
+
+namespace Operon {
+
+struct SemanticCache::Table {
+    ZobristCache<SemanticEntry> Cache;
+};
+
+namespace {
+    // Copies a sorted random sample of the training rows into a dataset of
+    // their own, keeping the variable names (and hence hashes) and order.
+    auto MakeProbe(RandomGenerator& rng, Problem const& problem, std::size_t probeRows) -> Dataset
+    {
+        auto const* dataset = problem.GetDataset();
+        auto const training = problem.TrainingRange();
+        EXPECT(training.Size() > 0);
+
+        std::vector<std::size_t> rows;
+        rows.reserve(std::min(probeRows, training.Size()));
+        std::ranges::sample(std::views::iota(training.Start(), training.End()), std::back_inserter(rows),
+                            static_cast<std::ptrdiff_t>(std::max(probeRows, std::size_t{1})), rng);
+
+        auto variables = dataset->GetVariables();
+        std::ranges::sort(variables, std::less{}, &Variable::Index);
+
+        std::vector<std::string> names;
+        std::vector<std::vector<Scalar>> columns;
+        names.reserve(variables.size());
+        columns.reserve(variables.size());
+        for (auto const& v : variables) {
+            auto const values = dataset->GetValues(v.Index);
+            auto& column = columns.emplace_back();
+            column.reserve(rows.size());
+            std::ranges::transform(rows, std::back_inserter(column), [&](auto r) { return values[r]; });
+            names.push_back(v.Name);
+        }
+        return Dataset{names, columns};
+    }
+
+    // Relative quantization: the mantissa is rounded to `bits` bits, so
+    // values within about one part in 2^bits of each other share a key
+    // regardless of their magnitude. Signed zeros collapse to one key and a
+    // mantissa that rounds up to 1 is renormalized, so the key is unique per
+    // representable quantized value.
+    auto Quantize(Scalar value, int bits) -> std::array<std::int64_t, 2>
+    {
+        if (value == Scalar{0}) { return { 0, 0 }; }
+        int exponent{};
+        auto const mantissa = std::frexp(static_cast<double>(value), &exponent);
+        auto const scale = std::ldexp(1.0, bits);
+        auto q = std::llround(mantissa * scale);
+        if (std::abs(q) == static_cast<std::int64_t>(scale)) {
+            q /= 2;
+            ++exponent;
+        }
+        return { q, exponent };
+    }
+} // namespace
+
+SemanticCache::SemanticCache(RandomGenerator& rng, Problem const& problem, ScalarDispatch const& dtable, std::size_t probeRows, std::size_t maxAge)
+    : probe_(MakeProbe(rng, problem, probeRows))
+    , dtable_(&dtable)
+    , table_(std::make_unique<Table>())
+    , maxAge_(maxAge)
+{
+}
+
+SemanticCache::~SemanticCache() = default;
+
+auto SemanticCache::Fingerprint(Tree const& tree) const -> std::optional<Hash>
+{
+    auto const rows = ProbeRows();
+    Range const range{ 0, rows };
+
+    // probe sets are small; a thread-local buffer keeps this allocation-free
+    thread_local std::vector<Scalar> output;
+    thread_local std::vector<std::array<std::int64_t, 2>> keys;
+    output.resize(rows);
+    keys.resize(rows);
+
+    auto const coeff = tree.GetCoefficients();
+    Interpreter<Scalar, ScalarDispatch> const interpreter{dtable_, &probe_, &tree};
+    interpreter.Evaluate(coeff, range, output);
+
+    for (auto i = 0UL; i < rows; ++i) {
+        if (!std::isfinite(output[i])) { return std::nullopt; }
+        keys[i] = Quantize(output[i], QuantizationBits);
+    }
+    return Hasher{}(reinterpret_cast<uint8_t const*>(keys.data()), keys.size() * sizeof(keys.front())); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+auto SemanticCache::TryGet(Hash fingerprint, SemanticEntry& entry) const -> bool
+{
+    lookups_.fetch_add(1, std::memory_order_relaxed);
+
+    bool found = false;
+    bool stale = false;
+    std::uint32_t observedGen = 0;
+    table_->Cache.IfContains(fingerprint, [&](SemanticEntry const& e) {
+        observedGen = e.InsertGeneration;
+        auto const now = clock_.load(std::memory_order_relaxed);
+        stale = maxAge_ > 0 && static_cast<std::size_t>(now - e.InsertGeneration) > maxAge_;
+        if (!stale) { entry = e; found = true; }
+    });
+
+    if (stale) {
+        // see Zobrist::TryGet for why the erase rechecks the generation
+        table_->Cache.EraseIf(fingerprint, [&](SemanticEntry const& e) {
+            return e.InsertGeneration == observedGen;
+        });
+        return false;
+    }
+    return found;
+}
+
+auto SemanticCache::Insert(Hash fingerprint, Tree const& tree, FitnessVector const& fitness) -> void
+{
+    auto const optimized = Fingerprint(tree);
+    auto const gen = clock_.load(std::memory_order_relaxed);
+    table_->Cache.LazyEmplace(fingerprint,
+        [](SemanticEntry&) -> void { },
+        [&](SemanticEntry& e) -> void {
+            e.Value = fitness;
+            e.InsertGeneration = gen;
+            // without a finite optimized model there is nothing to transplant
+            if (optimized) {
+                auto const coeff = tree.GetCoefficients();
+                e.Coefficients.assign(coeff.begin(), coeff.end());
+                e.OptimizedFingerprint = *optimized;
+            }
+        }
+    );
+}
+
+auto SemanticCache::Clear() -> void
+{
+    table_->Cache.Clear();
+    hits_.store(0, std::memory_order_relaxed);
+    lookups_.store(0, std::memory_order_relaxed);
+    clock_.store(0, std::memory_order_relaxed);
+}
+
+auto SemanticCache::Invalidate() -> void
+{
+    table_->Cache.Clear();
+}
+
+auto SemanticCache::SetGeneration(std::size_t generation) -> void
+{
+    ENSURE(generation <= std::numeric_limits<std::uint32_t>::max());
+    clock_.store(static_cast<std::uint32_t>(generation), std::memory_order_relaxed);
+}
+
+auto SemanticCache::Size() const -> std::size_t
+{
+    return table_->Cache.Size();
+}
+
+} // namespace Operon
@@ -6,18 +6,43 @@
 
 #include <algorithm>
 #include <limits>
+#include <type_traits>
 #include <utility>
+#include <variant>
 
 namespace Operon {
 
+// A cache that keeps no coefficients holds plain FitnessEntry values, so its
+// entries don't carry an empty coefficient vector each.
 struct Zobrist::TranspositionTable {
-    ZobristCache<FitnessEntry> Cache;
+    std::variant<ZobristCache<FitnessEntry>, ZobristCache<FittedEntry>> Cache;
+
+    explicit TranspositionTable(bool storeCoefficients)
+    {
+        if (storeCoefficients) { Cache.emplace<ZobristCache<FittedEntry>>(); }
+    }
 };
 
-Zobrist::Zobrist(Operon::RandomGenerator& rng, int maxLength, Operon::Span<Operon::Hash const> variableHashes, std::size_t maxAge)
+namespace {
+    template<typename Entry>
+    constexpr bool HasCoefficients = std::is_base_of_v<CoefficientData, Entry>;
+
+    template<typename Entry>
+    auto PayloadBytes(Entry const& e) -> std::size_t
+    {
+        if constexpr (HasCoefficients<Entry>) {
+            return e.Coefficients.capacity() * sizeof(Scalar);
+        } else {
+            return 0;
+        }
+    }
+} // namespace
+
+Zobrist::Zobrist(Operon::RandomGenerator& rng, int maxLength, Operon::Span<Operon::Hash const> variableHashes, std::size_t maxAge, bool storeCoefficients)
     : table_(static_cast<int>(variableHashes.size()) + 1, maxLength)
-    , tt_(std::make_unique<TranspositionTable>())
+    , tt_(std::make_unique<TranspositionTable>(storeCoefficients))
     , maxAge_(maxAge)
+    , storeCoefficients_(storeCoefficients)
 {
     std::generate(table_.container().begin(), table_.container().end(), std::ref(rng));
     for (int i = 0; std::cmp_less(i, variableHashes.size()); ++i) {
@@ -27,7 +52,7 @@ Zobrist::Zobrist(Operon::RandomGenerator& rng, int maxLength, Operon::Span<Opero
 
 Zobrist::~Zobrist() = default;
 
-auto Zobrist::TryGet(Operon::Hash hash, Value& val) const -> bool
+auto Zobrist::Find(Operon::Hash hash, FitnessVector& val, Vector<Scalar>* coefficients) const -> bool
 {
     // relaxed: these are statistics counters with no ordering requirement
     // on anything else, and TryGet is in the per-individual evaluation hot
@@ -37,12 +62,24 @@ auto Zobrist::TryGet(Operon::Hash hash, Value& val) const -> bool
     bool found = false;
     bool stale = false;
     std::uint32_t observedGen = 0;
-    tt_->Cache.IfContains(hash, [&](FitnessEntry const& e) {
-        observedGen = e.InsertGeneration;
-        auto const now = clock_.load(std::memory_order_relaxed);
-        stale = maxAge_ > 0 && static_cast<std::size_t>(now - e.InsertGeneration) > maxAge_;
-        if (!stale) { val = e.Value; found = true; }
-    });
+    std::visit([&]<typename Entry>(ZobristCache<Entry> const& cache) {
+        cache.IfContains(hash, [&](Entry const& e) {
+            observedGen = e.InsertGeneration;
+            auto const now = clock_.load(std::memory_order_relaxed);
+            stale = maxAge_ > 0 && static_cast<std::size_t>(now - e.InsertGeneration) > maxAge_;
+            if (!stale) {
+                val = e.Value;
+                if (coefficients != nullptr) {
+                    if constexpr (HasCoefficients<Entry>) {
+                        coefficients->assign(e.Coefficients.begin(), e.Coefficients.end());
+                    } else {
+                        coefficients->clear();
+                    }
+                }
+                found = true;
+            }
+        });
+    }, tt_->Cache);
 
     if (stale) {
         // Conditional erase: only remove if it's STILL the same stale
@@ -54,39 +91,84 @@ auto Zobrist::TryGet(Operon::Hash hash, Value& val) const -> bool
         // (onNew, new InsertGeneration) before we reach EraseIf here -
         // without the generation recheck we'd delete that fresh entry
         // instead of the stale one we actually observed.
-        tt_->Cache.EraseIf(hash, [&](FitnessEntry const& e) {
-            return e.InsertGeneration == observedGen;
-        });
+        std::visit([&]<typename Entry>(ZobristCache<Entry>& cache) {
+            cache.EraseIf(hash, [&](Entry const& e) {
+                if (e.InsertGeneration != observedGen) { return false; }
+                coefficientBytes_.fetch_sub(PayloadBytes(e), std::memory_order_relaxed);
+                return true;
+            });
+        }, tt_->Cache);
         return false; // treat as a miss - caller re-evaluates
     }
     if (found) { hits_.fetch_add(1, std::memory_order_relaxed); }
     return found;
 }
 
-auto Zobrist::Insert(Operon::Hash hash, Value const& val) -> void
+auto Zobrist::TryGet(Operon::Hash hash, FitnessVector& val) const -> bool
+{
+    return Find(hash, val, nullptr);
+}
+
+auto Zobrist::TryGet(Operon::Hash hash, FitnessVector& val, Vector<Scalar>& coefficients) const -> bool
+{
+    return Find(hash, val, &coefficients);
+}
+
+auto Zobrist::TryGet(Operon::Hash hash, Value& val) const -> bool
+{
+    FitnessVector fit;
+    if (!TryGet(hash, fit)) { return false; }
+    val.assign(fit.begin(), fit.end());
+    return true;
+}
+
+auto Zobrist::Insert(Operon::Hash hash, FitnessVector const& val) -> void
+{
+    Insert(hash, val, {});
+}
+
+auto Zobrist::Insert(Operon::Hash hash, FitnessVector const& val, Operon::Span<Operon::Scalar const> coefficients) -> void
 {
     // Insert is only ever called after a TryGet miss on this same hash, so
     // the "already exists" branch only fires on a genuine race (another
     // thread inserted the same newly-seen hash first) - keep that entry's
     // value (first writer wins), nothing else to do.
     auto const gen = clock_.load(std::memory_order_relaxed);
-    tt_->Cache.LazyEmplace(hash,
-        [](FitnessEntry&) -> void { },
-        [&](FitnessEntry& e) -> void { e.Value = val; e.InsertGeneration = gen; }
-    );
+    std::visit([&]<typename Entry>(ZobristCache<Entry>& cache) {
+        cache.LazyEmplace(hash,
+            [](Entry&) -> void { },
+            [&](Entry& e) -> void {
+                e.Value = val;
+                e.InsertGeneration = gen;
+                if constexpr (HasCoefficients<Entry>) {
+                    if (!coefficients.empty()) {
+                        e.Coefficients.assign(coefficients.begin(), coefficients.end());
+                        coefficientBytes_.fetch_add(PayloadBytes(e), std::memory_order_relaxed);
+                    }
+                }
+            }
+        );
+    }, tt_->Cache);
 }
 
 auto Zobrist::Clear() -> void
 {
-    tt_->Cache.Clear();
+    std::visit([](auto& cache) { cache.Clear(); }, tt_->Cache);
     hits_.store(0, std::memory_order_relaxed);
     lookups_.store(0, std::memory_order_relaxed);
+    coefficientBytes_.store(0, std::memory_order_relaxed);
     // Otherwise a subsequent run's entries get stamped against a clock left
     // over from before this Clear(), immediately reading as stale (or, on
     // wraparound if the new run's generation is smaller, falsely fresh).
     clock_.store(0, std::memory_order_relaxed);
 }
 
+auto Zobrist::Invalidate() -> void
+{
+    std::visit([](auto& cache) { cache.Clear(); }, tt_->Cache);
+    coefficientBytes_.store(0, std::memory_order_relaxed);
+}
+
 auto Zobrist::SetGeneration(std::size_t generation) -> void
 {
     // A run with more than 2^32-1 generations is not realistic, but a
@@ -98,7 +180,7 @@ auto Zobrist::SetGeneration(std::size_t generation) -> void
 
 auto Zobrist::Size() const -> std::size_t
 {
-    return tt_->Cache.Size();
+    return std::visit([](auto const& cache) { return cache.Size(); }, tt_->Cache);
 }
 
 } // namespace Operon
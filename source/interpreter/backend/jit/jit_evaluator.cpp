@@ -119,9 +119,10 @@ auto JitEvaluator::GetOrCompileJacobian(Tree const& tree) const -> CompileMeta c
     return meta;
 }
 
-auto JitEvaluator::Evaluate(RandomGenerator& /*rng*/, Individual const& ind,
-                             Span<Scalar> buf) const -> ReturnType
+auto JitEvaluator::EvaluateInto(RandomGenerator& /*rng*/, Individual const& ind,
+                                 Span<Scalar> buf, Span<Scalar> fitness) const -> void
 {
+    ENSURE(fitness.size() == 1);
     ++CallCount;
 
     auto const* problem       = GetProblem();
@@ -133,12 +134,12 @@ auto JitEvaluator::Evaluate(RandomGenerator& /*rng*/, Individual const& ind,
 
     auto const& tree = ind.Genotype;
     auto const  hash = zobrist_->ComputeHash(tree);
-    CompileMeta const* compiled = GetOrCompile(tree, hash);
+    CompileMeta const* compiled = ReadsFloat64Columns(tree, *dataset) ? nullptr : GetOrCompile(tree, hash);
 
     ENSURE(buf.size() >= range.Size());
     ++ResidualEvaluations;
 
-    // Same oversized-scratch-buffer contract as Evaluator<DTable>::Evaluate
+    // Same oversized-scratch-buffer contract as Evaluator<DTable>::EvaluateInto
     // (source/operators/evaluator.cpp): buf may legitimately be larger than
     // range.Size() for a reused caller-owned buffer, but the compiled path
     // below only ever writes nRows entries and the fallback path's
@@ -181,7 +182,11 @@ auto JitEvaluator::Evaluate(RandomGenerator& /*rng*/, Individual const& ind,
     }
 
     if (scaling_) {
-        auto [a, b] = FitLeastSquares(Span<Scalar const>(estimatedValues.data(), estimatedValues.size()), targetValues, weights);
+        auto const estimated = Span<Scalar const>(estimatedValues.data(), estimatedValues.size());
+        auto const wideTarget = problem->WideTargetValues(range);
+        auto [a, b] = wideTarget.empty()
+            ? FitLeastSquares(estimated, targetValues, weights)
+            : FitLeastSquares(estimated, wideTarget, weights);
         std::ranges::transform(estimatedValues, estimatedValues.begin(),
             [a=a, b=b](auto x) -> Scalar { return static_cast<Scalar>((a * x) + b); });
     }
@@ -191,7 +196,7 @@ auto JitEvaluator::Evaluate(RandomGenerator& /*rng*/, Individual const& ind,
         : error_(estimatedValues, targetValues, weights));
 
     if (!std::isfinite(fit)) { fit = EvaluatorBase::ErrMax; }
-    return ReturnType{ fit };
+    fitness.front() = fit;
 }
 
 auto JitEvaluator::CacheSize() const -> std::size_t
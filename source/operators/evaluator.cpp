@@ -12,12 +12,29 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <limits>
+#include <numeric>
 #include <operon/operon_export.hpp>
+#include <optional>
 #include <random>
+#include <string>
 #include <type_traits>
+#include <utility>
 
 namespace Operon {
 namespace {
+    // Least-squares scale and offset from the bivariate moments of
+    // (estimated, target).
+    auto LeastSquaresFromMoments(auto const& stats) -> std::pair<double, double>
+    {
+        auto a = stats.covariance / stats.variance_x; // scale
+        if (!std::isfinite(a)) {
+            a = 1;
+        }
+        auto b = stats.mean_y - (a * stats.mean_x); // offset
+        return {a, b};
+    }
+
     template<typename T>
     auto FitLeastSquaresImpl(Operon::Span<T const> estimated, Operon::Span<T const> target,
                              Operon::Span<T const> weights = {}) -> std::pair<double, double>
@@ -26,12 +43,7 @@ namespace {
         auto stats = weights.empty()
             ? vstat::bivariate::accumulate<T>(estimated.data(), estimated.data() + estimated.size(), target.data())
             : vstat::bivariate::accumulate<T>(estimated.data(), estimated.data() + estimated.size(), target.data(), weights.data());
-        auto a = stats.covariance / stats.variance_x; // scale
-        if (!std::isfinite(a)) {
-            a = 1;
-        }
-        auto b = stats.mean_y - (a * stats.mean_x); // offset
-        return {a, b};
+        return LeastSquaresFromMoments(stats);
     }
 
     // Finite-aware variant: computes scale/offset from the finite subset
@@ -63,6 +75,152 @@ namespace {
         return {a, b, skipped};
     }
 
+namespace detail {
+    // Weighted co-moments of (estimated, target) pairs: weight sum, means and
+    // centered sums of squares and cross products, updated one row at a time
+    // (weighted Welford) and mergeable across disjoint row sets (Chan et al.).
+    // Every moment-based score in this file goes through them.
+    struct CoMoments {
+        double Sw{0};
+        double Mx{0};
+        double My{0};
+        double Cxx{0};
+        double Cyy{0};
+        double Cxy{0};
+
+        auto Add(double x, double y, double w) -> void
+        {
+            Sw += w;
+            auto const dx = x - Mx;
+            auto const dy = y - My;
+            Mx += w * dx / Sw;
+            My += w * dy / Sw;
+            Cxx += w * dx * (x - Mx);
+            Cyy += w * dy * (y - My);
+            Cxy += w * dx * (y - My);
+        }
+
+        auto Merge(CoMoments const& other) -> void
+        {
+            auto const sw = Sw + other.Sw;
+            if (sw == 0) { return; }
+            auto const dx = other.Mx - Mx;
+            auto const dy = other.My - My;
+            auto const f = Sw * other.Sw / sw;
+            Cxx += other.Cxx + (dx * dx * f);
+            Cyy += other.Cyy + (dy * dy * f);
+            Cxy += other.Cxy + (dx * dy * f);
+            Mx += dx * other.Sw / sw;
+            My += dy * other.Sw / sw;
+            Sw = sw;
+        }
+
+        // weighted sum of squared residuals y - (a x + b) over the rows
+        [[nodiscard]] auto SquaredError(double a, double b) const -> double
+        {
+            auto const bias = My - (a * Mx) - b;
+            return std::max(Cyy - (2 * a * Cxy) + (a * a * Cxx), 0.0) + (Sw * bias * bias);
+        }
+    };
+
+    // The squared-error metrics from a weighted residual sum of squares
+    // `sse` over rows of total weight `weightSum`, with `variance` the
+    // target's variance for the normalised ones. MAE passes its sum of
+    // absolute residuals instead; the metrics with no such form are NaN.
+    auto MetricFromMoments(ErrorType type, double sse, double weightSum, double variance) -> double
+    {
+        switch (type) {
+        case ErrorType::SSE:  return sse;
+        case ErrorType::MSE:
+        case ErrorType::MAE:  return sse / weightSum;
+        case ErrorType::RMSE: return std::sqrt(sse / weightSum);
+        case ErrorType::NMSE: return sse / weightSum / variance;
+        case ErrorType::R2:   return -(1 - (sse / weightSum / variance));
+        default:              return std::numeric_limits<double>::quiet_NaN();
+        }
+    }
+} // namespace detail
+
+    // Linearly scaled error straight from the bivariate moments of
+    // (estimated, target), one vectorized vstat pass and no transform. With
+    // a = cov/var_x (1 when that is not finite, as in FitLeastSquaresImpl)
+    // and the matching offset, the residual mean vanishes and the scaled
+    // mean squared error is var_y - 2*a*cov + a^2*var_x; every squared-error
+    // metric and R2 follow from it, C2 is scale-invariant. Returns nullopt
+    // where the caller must fall back to the transform-then-metric path:
+    //   - MAE has no closed form in the moments;
+    //   - weighted SSE needs the weight sum, which the scaled metric path
+    //     computes itself;
+    //   - non-finite moments (the fallback reproduces the exact ErrMax
+    //     behaviour for NaN/Inf predictions);
+    //   - near-perfect fits, where var_y - cov^2/var_x cancels: below
+    //     FusedCancellationLimit * var_y the relative error of the closed
+    //     form is no longer negligible against the direct sum.
+    // Once the moments are accumulated, `fit` (if given) receives the scale
+    // and offset FitLeastSquaresImpl would compute from them, so a fallback
+    // does not have to accumulate them a second time.
+    constexpr double FusedCancellationLimit { 1e-3 };
+
+    template<typename T>
+    auto FusedScaledErrorImpl(ErrorType type, Operon::Span<T const> estimated, Operon::Span<T const> target,
+                              Operon::Span<T const> weights = {}, std::optional<std::pair<double, double>>* fit = nullptr) -> std::optional<double>
+    requires std::is_arithmetic_v<T>
+    {
+        if (type == ErrorType::MAE || (type == ErrorType::SSE && !weights.empty())) { return std::nullopt; }
+        auto stats = weights.empty()
+            ? vstat::bivariate::accumulate<T>(estimated.data(), estimated.data() + estimated.size(), target.data())
+            : vstat::bivariate::accumulate<T>(estimated.data(), estimated.data() + estimated.size(), target.data(), weights.data());
+        if (fit != nullptr) { *fit = LeastSquaresFromMoments(stats); }
+        auto const vx = static_cast<double>(stats.variance_x);
+        auto const vy = static_cast<double>(stats.variance_y);
+        auto const cxy = static_cast<double>(stats.covariance);
+        if (!std::isfinite(vx) || !std::isfinite(vy) || !std::isfinite(cxy)) { return std::nullopt; }
+
+        // the moments per unit weight, whose squared error is the mean one
+        detail::CoMoments const m{ .Sw = 1, .Mx = static_cast<double>(stats.mean_x), .My = static_cast<double>(stats.mean_y), .Cxx = vx, .Cyy = vy, .Cxy = cxy };
+        auto a = cxy / vx;
+        if (!std::isfinite(a)) { a = 1; }
+        auto const mse = m.SquaredError(a, m.My - (a * m.Mx));
+        if (!(mse > FusedCancellationLimit * vy)) { return std::nullopt; }
+
+        if (type == ErrorType::C2) {
+            return cxy != 0 ? std::make_optional(-(cxy * cxy / (vx * vy))) : std::nullopt; // a == 0: the scaled prediction is constant
+        }
+        auto const n = static_cast<double>(estimated.size());
+        auto const value = detail::MetricFromMoments(type, mse * n, n, vy);
+        return std::isnan(value) ? std::nullopt : std::make_optional(value);
+    }
+
+    // Default (non-skip) scoring shared by Evaluate, EvaluateBounded and
+    // EvaluateRange, so the three agree bit for bit. A Float64 target's exact
+    // values (`wideTarget`) take over the scale fit. With scaling the fused
+    // kernel is tried first; on fallback `estimated` is scaled in place, with
+    // the fused kernel's moments when it got as far as accumulating them.
+    template<typename T>
+    auto ScoreEstimates(ErrorMetric const& error, Operon::Span<T> estimated, Operon::Span<T const> target,
+                        Operon::Span<T const> weights, bool scaling, [[maybe_unused]] Operon::Span<double const> wideTarget = {}) -> double
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            // a Float64 target: fit the scale against its exact values
+            if (scaling && !wideTarget.empty()) {
+                auto [a, b] = FitLeastSquares(estimated, wideTarget, weights);
+                std::ranges::transform(estimated, estimated.begin(), [a=a,b=b](auto x) -> auto { return static_cast<T>((a * x) + b); });
+                return weights.empty() ? error(estimated, target) : error(estimated, target, weights);
+            }
+        }
+        if (scaling) {
+            std::optional<std::pair<double, double>> fit;
+            if (auto fused = FusedScaledErrorImpl<T>(error.Type(), estimated, target, weights, &fit)) {
+                return *fused;
+            }
+            auto [a, b] = fit ? *fit
+                : weights.empty() ? FitLeastSquaresImpl<T>(estimated, target)
+                : FitLeastSquaresImpl<T>(estimated, target, weights);
+            std::ranges::transform(estimated, estimated.begin(), [a=a,b=b](auto x) -> auto { return (a * x) + b; });
+        }
+        return weights.empty() ? error(estimated, target) : error(estimated, target, weights);
+    }
+
     // Outlined skip-mode body. Keeping this out of `Evaluate`'s inline path
     // keeps the default (skipNonFinite_ == false) hot path small enough that
     // the compiler still inlines `Evaluate` into its caller -- the inlining
@@ -73,7 +231,8 @@ namespace {
     template<typename T>
     [[gnu::noinline]] auto
     SkipNonFiniteScore(ErrorMetric const& error, Operon::Span<T> estimated, Operon::Span<T const> target,
-                       Operon::Span<T const> weights, bool scaling, double penaltyWeight) -> Operon::Scalar
+                       Operon::Span<T const> weights, bool scaling, double penaltyWeight,
+                       double variance) -> Operon::Scalar
     {
         if (scaling) {
             auto [a, b, s] = weights.empty()
@@ -101,21 +260,10 @@ namespace {
         //   SSE is a *sum*, not an average, of squared errors, so a
         //   per-point variance-scale term alone would be ~N times too small
         //   -> variance * (finite point count)
-        double sumWeights = 0.0;
-        double mean = 0.0;
-        double m2 = 0.0;
-        for (auto i = std::size_t{0}; i < target.size(); ++i) {
-            auto const y = static_cast<double>(target[i]);
-            auto const w = weights.empty() ? 1.0 : static_cast<double>(weights[i]);
-            if (!std::isfinite(y) || !std::isfinite(w) || w == 0.0) { continue; }
-            auto const nextSumWeights = sumWeights + w;
-            auto const delta = y - mean;
-            auto const r = delta * w / nextSumWeights;
-            mean += r;
-            m2 += sumWeights * delta * r;
-            sumWeights = nextSumWeights;
-        }
-        auto const variance = sumWeights > 0.0 ? m2 / sumWeights : 0.0;
+        // `variance` is the (weighted, when weights are in use) variance of
+        // the finite targets. It only depends on the training range, so the
+        // caller reads it from the dataset's statistics cache rather than
+        // re-scanning the target on every evaluation.
         double scale{};
         switch (error.Type()) {
         case ErrorType::NMSE: scale = 1.0; break;
@@ -127,6 +275,56 @@ namespace {
         }
         return static_cast<Operon::Scalar>(value + penaltyWeight * scale * fraction);
     }
+
+    // Running lower bound on the final error of a partially interpreted
+    // individual (see Evaluator::SetEarlyAbortRows). Accumulates in double
+    // over the rows seen so far; with scaling it keeps the weighted
+    // co-moments of (estimated, target) so the prefix least-squares residual
+    // is available in closed form after every block.
+    class PrefixErrorBound {
+    public:
+        PrefixErrorBound(ErrorType type, bool scaling) : type_(type), scaling_(scaling) { }
+
+        template<typename T>
+        auto Add(Operon::Span<T const> x, Operon::Span<T const> y, Operon::Span<T const> w) -> void
+        {
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                auto const xi = static_cast<double>(x[i]);
+                auto const yi = static_cast<double>(y[i]);
+                auto const wi = w.empty() ? 1.0 : static_cast<double>(w[i]);
+                if (!std::isfinite(xi)) { finite_ = false; return; }
+                if (scaling_) {
+                    moments_.Add(xi, yi, wi);
+                } else {
+                    auto const e = xi - yi;
+                    sum_ += wi * (type_ == ErrorType::MAE ? std::abs(e) : e * e);
+                }
+            }
+        }
+
+        // `weightSum` and `variance` are the full-range normaliser of the
+        // metric (row count or sum of weights, target variance for NMSE).
+        [[nodiscard]] auto Value(double weightSum, double variance) const -> double
+        {
+            if (!finite_) { return std::numeric_limits<double>::infinity(); }
+            auto sse = sum_;
+            if (scaling_) {
+                // min over (a, b) of the prefix SSE; a constant prediction
+                // degenerates to the target's own spread, as in FitLeastSquares
+                auto const& m = moments_;
+                auto const a = m.Cxx > 0 ? m.Cxy / m.Cxx : 0.0;
+                sse = m.SquaredError(a, m.My - (a * m.Mx));
+            }
+            return detail::MetricFromMoments(type_, sse, weightSum, variance);
+        }
+
+    private:
+        ErrorType type_;
+        bool scaling_;
+        bool finite_{true};
+        double sum_{0};
+        detail::CoMoments moments_;
+    };
 } // namespace
 
     auto FitLeastSquares(Operon::Span<float const> estimated, Operon::Span<float const> target) noexcept -> std::pair<double, double> {
@@ -145,8 +343,28 @@ namespace {
         return FitLeastSquaresImpl<double>(estimated, target, weights);
     }
 
+    auto FitLeastSquares(Operon::Span<float const> estimated, Operon::Span<double const> target, Operon::Span<float const> weights) noexcept -> std::pair<double, double> {
+        detail::CoMoments m;
+        for (std::size_t i = 0; i < estimated.size(); ++i) {
+            m.Add(static_cast<double>(estimated[i]), target[i], weights.empty() ? 1.0 : static_cast<double>(weights[i]));
+        }
+        auto a = m.Cxy / m.Cxx; // scale
+        if (!std::isfinite(a)) {
+            a = 1;
+        }
+        return {a, m.My - (a * m.Mx)};
+    }
+
+    auto FusedScaledError(ErrorType type, Operon::Span<float const> estimated, Operon::Span<float const> target, Operon::Span<float const> weights) -> std::optional<double> {
+        return FusedScaledErrorImpl<float>(type, estimated, target, weights);
+    }
+
+    auto FusedScaledError(ErrorType type, Operon::Span<double const> estimated, Operon::Span<double const> target, Operon::Span<double const> weights) -> std::optional<double> {
+        return FusedScaledErrorImpl<double>(type, estimated, target, weights);
+    }
+
     template<> auto OPERON_EXPORT
-    Evaluator<ScalarDispatch>::Evaluate(Operon::RandomGenerator& /*rng*/, Individual const& ind, Operon::Span<Operon::Scalar> buf) const -> typename EvaluatorBase::ReturnType
+    Evaluator<ScalarDispatch>::ComputeFitness(Individual const& ind, Operon::Span<Operon::Scalar> buf) const -> Operon::Scalar
     {
         ++CallCount;
         auto const* problem = GetProblem();
@@ -157,11 +375,6 @@ namespace {
         auto const weightsOpt    = problem->Weights(trainingRange);
         auto const weights       = weightsOpt.value_or(Operon::Span<Operon::Scalar const>{});
 
-        auto const& tree = ind.Genotype;
-        auto const* dtable = GetDispatchTable();
-        TInterpreter const interpreter{dtable, dataset, &tree};
-
-        ++ResidualEvaluations;
         ENSURE(buf.size() >= trainingRange.Size());
         // EvaluatorBase::Evaluate's contract permits buf.size() >
         // trainingRange.Size() (a caller-owned scratch buffer sized for
@@ -174,22 +387,128 @@ namespace {
         // same pattern as MinimumDescriptionLengthEvaluator/
         // FractionalBayesFactorEvaluator/LikelihoodEvaluator in evaluator.hpp.
         auto estimatedValues = buf.subspan(0, trainingRange.Size());
-        auto coeff = tree.GetCoefficients();
-        interpreter.Evaluate(coeff, trainingRange, estimatedValues);
+        Predict(ind.Genotype, trainingRange, estimatedValues);
 
         Operon::Scalar fit{};
         if (skipNonFinite_) [[unlikely]] {
-            fit = SkipNonFiniteScore<Operon::Scalar>(error_, estimatedValues, targetValues, weights, scaling_, nonFinitePenaltyWeight_);
+            auto const targetStats = dataset->GetColumnStatistics(problem->TargetVariable().Index, trainingRange, /*weighted=*/!weights.empty());
+            auto const targetVariance = targetStats.Count > 0 ? targetStats.Variance : 0.0;
+            fit = SkipNonFiniteScore<Operon::Scalar>(error_, estimatedValues, targetValues, weights, scaling_, nonFinitePenaltyWeight_, targetVariance);
         } else {
-            if (scaling_) {
-                auto [a, b] = weights.empty()
-                    ? FitLeastSquaresImpl<Operon::Scalar>(estimatedValues, targetValues)
-                    : FitLeastSquaresImpl<Operon::Scalar>(estimatedValues, targetValues, weights);
-                std::ranges::transform(estimatedValues, estimatedValues.begin(), [a=a,b=b](auto x) -> auto { return (a * x) + b; });
+            fit = static_cast<Operon::Scalar>(ScoreEstimates<Operon::Scalar>(error_, estimatedValues, targetValues, weights, scaling_, problem->WideTargetValues(trainingRange)));
+        }
+
+        if (!std::isfinite(fit)) {
+            fit = EvaluatorBase::ErrMax;
+        }
+        return fit;
+    }
+
+    template<> auto OPERON_EXPORT
+    Evaluator<ScalarDispatch>::EvaluateInto(Operon::RandomGenerator& /*rng*/, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Span<Operon::Scalar> fitness) const -> void
+    {
+        ENSURE(fitness.size() == 1);
+        fitness.front() = ComputeFitness(ind, buf);
+    }
+
+    template<> auto OPERON_EXPORT
+    Evaluator<ScalarDispatch>::EvaluateBounded(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Scalar threshold) const -> typename EvaluatorBase::ReturnType
+    {
+        auto const* problem = GetProblem();
+        auto const* dataset = problem->GetDataset();
+        auto const trainingRange = problem->TrainingRange();
+        auto const n = trainingRange.Size();
+
+        if (earlyAbortRows_ == 0 || !(threshold < EvaluatorBase::ErrMax) || n <= earlyAbortRows_) {
+            return Evaluate(rng, ind, buf);
+        }
+
+        auto const targetValues = problem->TargetValues(trainingRange);
+        auto const weightsOpt   = problem->Weights(trainingRange);
+        auto const weights      = weightsOpt.value_or(Operon::Span<Operon::Scalar const>{});
+
+        auto const weightSum = weights.empty()
+            ? static_cast<double>(n)
+            : std::reduce(weights.begin(), weights.end(), 0.0);
+        auto variance { 1.0 };
+        if (error_.Type() == ErrorType::NMSE) {
+            variance = dataset->GetColumnStatistics(problem->TargetVariable().Index, trainingRange, /*weighted=*/!weights.empty()).Variance;
+        }
+        if (!(weightSum > 0) || !(variance > 0)) {
+            return Evaluate(rng, ind, buf); // degenerate normaliser: no meaningful bound
+        }
+
+        ++CallCount;
+        ++ResidualEvaluations;
+        ENSURE(buf.size() >= n);
+        // see ComputeFitness for why the buffer is sliced to the range
+        auto estimatedValues = buf.subspan(0, n);
+        auto const& tree = ind.Genotype;
+        auto coeff = tree.GetCoefficients();
+        TInterpreter const interpreter{GetDispatchTable(), dataset, &tree};
+
+        // The bound is computed in double while the final metric is computed
+        // in Operon::Scalar, so it is only trusted beyond a small relative
+        // margin: a borderline individual is scored in full instead.
+        constexpr auto margin { 1e-4 };
+        auto const limit = static_cast<double>(threshold) + (margin * std::abs(static_cast<double>(threshold)));
+
+        PrefixErrorBound bound(error_.Type(), scaling_);
+        auto block = earlyAbortRows_;
+        for (std::size_t done = 0; done < n; block *= 2) {
+            auto const len = std::min(block, n - done);
+            auto const start = trainingRange.Start() + done;
+            auto out = estimatedValues.subspan(done, len);
+            interpreter.Evaluate(coeff, Range{start, start + len}, out);
+            bound.Add<Operon::Scalar>(out, targetValues.subspan(done, len), weights.empty() ? weights : weights.subspan(done, len));
+            done += len;
+
+            if (done < n && bound.Value(weightSum, variance) > limit) {
+                ++RejectedEvaluations;
+                SavedRowEvaluations += n - done;
+                return typename EvaluatorBase::ReturnType{ EvaluatorBase::ErrMax };
             }
-            fit = static_cast<Operon::Scalar>(weights.empty() ? error_(estimatedValues, targetValues) : error_(estimatedValues, targetValues, weights));
         }
 
+        // every row was interpreted: score exactly as Evaluate does
+        auto fit = static_cast<Operon::Scalar>(ScoreEstimates<Operon::Scalar>(error_, estimatedValues, targetValues, weights, scaling_, problem->WideTargetValues(trainingRange)));
+        if (!std::isfinite(fit)) {
+            fit = EvaluatorBase::ErrMax;
+        }
+        return typename EvaluatorBase::ReturnType{ fit };
+    }
+
+    template<> auto OPERON_EXPORT
+    Evaluator<ScalarDispatch>::EvaluateRange(Operon::RandomGenerator& /*rng*/, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Range range) const -> std::optional<typename EvaluatorBase::ReturnType>
+    {
+        auto const* problem = GetProblem();
+        auto const targetValues = problem->TargetValues(range);
+        auto const weightsOpt   = problem->Weights(range);
+        auto const weights      = weightsOpt.value_or(Operon::Span<Operon::Scalar const>{});
+
+        auto const& tree = ind.Genotype;
+        TInterpreter const interpreter{GetDispatchTable(), problem->GetDataset(), &tree};
+        ENSURE(buf.size() >= range.Size());
+        auto estimatedValues = buf.subspan(0, range.Size());
+        auto coeff = tree.GetCoefficients();
+        interpreter.Evaluate(coeff, range, estimatedValues);
+
+        Operon::Scalar fit{};
+        if (skipNonFinite_) {
+            // windows are arbitrary, so the (weighted) variance of the finite
+            // targets is computed here rather than going through, and filling
+            // up, the dataset's statistics cache
+            detail::CoMoments moments;
+            for (std::size_t i = 0; i < targetValues.size(); ++i) {
+                auto const y = static_cast<double>(targetValues[i]);
+                if (!std::isfinite(y)) { continue; }
+                moments.Add(y, y, weights.empty() ? 1.0 : static_cast<double>(weights[i]));
+            }
+            auto const variance = moments.Sw > 0 ? moments.Cyy / moments.Sw : 0.0;
+            fit = SkipNonFiniteScore<Operon::Scalar>(error_, estimatedValues, targetValues, weights, scaling_, nonFinitePenaltyWeight_, variance);
+        } else {
+            fit = static_cast<Operon::Scalar>(ScoreEstimates<Operon::Scalar>(error_, estimatedValues, targetValues, weights, scaling_, problem->WideTargetValues(range)));
+        }
         if (!std::isfinite(fit)) {
             fit = EvaluatorBase::ErrMax;
         }
@@ -210,8 +529,9 @@ namespace {
     }
 
     auto
-    DiversityEvaluator::Evaluate(Operon::RandomGenerator& random, Individual const& ind, Operon::Span<Operon::Scalar>  /*buf*/) const -> typename EvaluatorBase::ReturnType
+    DiversityEvaluator::EvaluateInto(Operon::RandomGenerator& random, Individual const& ind, Operon::Span<Operon::Scalar>  /*buf*/, Operon::Span<Operon::Scalar> fitness) const -> void
     {
+        ENSURE(fitness.size() == 1);
         (void)ind.Genotype.Hash(hashmode_);
         Operon::Vector<Operon::Hash> lhs(ind.Genotype.Length());
         auto const& nodes = ind.Genotype.Nodes();
@@ -225,14 +545,68 @@ namespace {
             auto const& rhs = Operon::Random::Sample(random, values.begin(), values.end())->second;
             distance += static_cast<Operon::Scalar>(Operon::Distance::Jaccard(lhs, rhs));
         }
-        return EvaluatorBase::ReturnType { -distance / static_cast<Operon::Scalar>(sampleSize_) };
+        fitness.front() = -distance / static_cast<Operon::Scalar>(sampleSize_);
     }
 
-    auto
-    MultiEvaluator::Evaluate(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf) const -> typename EvaluatorBase::ReturnType
+    namespace {
+        // one share per thread: MultiEvaluator calls on different threads
+        // score different individuals
+        auto ThreadShare() -> PredictionShare&
+        {
+            thread_local PredictionShare share;
+            return share;
+        }
+    } // namespace
+
+    PredictionShare::Scope::Scope(Operon::Tree const* tree)
     {
-        using vstat::univariate::accumulate;
+        auto& share = ThreadShare();
+        if (share.tree_ == nullptr) {
+            share.Open(tree);
+            owner_ = true;
+        }
+    }
 
+    PredictionShare::Scope::~Scope()
+    {
+        if (owner_) { ThreadShare().tree_ = nullptr; }
+    }
+
+    auto PredictionShare::Open(Operon::Tree const* tree) -> void
+    {
+        tree_ = tree;
+        dataset_ = nullptr;
+        size_ = 0;
+        jacobianSize_ = 0;
+    }
+
+    auto PredictionShare::Find(Operon::Tree const* tree, Operon::Dataset const* dataset, Operon::Range range) -> PredictionShare*
+    {
+        auto& share = ThreadShare();
+        if (share.tree_ == nullptr || share.tree_ != tree) { return nullptr; }
+        if (share.dataset_ != nullptr && (share.dataset_ != dataset || !(share.range_ == range))) { return nullptr; }
+        return &share;
+    }
+
+    auto PredictionShare::Publish(Operon::Dataset const* dataset, Operon::Range range, Operon::Span<Operon::Scalar const> values, Operon::Span<Operon::Scalar const> jacobian) -> void
+    {
+        dataset_ = dataset;
+        range_ = range;
+        if (values_.size() < values.size()) { values_.resize(values.size()); }
+        std::ranges::copy(values, values_.begin());
+        size_ = values.size();
+        if (!jacobian.empty()) {
+            if (jacobian_.size() < jacobian.size()) { jacobian_.resize(jacobian.size()); }
+            std::ranges::copy(jacobian, jacobian_.begin());
+        }
+        // a values-only publish after a Jacobian one keeps the Jacobian: both
+        // come from the same coefficients
+        jacobianSize_ = jacobian.empty() ? jacobianSize_ : jacobian.size();
+    }
+
+    auto
+    MultiEvaluator::EvaluateInto(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Span<Operon::Scalar> fitness) const -> void
+    {
         // CallCount tracks "this evaluator instance scored one individual" at
         // every composition depth, not just the leaf Evaluator<DTable> - a
         // caller (e.g. OffspringSelectionGenerator::SelectionPressure) reading
@@ -243,42 +617,72 @@ namespace {
         // sub-evaluator work done" profiling figure, not a substitute for this.
         ++CallCount;
 
-        EvaluatorBase::ReturnType fit;
-        fit.reserve(SubEvaluatorObjectiveCount());
+        if (!aggregateType_) {
+            ENSURE(fitness.size() == SubEvaluatorObjectiveCount());
+            EvaluateObjectives(rng, ind, buf, fitness);
+            return;
+        }
+
+        ENSURE(fitness.size() == 1);
+        FitnessVector objectives(SubEvaluatorObjectiveCount());
+        EvaluateObjectives(rng, ind, buf, objectives);
+        fitness.front() = Aggregate(objectives);
+    }
 
-        for (auto const& ev: evaluators_) {
-            auto f = (*ev)(rng, ind, buf);
-            std::copy(f.begin(), f.end(), std::back_inserter(fit));
+    auto
+    MultiEvaluator::EvaluateObjectives(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Span<Operon::Scalar> objectives) const -> void
+    {
+        // The sub-evaluators score the same individual, so the first one to
+        // interpret it publishes its predictions and the others reuse them
+        // (see PredictionShare). Evaluators that also need the Jacobian go
+        // first: their traced pass produces both, whereas a values-only pass
+        // would leave them to interpret the tree again. Objectives are still
+        // reported in the order the evaluators were added.
+        PredictionShare::Scope const scope{&ind.Genotype};
+
+        for (auto pass : { true, false }) {
+            auto offset{0UL};
+            for (auto const& evaluator : evaluators_) {
+                auto const count = evaluator->ObjectiveCount();
+                if (evaluator->UsesJacobian() == pass) {
+                    evaluator->EvaluateInto(rng, ind, buf, objectives.subspan(offset, count));
+                }
+                offset += count;
+            }
         }
+    }
 
-        if (!aggregateType_) { return fit; }
+    auto
+    MultiEvaluator::Aggregate(Operon::Span<Operon::Scalar> objectives) const -> Operon::Scalar
+    {
+        using vstat::univariate::accumulate;
 
         switch(*aggregateType_) {
             case AggregateType::Min: {
-                return { *std::ranges::min_element(fit) };
+                return *std::ranges::min_element(objectives);
             }
             case AggregateType::Max: {
-                return { *std::ranges::max_element(fit) };
+                return *std::ranges::max_element(objectives);
             }
             case AggregateType::Median: {
-                auto const sz { std::ssize(fit) };
-                auto const a = fit.begin() + sz / 2;
-                std::nth_element(fit.begin(), a, fit.end());
+                auto const sz { std::ssize(objectives) };
+                auto const a = objectives.begin() + sz / 2;
+                std::nth_element(objectives.begin(), a, objectives.end());
                 if (sz % 2 == 0) {
-                    auto const b = std::max_element(fit.begin(), a);
-                    return { (*a + *b) / 2 };
+                    auto const b = std::max_element(objectives.begin(), a);
+                    return (*a + *b) / 2;
                 }
-                return { *a };
+                return *a;
             }
             case AggregateType::Mean: {
-                return { static_cast<Operon::Scalar>(accumulate<Operon::Scalar>(fit.begin(), fit.end()).mean) };
+                return static_cast<Operon::Scalar>(accumulate<Operon::Scalar>(objectives.begin(), objectives.end()).mean);
             }
             case AggregateType::HarmonicMean: {
-                auto stats = accumulate<Operon::Scalar>(fit.begin(), fit.end(), [](auto x) -> auto { return 1/x; });
-                return { static_cast<Operon::Scalar>(stats.count / stats.sum) };
+                auto stats = accumulate<Operon::Scalar>(objectives.begin(), objectives.end(), [](auto x) -> auto { return 1/x; });
+                return static_cast<Operon::Scalar>(stats.count / stats.sum);
             }
             case AggregateType::Sum: {
-                return { static_cast<Operon::Scalar>(vstat::univariate::accumulate<Operon::Scalar>(fit.begin(), fit.end()).sum) };
+                return static_cast<Operon::Scalar>(accumulate<Operon::Scalar>(objectives.begin(), objectives.end()).sum);
             }
             default: {
                 throw std::runtime_error("Unknown AggregateType");
@@ -287,23 +691,206 @@ namespace {
     }
 
     template<> auto OPERON_EXPORT
-    BayesianInformationCriterionEvaluator<ScalarDispatch>::Evaluate(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf) const -> typename EvaluatorBase::ReturnType {
+    BayesianInformationCriterionEvaluator<ScalarDispatch>::EvaluateInto(Operon::RandomGenerator& /*rng*/, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Span<Operon::Scalar> fitness) const -> void {
+        ENSURE(fitness.size() == 1);
         auto const& tree = ind.Genotype;
         auto p = static_cast<Operon::Scalar>(std::ranges::count_if(tree.Nodes(), &Operon::Node::Optimize));
         auto n = static_cast<Operon::Scalar>(Evaluator::GetProblem()->TrainingRange().Size());
-        auto mse = Evaluator::Evaluate(rng, ind, buf).front();
+        auto mse = ComputeFitness(ind, buf);
         auto bic = (n * std::log(mse)) + (p * std::log(n));
         if (!std::isfinite(bic)) { bic = EvaluatorBase::ErrMax; }
-        return typename EvaluatorBase::ReturnType { static_cast<Operon::Scalar>(bic) };
+        fitness.front() = static_cast<Operon::Scalar>(bic);
     }
 
     template<> auto OPERON_EXPORT
-    AkaikeInformationCriterionEvaluator<ScalarDispatch>::Evaluate(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf) const -> typename EvaluatorBase::ReturnType {
-        auto mse = Evaluator::Evaluate(rng, ind, buf).front();
+    AkaikeInformationCriterionEvaluator<ScalarDispatch>::EvaluateInto(Operon::RandomGenerator& /*rng*/, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Span<Operon::Scalar> fitness) const -> void {
+        ENSURE(fitness.size() == 1);
+        auto mse = ComputeFitness(ind, buf);
         auto n = static_cast<Operon::Scalar>(Evaluator::GetProblem()->TrainingRange().Size());
         auto aik = n/2 * (std::log(Operon::Math::Tau) + std::log(mse) + 1);
         if (!std::isfinite(aik)) { aik = EvaluatorBase::ErrMax; }
-        return typename EvaluatorBase::ReturnType { static_cast<Operon::Scalar>(aik) };
+        fitness.front() = static_cast<Operon::Scalar>(aik);
+    }
+
+    template<> auto OPERON_EXPORT
+    CrossValidationEvaluator<ScalarDispatch>::EvaluateInto(Operon::RandomGenerator& /*rng*/, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Span<Operon::Scalar> fitness) const -> void {
+        ENSURE(fitness.size() == ObjectiveCount());
+        ++CallCount;
+
+        auto const* problem = GetProblem();
+        auto const range = problem->TrainingRange();
+        auto const n = range.Size();
+        ENSURE(buf.size() >= n);
+        ENSURE(n >= folds_);
+
+        // one forward pass over the union of the folds (see ComputeFitness for
+        // the slicing), streamed into per-fold moments
+        auto const estimated = buf.subspan(0, n);
+        Predict(ind.Genotype, range, estimated);
+        auto const target = problem->TargetValues(range);
+        auto const weightsOpt = problem->Weights(range);
+        auto const weights = weightsOpt.value_or(Operon::Span<Operon::Scalar const>{});
+
+        SmallVector<detail::CoMoments, 16> moments(folds_); // NOLINT(readability-magic-numbers)
+        for (auto k = 0UL; k < folds_; ++k) {
+            auto& m = moments[k];
+            for (auto i = k * n / folds_, end = (k + 1) * n / folds_; i < end; ++i) {
+                auto const x = static_cast<double>(estimated[i]);
+                if (!std::isfinite(x)) {
+                    std::ranges::fill(fitness, EvaluatorBase::ErrMax);
+                    return;
+                }
+                m.Add(x, static_cast<double>(target[i]), weights.empty() ? 1.0 : static_cast<double>(weights[i]));
+            }
+        }
+
+        auto const type = GetErrorMetric().Type();
+        SmallVector<double, 16> errors(folds_); // NOLINT(readability-magic-numbers)
+        for (auto k = 0UL; k < folds_; ++k) {
+            // least-squares fit on the other folds, as FitLeastSquares would
+            // compute it from their rows
+            auto a{1.0};
+            auto b{0.0};
+            if (LinearScaling()) {
+                detail::CoMoments train;
+                for (auto j = 0UL; j < folds_; ++j) {
+                    if (j != k) { train.Merge(moments[j]); }
+                }
+                a = train.Cxy / train.Cxx;
+                if (!std::isfinite(a)) { a = 1; }
+                b = train.My - (a * train.Mx);
+            }
+
+            // held-out sum of squares of y - (a x + b) over fold k, scored
+            // against the fold's own weight and target variance
+            auto const& m = moments[k];
+            errors[k] = detail::MetricFromMoments(type, m.SquaredError(a, b), m.Sw, m.Cyy / m.Sw);
+        }
+
+        auto const k = static_cast<double>(folds_);
+        auto const mean = std::reduce(errors.begin(), errors.end()) / k;
+        auto const deviation = std::sqrt(std::transform_reduce(errors.begin(), errors.end(), 0.0, std::plus{},
+            [mean](auto e) -> double { return (e - mean) * (e - mean); }) / (k - 1));
+
+        fitness.front() = std::isfinite(mean) ? static_cast<Operon::Scalar>(mean) : EvaluatorBase::ErrMax;
+        if (reportDeviation_) {
+            fitness.back() = std::isfinite(mean) && std::isfinite(deviation) ? static_cast<Operon::Scalar>(deviation) : EvaluatorBase::ErrMax;
+        }
+    }
+
+    template<> auto OPERON_EXPORT
+    SubsampledEvaluator<ScalarDispatch>::Resample() const -> void {
+        auto const* problem = GetProblem();
+        auto const* dataset = problem->GetDataset();
+        auto const range = problem->TrainingRange();
+        auto const n = range.Size();
+        auto const m = rows_;
+        if (m >= n) { // the full range: Evaluator scores it in place
+            if (subset_) { ++epoch_; }
+            sample_ = {};
+            target_ = {};
+            weights_ = {};
+            column_ = {};
+            subset_.reset();
+            return;
+        }
+        ++epoch_;
+        auto const datasetWeights = problem->Weights(range);
+
+        // one row per stratum [k n / m, (k + 1) n / m), weighted by the
+        // stratum size (the inverse inclusion probability)
+        sample_.resize(m);
+        weights_.resize(m);
+        for (auto k = 0UL; k < m; ++k) {
+            auto const begin = k * n / m;
+            auto const end = (k + 1) * n / m;
+            auto const i = std::uniform_int_distribution<std::size_t>{begin, end - 1}(random_);
+            sample_[k] = range.Start() + i;
+            auto const w = static_cast<Operon::Scalar>(end - begin);
+            weights_[k] = datasetWeights ? w * (*datasetWeights)[i] : w;
+        }
+
+        auto const targetValues = problem->TargetValues(range);
+        target_.resize(m);
+        std::ranges::transform(sample_, target_.begin(), [&](auto r) { return targetValues[r - range.Start()]; });
+
+        auto variables = dataset->GetVariables();
+        std::ranges::sort(variables, std::less{}, &Variable::Index);
+
+        // same size as the last sample: overwrite its columns in place
+        if (subset_ && subset_->Rows<std::size_t>() == m) {
+            column_.resize(m);
+            for (auto const& v : variables) {
+                auto const values = dataset->GetValues(v.Index);
+                std::ranges::transform(sample_, column_.begin(), [&](auto r) { return values[r]; });
+                subset_->SetValues(v.Hash, Range{0, m}, column_);
+            }
+            return;
+        }
+
+        std::vector<std::string> names;
+        std::vector<std::vector<Operon::Scalar>> columns;
+        names.reserve(variables.size());
+        columns.reserve(variables.size());
+        for (auto const& v : variables) {
+            auto const values = dataset->GetValues(v.Index);
+            auto& column = columns.emplace_back(m);
+            std::ranges::transform(sample_, column.begin(), [&](auto r) { return values[r]; });
+            names.push_back(v.Name);
+        }
+        subset_.emplace(names, columns);
+    }
+
+    template<> auto OPERON_EXPORT
+    SubsampledEvaluator<ScalarDispatch>::Prepare(Operon::Span<Individual const> pop) const -> void {
+        auto const n = GetProblem()->TrainingRange().Size();
+        if (rows_ < n && growth_ > 1.0) {
+            std::vector<Operon::Scalar> fit;
+            fit.reserve(pop.size());
+            for (auto const& ind : pop) {
+                if (ind.Size() > 0 && std::isfinite(ind[0]) && ind[0] < EvaluatorBase::ErrMax) { fit.push_back(ind[0]); }
+            }
+            if (fit.size() > 1) {
+                auto const mid = fit.begin() + static_cast<std::ptrdiff_t>(fit.size() / 2);
+                std::ranges::nth_element(fit, mid);
+                auto const median = static_cast<double>(*mid);
+                auto const best = static_cast<double>(*std::ranges::min_element(fit.begin(), mid + 1));
+                auto const spread = (median - best) / std::max(std::abs(median), std::numeric_limits<double>::min());
+                auto noise = [](auto rows) { return std::sqrt(2.0 / static_cast<double>(rows)); };
+                while (rows_ < n && spread < noise(rows_)) {
+                    rows_ = std::min(n, std::max(rows_ + 1, static_cast<std::size_t>(std::ceil(static_cast<double>(rows_) * growth_))));
+                }
+            }
+        }
+        Resample();
+    }
+
+    template<> auto OPERON_EXPORT
+    SubsampledEvaluator<ScalarDispatch>::ScoreSample(Individual const& ind, Operon::Span<Operon::Scalar> buf) const -> Operon::Scalar {
+        ++CallCount;
+        auto const m = sample_.size();
+        auto const n = GetProblem()->TrainingRange().Size();
+        ENSURE(buf.size() >= m);
+
+        auto const& tree = ind.Genotype;
+        auto estimated = buf.subspan(0, m);
+        TInterpreter const interpreter{GetDispatchTable(), &*subset_, &tree};
+        interpreter.Evaluate(tree.GetCoefficients(), Range{0, m}, estimated);
+
+        // charge whole training-range passes as the sampled rows add up to them
+        auto const before = interpretedRows_.fetch_add(m, std::memory_order_relaxed);
+        ResidualEvaluations += ((before + m) / n) - (before / n);
+        SavedRowEvaluations += n - m;
+
+        auto fit = static_cast<Operon::Scalar>(ScoreEstimates<Operon::Scalar>(GetErrorMetric(), estimated, target_, weights_, LinearScaling()));
+        return std::isfinite(fit) ? fit : EvaluatorBase::ErrMax;
+    }
+
+    template<> auto OPERON_EXPORT
+    SubsampledEvaluator<ScalarDispatch>::EvaluateInto(Operon::RandomGenerator& rng, Individual const& ind, Operon::Span<Operon::Scalar> buf, Operon::Span<Operon::Scalar> fitness) const -> void {
+        if (Full()) { Evaluator::EvaluateInto(rng, ind, buf, fitness); return; }
+        ENSURE(fitness.size() == 1);
+        fitness.front() = ScoreSample(ind, buf);
     }
 
     auto LocalSearch(Operon::RandomGenerator& random, Operon::Individual& ind, Operon::EvaluatorBase const& evaluator, Operon::CoefficientOptimizer const* coeffOptimizer, double pLocal, double pLamarck) -> std::optional<std::vector<Operon::Scalar>>
@@ -325,10 +912,66 @@ namespace {
         return BernoulliTrial{pLamarck}(random) ? std::nullopt : std::make_optional(std::move(c));
     }
 
-    auto ScoreIndividual(Operon::RandomGenerator& random, Operon::Individual& ind, Operon::EvaluatorBase const& evaluator, Operon::CoefficientOptimizer const* coeffOptimizer, double pLocal, double pLamarck, Operon::Span<Operon::Scalar> buf) -> void
+    auto LocalSearchBatch(Operon::Span<Operon::RandomGenerator> random, Operon::Span<Operon::Individual> individuals, Operon::EvaluatorBase const& evaluator, Operon::CoefficientOptimizer const* coeffOptimizer, double pLocal, double pLamarck) -> std::vector<std::optional<std::vector<Operon::Scalar>>>
+    {
+        using BernoulliTrial = std::bernoulli_distribution;
+        EXPECT(random.size() == individuals.size());
+
+        std::vector<std::optional<std::vector<Operon::Scalar>>> original(individuals.size());
+        if (coeffOptimizer == nullptr || pLocal <= 0) { return original; }
+
+        std::vector<std::size_t> selected;
+        for (auto i = 0UL; i < individuals.size(); ++i) {
+            if (BernoulliTrial{pLocal}(random[i])) { selected.push_back(i); }
+        }
+        if (selected.empty()) { return original; }
+
+        // the optimizer wants contiguous trees and generators; move them out
+        // and back so every individual keeps its own random stream
+        std::vector<Operon::Tree> trees;
+        std::vector<Operon::RandomGenerator> rngs;
+        trees.reserve(selected.size());
+        rngs.reserve(selected.size());
+        for (auto i : selected) {
+            original[i] = individuals[i].Genotype.GetCoefficients();
+            trees.push_back(std::move(individuals[i].Genotype));
+            rngs.push_back(random[i]);
+        }
+
+        auto t0 = std::chrono::steady_clock::now();
+        auto outcomes = coeffOptimizer->OptimizeBatch(rngs, trees);
+        auto t1 = std::chrono::steady_clock::now();
+        evaluator.CostFunctionTime += std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+
+        for (auto k = 0UL; k < selected.size(); ++k) {
+            auto const i = selected[k];
+            auto const& diag = Diagnostics(outcomes[k]);
+            evaluator.ResidualEvaluations += diag.FunctionEvaluations;
+            evaluator.JacobianEvaluations += diag.JacobianEvaluations;
+            individuals[i].Genotype = std::move(trees[k]);
+            random[i] = rngs[k];
+            if (BernoulliTrial{pLamarck}(random[i])) { original[i].reset(); }
+        }
+        return original;
+    }
+
+    auto ScoreIndividual(Operon::RandomGenerator& random, Operon::Individual& ind, Operon::EvaluatorBase const& evaluator, Operon::CoefficientOptimizer const* coeffOptimizer, double pLocal, double pLamarck, Operon::Span<Operon::Scalar> buf, Operon::Scalar threshold, std::vector<Operon::Scalar>* scoredCoefficients) -> void
+    {
+        auto const originalCoeffs = LocalSearch(random, ind, evaluator, coeffOptimizer, pLocal, pLamarck);
+        ScoreOptimized(random, ind, evaluator, originalCoeffs, buf, threshold, scoredCoefficients);
+    }
+
+    auto ScoreOptimized(Operon::RandomGenerator& random, Operon::Individual& ind, Operon::EvaluatorBase const& evaluator, std::optional<std::vector<Operon::Scalar>> const& originalCoeffs, Operon::Span<Operon::Scalar> buf, Operon::Scalar threshold, std::vector<Operon::Scalar>* scoredCoefficients) -> void
     {
-        auto originalCoeffs = LocalSearch(random, ind, evaluator, coeffOptimizer, pLocal, pLamarck);
-        ind.Fitness = evaluator(random, ind, buf);
+        if (threshold < EvaluatorBase::ErrMax) {
+            ind.Fitness = evaluator.EvaluateBounded(random, ind, buf, threshold);
+        } else {
+            // scored in place: for up to FitnessVector::InlineCapacity
+            // objectives neither the fitness nor its return path allocates
+            ind.Fitness.resize(evaluator.ObjectiveCount());
+            evaluator.EvaluateInto(random, ind, buf, ind.Fitness);
+        }
+        if (scoredCoefficients != nullptr) { ind.Genotype.GetCoefficients(*scoredCoefficients); }
         if (originalCoeffs) { ind.Genotype.SetCoefficients(*originalCoeffs); }
 
         for (auto& v : ind.Fitness) {
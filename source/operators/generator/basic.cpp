@@ -4,10 +4,26 @@
 
 #include "operon/operators/generator.hpp"
 
+#include "operon/core/contracts.hpp"
+
 namespace Operon {
     auto BasicOffspringGenerator::operator()(Operon::RandomGenerator& random, double pCrossover, double pMutation, double pLocal, double pLamarck, Operon::Span<Operon::Scalar> buf) const -> std::optional<Individual>
     {
         auto res = OffspringGeneratorBase::Generate(random, pCrossover, pMutation, pLocal, pLamarck, buf);
         return res.Child;
     }
+
+    auto BasicOffspringGenerator::GenerateBatch(Operon::Span<Operon::RandomGenerator> rngs, double pCrossover, double pMutation, double pLocal, double pLamarck, Operon::Span<Operon::Scalar> buf, Operon::Span<Individual> offspring) const -> std::vector<std::uint8_t>
+    {
+        EXPECT(rngs.size() == offspring.size());
+        std::vector<RecombinationResult> results(offspring.size());
+        for (auto i = 0UL; i < offspring.size(); ++i) {
+            Breed(rngs[i], pCrossover, pMutation, results[i]);
+        }
+        ScoreBatch(rngs, pLocal, pLamarck, buf, results);
+        for (auto i = 0UL; i < offspring.size(); ++i) {
+            offspring[i] = std::move(*results[i].Child);
+        }
+        return std::vector<std::uint8_t>(offspring.size(), 1);
+    }
 } // namespace Operon
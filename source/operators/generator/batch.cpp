@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright 2019-2025 Heal Research
+// SPDX-FileCopyrightText: Copyright 2025-present Bogdan Burlacu and contributors
+
+#include "operon/operators/generator.hpp"
+
+#include <algorithm>
+#include <functional>
+
+#include "operon/core/contracts.hpp"
+
+namespace Operon {
+
+    auto OffspringGeneratorBase::GenerateBatch(Operon::Span<Operon::RandomGenerator> rngs, double pCrossover, double pMutation, double pLocal, double pLamarck, Operon::Span<Operon::Scalar> buf, Operon::Span<Individual> offspring) const -> std::vector<std::uint8_t>
+    {
+        EXPECT(rngs.size() == offspring.size());
+        std::vector<std::uint8_t> filled(offspring.size(), 0);
+        for (auto i = 0UL; i < offspring.size(); ++i) {
+            if (auto child = (*this)(rngs[i], pCrossover, pMutation, pLocal, pLamarck, buf); child) {
+                offspring[i] = std::move(*child);
+                filled[i] = 1;
+            }
+        }
+        return filled;
+    }
+
+    auto OffspringGeneratorBase::ScoreBatch(Operon::Span<Operon::RandomGenerator> rngs, double pLocal, double pLamarck, Operon::Span<Operon::Scalar> buf, Operon::Span<RecombinationResult> results) const -> void
+    {
+        EXPECT(rngs.size() == results.size());
+
+        // all lookups come first, so the candidates of a block do not find
+        // each other in the caches
+        std::vector<std::optional<Pending>> pending(results.size());
+        std::vector<std::size_t> open;
+        for (auto i = 0UL; i < results.size(); ++i) {
+            pending[i] = Lookup(rngs[i], pLocal, pLamarck, results[i]);
+            if (pending[i]) { open.push_back(i); }
+        }
+
+        // one LocalSearchBatch per iteration budget; the optimizer reads the
+        // budget from the calling thread (LocalSearchBudget::Scope)
+        std::ranges::stable_sort(open, std::less{}, [&](auto i) { return pending[i]->Iterations; });
+        std::vector<std::optional<std::vector<Operon::Scalar>>> original(results.size());
+        std::vector<Individual> block;
+        std::vector<Operon::RandomGenerator> blockRngs;
+        for (auto it = open.begin(); it != open.end();) {
+            auto const iterations = pending[*it]->Iterations;
+            auto end = std::find_if(it, open.end(), [&](auto i) { return pending[i]->Iterations != iterations; });
+
+            block.clear();
+            blockRngs.clear();
+            for (auto k = it; k != end; ++k) {
+                block.push_back(std::move(*results[*k].Child));
+                blockRngs.push_back(rngs[*k]);
+            }
+
+            std::optional<LocalSearchBudget::Scope> budget;
+            if (iterations) { budget.emplace(*iterations); }
+            auto coefficients = LocalSearchBatch(blockRngs, block, *Evaluator(), coeffOptimizer_, pLocal, pLamarck);
+            budget.reset();
+
+            for (auto k = 0UL; it != end; ++it, ++k) {
+                results[*it].Child = std::move(block[k]);
+                rngs[*it] = blockRngs[k];
+                original[*it] = std::move(coefficients[k]);
+            }
+        }
+
+        for (auto i : open) {
+            Finish(rngs[i], buf, results[i], *pending[i], original[i]);
+        }
+    }
+} // namespace Operon
@@ -22,8 +22,23 @@ namespace Operon {
             return res ? res.Child.value() : res.Parent1.value();
         };
 
-        std::vector<Individual> offspring(broodSize_);
-        std::generate(offspring.begin(), offspring.end(), makeOffspring);
+        std::vector<Individual> offspring;
+        if (RacingEnabled()) {
+            // breed the whole brood first, then race it: only the finalists
+            // are optimized and scored on the full training range
+            std::vector<RecombinationResult> brood(broodSize_);
+            for (auto& res : brood) {
+                res.Parent1 = p1;
+                res.Parent2 = p2;
+                Breed(random, pCrossover, pMutation, res);
+            }
+            for (auto i : Race(random, pLocal, pLamarck, buf, brood)) {
+                offspring.push_back(std::move(*brood[i].Child));
+            }
+        } else {
+            offspring.resize(broodSize_);
+            std::generate(offspring.begin(), offspring.end(), makeOffspring);
+        }
         SingleObjectiveComparison comp{0};
 
         if (pop.front().Size() > 1) {
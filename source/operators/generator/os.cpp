@@ -5,19 +5,38 @@
 #include "operon/operators/generator.hpp"
 #include "operon/core/comparison.hpp"
 
+#include <algorithm>
+#include <functional>
+#include <ranges>
+#include <vector>
+
 namespace Operon {
 
     auto OffspringSelectionGenerator::operator()(Operon::RandomGenerator& random, double pCrossover, double pMutation, double pLocal, double pLamarck, Operon::Span<Operon::Scalar> buf) const -> std::optional<Individual>
     {
-        auto res = OffspringGeneratorBase::Generate(random, pCrossover, pMutation, pLocal, pLamarck, buf);
+        RecombinationResult res;
+        if (RacingEnabled() && Racing().Candidates > 1 && Evaluator()->ObjectiveCount() == 1) {
+            // race several children of the same parents and put only the
+            // best finalist up against the acceptance criterion below
+            std::vector<RecombinationResult> field(Racing().Candidates);
+            Breed(random, pCrossover, pMutation, field.front());
+            for (auto& r : field | std::views::drop(1)) {
+                r.Parent1 = field.front().Parent1;
+                r.Parent2 = field.front().Parent2;
+                Breed(random, pCrossover, pMutation, r);
+            }
+            auto const finalists = Race(random, pLocal, pLamarck, buf, field);
+            auto const best = *std::ranges::min_element(finalists, std::less{}, [&](auto i) { return field[i].Child->Fitness.front(); });
+            res = std::move(field[best]);
+        } else {
+            res = OffspringGeneratorBase::Generate(random, pCrossover, pMutation, pLocal, pLamarck, buf);
+        }
         if (!res || !res.Parent1) { return std::nullopt; }
         bool accept{false};
         if (res.Parent2) {
             Individual q{};
             for (size_t i = 0; i < q.Size(); ++i) {
-                auto f1 = (*res.Parent1)[i];
-                auto f2 = (*res.Parent2)[i];
-                q[i] = std::max(f1, f2) - (static_cast<Operon::Scalar>(comparisonFactor_) * std::abs(f1 - f2));
+                q[i] = AcceptanceTarget((*res.Parent1)[i], (*res.Parent2)[i]);
                 accept = Operon::ParetoDominance{}(res.Child->Fitness, q.Fitness) != Dominance::Right;
             }
         } else {
@@ -26,4 +45,16 @@ namespace Operon {
         return accept ? res.Child : std::nullopt;
     }
 
+    auto OffspringSelectionGenerator::RejectionThreshold(RecombinationResult const& res) const -> Operon::Scalar
+    {
+        if (!res.Parent1 || res.Parent1->Size() != 1) { return EvaluatorBase::ErrMax; }
+        if (!res.Parent2) { return (*res.Parent1)[0]; }
+        return AcceptanceTarget((*res.Parent1)[0], (*res.Parent2)[0]);
+    }
+
+    auto OffspringSelectionGenerator::AcceptanceTarget(Operon::Scalar f1, Operon::Scalar f2) const -> Operon::Scalar
+    {
+        return std::max(f1, f2) - (static_cast<Operon::Scalar>(comparisonFactor_) * std::abs(f1 - f2));
+    }
+
 } // namespace Operon
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright 2019-2025 Heal Research
+// SPDX-FileCopyrightText: Copyright 2025-present Bogdan Burlacu and contributors
+
+#include "operon/operators/generator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <random>
+
+namespace Operon {
+
+    auto OffspringGeneratorBase::Race(Operon::RandomGenerator& random, double pLocal, double pLamarck, Operon::Span<Operon::Scalar> buf, Operon::Span<RecombinationResult> candidates) const -> std::vector<std::size_t>
+    {
+        std::vector<std::size_t> alive(candidates.size());
+        std::iota(alive.begin(), alive.end(), 0UL);
+
+        auto const& evaluator = *Evaluator();
+        auto const training = evaluator.GetProblem()->TrainingRange();
+        auto const n = training.Size();
+
+        if (RacingEnabled() && candidates.size() > racing_.Finalists && racing_.InitialRows < n && evaluator.ObjectiveCount() == 1) {
+            std::vector<Operon::Scalar> partial(candidates.size());
+            std::size_t raceRows { 0 };
+            bool supported { true };
+
+            for (auto rows = racing_.InitialRows; alive.size() > racing_.Finalists && rows < n;) {
+                // all survivors see the same window, so a round compares
+                // candidates on equal terms even when the window is unlucky
+                auto const start = training.Start() + std::uniform_int_distribution<std::size_t>{0, n - rows}(random);
+                Range const window { start, start + rows };
+                for (auto i : alive) {
+                    auto f = evaluator.EvaluateRange(random, *candidates[i].Child, buf, window);
+                    if (!f) { supported = false; break; }
+                    partial[i] = f->front();
+                }
+                if (!supported) { break; }
+                raceRows += alive.size() * rows;
+
+                auto const keep = std::max(racing_.Finalists,
+                    static_cast<std::size_t>(std::ceil(static_cast<double>(alive.size()) / racing_.HalvingRatio)));
+                std::ranges::stable_sort(alive, std::less{}, [&](auto i) { return partial[i]; });
+                alive.resize(keep);
+                rows = static_cast<std::size_t>(std::ceil(static_cast<double>(rows) * racing_.HalvingRatio));
+            }
+
+            if (supported) {
+                evaluator.CallCount += candidates.size() - alive.size();
+                evaluator.ResidualEvaluations += (raceRows + n - 1) / n;
+                auto const full  = candidates.size() * n;
+                auto const spent = raceRows + (alive.size() * n);
+                if (full > spent) { evaluator.SavedRowEvaluations += full - spent; }
+                std::ranges::sort(alive); // score the finalists in breeding order
+            } else {
+                alive.resize(candidates.size());
+                std::iota(alive.begin(), alive.end(), 0UL);
+            }
+        }
+
+        for (auto i : alive) {
+            Score(random, pLocal, pLamarck, buf, candidates[i]);
+        }
+        return alive;
+    }
+
+} // namespace Operon
@@ -4,6 +4,13 @@
 
 #include "operon/operators//local_search.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_map>
+
 #include "operon/core/tree.hpp"
 #include "operon/optimizer/optimizer.hpp"
 
@@ -25,4 +32,154 @@ auto CoefficientOptimizer::operator()(Operon::RandomGenerator& rng, Operon::Tree
     // this remaining "unsuccessful", not on any specific cost value.
     return {tree, tl::unexpected(FitFailure{})};
 }
+
+auto CoefficientOptimizer::OptimizeBatch(Operon::Span<Operon::RandomGenerator> rngs, Operon::Span<Operon::Tree> trees) const -> std::vector<tl::expected<FitResult, FitFailure>> {
+    auto const* optimizer = optimizer_.get();
+
+    if (optimizer->Iterations() == 0) {
+        // same contract as operator() above
+        return std::vector<FitOutcome>(trees.size(), tl::unexpected(FitFailure{}));
+    }
+    std::vector<Operon::Tree const*> pointers;
+    pointers.reserve(trees.size());
+    std::ranges::transform(trees, std::back_inserter(pointers), [](auto const& tree) { return &tree; });
+
+    auto outcomes = optimizer->OptimizeBatch(rngs, pointers);
+    for (auto i = 0UL; i < trees.size(); ++i) {
+        if (outcomes[i]) { trees[i].SetCoefficients(outcomes[i]->FinalParameters); }
+    }
+    return outcomes;
+}
+
+auto CoefficientOptimizer::Batched() const -> bool {
+    return optimizer_->Batched();
+}
+
+LocalSearchBudget::LocalSearchBudget(gsl::not_null<OptimizerBase const*> optimizer, LocalSearchBudgetConfig config)
+    : optimizer_(optimizer), config_(config)
+{
+    if (!(config.MinScale > 0) || config.MaxScale < config.MinScale) {
+        throw std::invalid_argument("LocalSearchBudget requires 0 < MinScale <= MaxScale");
+    }
+}
+
+LocalSearchBudget::Scope::Scope(std::size_t iterations)
+    : previous_(OptimizerBase::IterationOverride())
+{
+    OptimizerBase::IterationOverride() = iterations;
+}
+
+LocalSearchBudget::Scope::~Scope()
+{
+    OptimizerBase::IterationOverride() = previous_;
+}
+
+auto LocalSearchBudget::Prepare(Operon::Span<Individual const> population) const -> void
+{
+    ranked_.clear();
+    ranked_.reserve(population.size());
+    for (auto const& ind : population) {
+        if (!ind.Fitness.empty()) { ranked_.push_back(ind[0]); }
+    }
+    std::ranges::sort(ranked_);
+
+    auto const draws = draws_.exchange(0, std::memory_order_relaxed);
+    auto const sum = scaleSum_.exchange(0, std::memory_order_relaxed);
+    if (draws > 0 && sum > 0) { prior_ = sum / static_cast<double>(draws); }
+}
+
+auto LocalSearchBudget::Iterations(Operon::Scalar parentFitness) const -> std::size_t
+{
+    auto const base = optimizer_->ConfiguredIterations();
+    auto iterations = base;
+    if (!ranked_.empty() && base > 0) {
+        auto const better = std::ranges::lower_bound(ranked_, parentFitness) - ranked_.begin();
+        auto const q = static_cast<double>(better) / static_cast<double>(ranked_.size());
+        auto const scale = config_.MaxScale - ((config_.MaxScale - config_.MinScale) * q);
+        // the mean raw scale of this generation so far, this draw included,
+        // with the previous generation's mean as one more draw
+        auto const sum = scaleSum_.fetch_add(scale, std::memory_order_relaxed) + scale;
+        auto const draws = draws_.fetch_add(1, std::memory_order_relaxed) + 1;
+        auto const norm = (prior_ + sum) / static_cast<double>(draws + 1);
+        iterations = std::max<std::size_t>(1, static_cast<std::size_t>(std::lround(static_cast<double>(base) * scale / norm)));
+    }
+    allotted_.fetch_add(iterations, std::memory_order_relaxed);
+    baseline_.fetch_add(base, std::memory_order_relaxed);
+    return iterations;
+}
+
+namespace {
+    // Hash of each subtree's layout: its node types and arities in postfix
+    // order, regardless of coefficient values.
+    auto SubtreeLayouts(Tree const& tree) -> std::vector<Operon::Hash>
+    {
+        auto const& nodes = tree.Nodes();
+        std::vector<Operon::Hash> keys(nodes.size());
+        std::ranges::transform(nodes, keys.begin(), [](auto const& n) { return n.HashValue + n.Arity; });
+        std::vector<Operon::Hash> layouts(nodes.size());
+        Operon::Hasher const hasher;
+        for (auto i = 0UL; i < nodes.size(); ++i) {
+            auto const* first = keys.data() + (i - nodes[i].Length);
+            layouts[i] = hasher(reinterpret_cast<uint8_t const*>(first), sizeof(Operon::Hash) * (nodes[i].Length + 1UL)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        }
+        return layouts;
+    }
+
+    auto SameLayout(Operon::Span<Node const> lhs, Operon::Span<Node const> rhs) -> bool
+    {
+        return std::ranges::equal(lhs, rhs, [](auto const& a, auto const& b) { return a.HashValue == b.HashValue && a.Arity == b.Arity; });
+    }
+} // namespace
+
+auto InheritCoefficients(Tree& child, Tree const& parent1, Tree const& parent2) -> std::size_t
+{
+    auto hasRef = [](Tree const& tree) { return std::ranges::any_of(tree.Nodes(), [](auto const& n) { return n.IsRef(); }); };
+    if (child.Length() == 0 || hasRef(child) || hasRef(parent1) || hasRef(parent2)) { return 0; }
+
+    auto& nodes = child.Nodes();
+    auto subtree = [](Tree const& tree, std::size_t i) {
+        auto const& n = tree.Nodes();
+        return Operon::Span<Node const>{n}.subspan(i - n[i].Length, n[i].Length + 1UL);
+    };
+
+    // every parent subtree with at least one child, by layout
+    std::unordered_map<Operon::Hash, std::pair<Tree const*, std::size_t>> sources;
+    for (auto const* parent : { &parent1, &parent2 }) {
+        auto const layouts = SubtreeLayouts(*parent);
+        for (auto i = 0UL; i < layouts.size(); ++i) {
+            if (parent->Nodes()[i].Length > 0) { sources.try_emplace(layouts[i], parent, i); }
+        }
+    }
+
+    auto const layouts = SubtreeLayouts(child);
+    auto match = [&](std::size_t i) -> Node const* {
+        auto it = sources.find(layouts[i]);
+        if (it == sources.end()) { return nullptr; }
+        auto const [parent, j] = it->second;
+        auto const source = subtree(*parent, j);
+        return SameLayout(subtree(child, i), source) ? source.data() : nullptr;
+    };
+
+    auto const root = nodes.size() - 1;
+    if (match(root) != nullptr) { return 0; }
+
+    // reverse postfix order visits a subtree's root before its descendants,
+    // which a match skips over
+    std::size_t inherited{0};
+    for (auto i = static_cast<std::ptrdiff_t>(root) - 1; i >= 0;) {
+        auto const k = static_cast<std::size_t>(i);
+        auto const length = nodes[k].Length;
+        auto const* source = length > 0 ? match(k) : nullptr;
+        if (source == nullptr) { --i; continue; }
+        for (auto m = 0UL; m <= length; ++m) {
+            auto& node = nodes[k - length + m];
+            if (node.Optimize) {
+                node.Value = source[m].Value;
+                ++inherited;
+            }
+        }
+        i -= static_cast<std::ptrdiff_t>(length) + 1;
+    }
+    return inherited;
+}
 } // namespace Operon
@@ -9,7 +9,7 @@
 
 namespace Operon {
 namespace {
-    auto const Proj = [](Individual const& ind) -> Vector<Scalar> const& { return ind.Fitness; };
+    auto const Proj = [](Individual const& ind) -> Span<Scalar const> { return ind.Fitness; };
 
     template<typename S>
     auto Wrap(Span<Individual const> pop, Scalar eps) -> NondominatedSorterBase::Result {
@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright 2019-2025 Heal Research
+// SPDX-FileCopyrightText: Copyright 2025-present Bogdan Burlacu and contributors
+
+#include "operon/operators/surrogate.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+#include "operon/operators/evaluator.hpp"
+
+namespace Operon {
+
+namespace {
+    // prior variance of every weight: large, so the first observations
+    // dominate, but finite so RLS is well defined from the start
+    constexpr double PriorVariance { 1e4 };
+
+    // covariance trace beyond which forgetting is suspended; without new
+    // information in some direction, dividing by the forgetting factor would
+    // otherwise inflate the covariance in that direction without bound
+    constexpr double MaxCovarianceTrace { 1e8 };
+
+    // margin change per audited candidate (in residual standard deviations),
+    // scaled by the distance of the outcome from TargetMissRate
+    constexpr double MarginStep { 0.5 };
+
+    auto Usable(Scalar fitness) -> bool
+    {
+        return std::isfinite(fitness) && fitness < EvaluatorBase::ErrMax;
+    }
+} // namespace
+
+FitnessSurrogate::FitnessSurrogate(SurrogateConfig const& config)
+    : config_(config)
+    , margin_(config.InitialMargin)
+{
+    if (!(config.Forgetting > 0 && config.Forgetting <= 1)) {
+        throw std::invalid_argument("the surrogate forgetting factor must lie in (0, 1]");
+    }
+    if (!(config.AuditRate >= 0 && config.AuditRate <= 1) || !(config.TargetMissRate > 0 && config.TargetMissRate < 1)) {
+        throw std::invalid_argument("the surrogate audit rate must lie in [0, 1] and the target miss rate in (0, 1)");
+    }
+    for (auto i = 0UL; i < FeatureCount; ++i) {
+        covariance_[(i * FeatureCount) + i] = PriorVariance;
+    }
+}
+
+auto FitnessSurrogate::Describe(Tree const& child, Scalar parent1, Scalar parent2, double parentLength) -> std::optional<Features>
+{
+    if (!Usable(parent1) || !Usable(parent2) || child.Empty()) { return std::nullopt; }
+
+    Features x{};
+    x[0] = 1.0;
+    x[1] = static_cast<double>(std::min(parent1, parent2));
+    x[2] = static_cast<double>(std::max(parent1, parent2));
+    x[3] = static_cast<double>(child.Length()) / std::max(parentLength, 1.0);
+    x[4] = std::log1p(static_cast<double>(child.Depth()));
+
+    auto const length = static_cast<double>(child.Length());
+    for (auto const& node : child.Nodes()) {
+        if (node.IsLeaf()) { continue; }
+        x[5 + (node.HashValue % OperatorBuckets)] += 1.0 / length;
+    }
+    return x;
+}
+
+auto FitnessSurrogate::PredictUnlocked(Features const& features) const -> double
+{
+    return std::inner_product(features.begin(), features.end(), weights_.begin(), 0.0);
+}
+
+auto FitnessSurrogate::Predict(Features const& features) const -> std::optional<double>
+{
+    std::scoped_lock lock(mutex_);
+    if (config_.Warmup == 0 || observations_ < config_.Warmup) { return std::nullopt; }
+    return PredictUnlocked(features);
+}
+
+auto FitnessSurrogate::Screen(RandomGenerator& random, Features const& features, Scalar threshold) const -> Decision
+{
+    std::scoped_lock lock(mutex_);
+    if (config_.Warmup == 0 || observations_ < config_.Warmup || !Usable(threshold)) { return Decision::Evaluate; }
+
+    auto const optimistic = PredictUnlocked(features) - (margin_ * std::sqrt(residualVariance_));
+    if (!(optimistic > static_cast<double>(threshold))) { return Decision::Evaluate; }
+
+    if (std::bernoulli_distribution{config_.AuditRate}(random)) { return Decision::Audit; }
+    ++rejected_;
+    return Decision::Reject;
+}
+
+auto FitnessSurrogate::Observe(Features const& features, Scalar fitness) const -> void
+{
+    if (!Usable(fitness)) { return; }
+    constexpr auto n = FeatureCount;
+    auto const y = static_cast<double>(fitness);
+
+    std::scoped_lock lock(mutex_);
+    auto const error = y - PredictUnlocked(features);
+
+    // the residual variance averages the a-priori errors: plainly until there
+    // are 1 / (1 - Forgetting) of them, exponentially weighted afterwards
+    ++observations_;
+    auto const alpha = std::max(1.0 - config_.Forgetting, 1.0 / static_cast<double>(observations_));
+    residualVariance_ += alpha * ((error * error) - residualVariance_);
+
+    // recursive least squares: k = P x / (lambda + x'P x), w += k e,
+    // P = (P - k x'P) / lambda
+    Features px{};
+    for (auto i = 0UL; i < n; ++i) {
+        for (auto j = 0UL; j < n; ++j) { px[i] += covariance_[(i * n) + j] * features[j]; }
+    }
+    auto const lambda = config_.Forgetting;
+    auto const denominator = lambda + std::inner_product(features.begin(), features.end(), px.begin(), 0.0);
+    if (!(denominator > 0) || !std::isfinite(denominator)) { return; }
+
+    double trace{0};
+    for (auto i = 0UL; i < n; ++i) {
+        auto const k = px[i] / denominator;
+        weights_[i] += k * error;
+        for (auto j = 0UL; j < n; ++j) { covariance_[(i * n) + j] -= k * px[j]; }
+        trace += covariance_[(i * n) + i];
+    }
+    if (trace < MaxCovarianceTrace) {
+        std::ranges::transform(covariance_, covariance_.begin(), [&](auto v) { return v / lambda; });
+    }
+}
+
+auto FitnessSurrogate::Audit(bool accepted) const -> void
+{
+    std::scoped_lock lock(mutex_);
+    ++audited_;
+    if (accepted) { ++missed_; }
+    auto const miss = accepted ? 1.0 : 0.0;
+    margin_ = std::max(0.0, margin_ + (MarginStep * (miss - config_.TargetMissRate)));
+}
+
+auto FitnessSurrogate::Margin() const -> double
+{
+    std::scoped_lock lock(mutex_);
+    return margin_;
+}
+
+auto FitnessSurrogate::ResidualDeviation() const -> double
+{
+    std::scoped_lock lock(mutex_);
+    return std::sqrt(residualVariance_);
+}
+
+auto FitnessSurrogate::Observations() const -> std::size_t
+{
+    std::scoped_lock lock(mutex_);
+    return observations_;
+}
+
+auto FitnessSurrogate::Rejected() const -> std::size_t
+{
+    std::scoped_lock lock(mutex_);
+    return rejected_;
+}
+
+auto FitnessSurrogate::Audited() const -> std::size_t
+{
+    std::scoped_lock lock(mutex_);
+    return audited_;
+}
+
+auto FitnessSurrogate::Missed() const -> std::size_t
+{
+    std::scoped_lock lock(mutex_);
+    return missed_;
+}
+
+} // namespace Operon
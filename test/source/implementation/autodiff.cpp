@@ -5,8 +5,11 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <random>
+#include <string>
+#include <vector>
 
 #include "../operon_test.hpp"
 
@@ -273,6 +276,39 @@ TEST_CASE("Autodiff poly-10 expression", "[autodiff]")
     CHECK(ok);
 }
 
+TEST_CASE("Autodiff: EvaluateWithJacobian matches Evaluate and JacRev", "[autodiff]")
+{
+    std::string const expr = "(0.78 * X1 * X2) + sin(1.3 * X3) - exp(0.2 * X4) + (0.5 * X5) / (1.1 + (0.3 * X6) ^ 2)";
+
+    Operon::Dataset ds("./data/Poly-10.csv", /*hasHeader=*/true);
+    auto tree = InfixParser::Parse(expr, ds);
+    auto coeff = tree.GetCoefficients();
+    // several batches plus a partial one, so the per-batch output copy is exercised at the tail
+    Operon::Range range(0, 250); // NOLINT
+
+    DispatchTable<Operon::Scalar> dt;
+    Operon::Interpreter<Operon::Scalar, DispatchTable<Operon::Scalar>> const interpreter{&dt, &ds, &tree};
+
+    auto const expected = interpreter.Evaluate(coeff, range);
+    auto const jacrev = interpreter.JacRev(coeff, range);
+
+    std::vector<Operon::Scalar> result(range.Size());
+    std::vector<Operon::Scalar> jacobian(range.Size() * coeff.size());
+    interpreter.EvaluateWithJacobian(coeff, range, result, jacobian);
+
+    for (auto i = 0UL; i < range.Size(); ++i) {
+        CHECK(result[i] == Catch::Approx(expected[i]));
+    }
+    Eigen::Map<Eigen::Array<Operon::Scalar, -1, -1> const> const jac(jacobian.data(), jacrev.rows(), jacrev.cols());
+    CHECK(jac.isApprox(jacrev));
+
+    // a result span not sized to the range is left untouched, as with Evaluate
+    std::vector<Operon::Scalar> shortResult(range.Size() - 1, Operon::Scalar{-1});
+    interpreter.EvaluateWithJacobian(coeff, range, shortResult, jacobian);
+    CHECK(std::ranges::all_of(shortResult, [](auto v) { return v == Operon::Scalar{-1}; }));
+    CHECK(jac.isApprox(jacrev));
+}
+
 // Every node's forward pass multiplies its result by the node's own
 // weight w. A derivative callback that reads the node's own weighted
 // result as a shortcut, instead of computing from the unweighted
@@ -8,16 +8,23 @@
 #include "../operon_test.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstddef>
+#include <limits>
 #include <iterator>
+#include <numeric>
 #include <type_traits>
 #include <utility>
 #include <vector>
+#include <vstat/vstat.hpp>
 
 #include "operon/core/individual.hpp"
 #include "operon/core/node.hpp"
 #include "operon/core/tree.hpp"
 #include "operon/core/dataset.hpp"
+#include "operon/core/float16.hpp"
+#include "operon/core/numa.hpp"
 #include "operon/core/pset.hpp"
 #include "operon/core/types.hpp"
 
@@ -114,6 +121,336 @@ TEST_CASE("Dataset loading and access", "[core]")
     }
 }
 
+TEST_CASE("Dataset compressed column storage", "[core]")
+{
+    Operon::RandomGenerator rng{0};
+    auto ds = Util::RandomDataset(rng, 100, 3); // NOLINT(readability-magic-numbers)
+    auto const hash = ds.GetVariable("X1")->Hash;
+    std::vector<Operon::Scalar> original(ds.GetValues(hash).begin(), ds.GetValues(hash).end());
+
+    SECTION("Audit does not modify the column") {
+        auto report = ds.AuditColumnPrecision(hash, ColumnPrecision::Float16);
+        CHECK(report.MaxAbsError > 0);
+        CHECK(report.MaxRelError < 1e-3); // binary16 has an 11-bit significand
+        CHECK(report.Overflow == 0);
+        CHECK(ds.GetColumnPrecision(hash) == ColumnPrecision::Float32);
+        CHECK(std::ranges::equal(ds.GetValues(hash), original));
+    }
+
+    SECTION("Float16 and BFloat16 round trips agree with the audit") {
+        for (auto precision : { ColumnPrecision::Float16, ColumnPrecision::BFloat16 }) {
+            auto copy = ds;
+            auto audit = copy.AuditColumnPrecision(hash, precision);
+            auto report = copy.SetColumnPrecision(hash, precision);
+            CHECK(report.MaxAbsError == audit.MaxAbsError);
+            CHECK(copy.GetColumnPrecision(hash) == precision);
+
+            auto compressed = copy.GetCompressedValues(hash);
+            REQUIRE(std::ssize(compressed.Values) == copy.PaddedRows());
+            auto values = copy.GetValues(hash);
+            for (auto i = 0UL; i < values.size(); ++i) {
+                CHECK(values[i] == Decompress(precision, compressed.Values[i]));
+                CHECK(std::abs(values[i] - original[i]) <= report.MaxAbsError);
+            }
+        }
+    }
+
+    SECTION("Float16 overflow is reported") {
+        std::vector<std::vector<Operon::Scalar>> cols{ { 1.F, 1e5F, -1e6F } }; // NOLINT(readability-magic-numbers)
+        Dataset big(cols);
+        auto report = big.AuditColumnPrecision(big.GetVariables().front().Hash, ColumnPrecision::Float16);
+        CHECK(report.Overflow == 2);
+    }
+
+    SECTION("Mutations re-encode compressed columns") {
+        ds.SetColumnPrecision(hash, ColumnPrecision::BFloat16);
+        ds.Standardize(static_cast<std::size_t>(ds.GetVariable(hash)->Index), Range{0, 100}); // NOLINT(readability-magic-numbers)
+        auto compressed = ds.GetCompressedValues(hash);
+        auto values = ds.GetValues(hash);
+        for (auto i = 0UL; i < values.size(); ++i) {
+            CHECK(values[i] == BFloat16::ToFloat(compressed.Values[i]));
+        }
+    }
+
+    SECTION("Switching back to Float32 drops the compressed copy") {
+        ds.SetColumnPrecision(hash, ColumnPrecision::Float16);
+        ds.SetColumnPrecision(hash, ColumnPrecision::Float32);
+        CHECK(ds.GetCompressedValues(hash).Values.empty());
+    }
+}
+
+TEST_CASE("Dataset float64 ingestion", "[core]")
+{
+    constexpr auto rows { 100 };
+    std::vector<double> stamps(rows);
+    std::vector<double> unit(rows);
+    std::vector<double> huge(rows);
+    for (auto k = 0; k < rows; ++k) {
+        stamps[k] = 1.7e9 + k;                  // NOLINT(readability-magic-numbers) float32 spacing here is 128
+        unit[k] = static_cast<double>(k) / rows;
+        huge[k] = 1e40 * (k + 1);               // NOLINT(readability-magic-numbers) overflows float32
+    }
+    auto [ds, reports] = Dataset::FromFloat64({ "T", "U", "H" }, { stamps, unit, huge });
+    REQUIRE(reports.size() == 3);
+
+    if constexpr (std::is_same_v<Operon::Scalar, double>) {
+        for (auto const& r : reports) { CHECK(r.Precision == ColumnPrecision::Float32); }
+        return;
+    }
+
+    auto const t = ds.GetVariable("T")->Hash;
+    auto const u = ds.GetVariable("U")->Hash;
+    auto const h = ds.GetVariable("H")->Hash;
+    CHECK(reports[0].Hash == t);
+    CHECK(reports[0].Precision == ColumnPrecision::Float64);
+    CHECK(reports[0].RangeRelError > 1e-3);
+    CHECK(reports[1].Precision == ColumnPrecision::Float32);
+    CHECK(reports[1].RangeRelError <= 1e-6);
+    CHECK(reports[2].Precision == ColumnPrecision::Float64);
+    CHECK(reports[2].Overflow == rows);
+
+    CHECK(ds.GetColumnPrecision(t) == ColumnPrecision::Float64);
+    CHECK(ds.GetColumnPrecision(u) == ColumnPrecision::Float32);
+    auto wide = ds.GetCompressedValues(t).Wide;
+    REQUIRE(std::ssize(wide) == ds.PaddedRows());
+    CHECK(std::ranges::equal(wide.first(rows), stamps));
+    CHECK(ds.GetValues(t)[1] == static_cast<Operon::Scalar>(stamps[1]));
+    CHECK(ds.GetCompressedValues(h).Wide[0] == huge[0]);
+
+    SECTION("Mutations operate on the exact values") {
+        ds.Standardize(static_cast<std::size_t>(ds.GetVariable(t)->Index), Range{0, rows});
+        // the narrowed column collapses runs of 128 consecutive stamps, the
+        // float64 copy keeps them distinct: standardized values are unique
+        auto values = ds.GetValues(t);
+        std::vector<Operon::Scalar> sorted(values.begin(), values.end());
+        std::ranges::sort(sorted);
+        CHECK(std::ranges::adjacent_find(sorted) == sorted.end());
+        CHECK(std::abs(std::reduce(values.begin(), values.end(), 0.0)) < 1e-3);
+
+        std::vector<int> perm(rows);
+        std::iota(perm.rbegin(), perm.rend(), 0);
+        auto const before = ds.GetCompressedValues(t).Wide[0];
+        ds.PermuteRows(perm);
+        CHECK(ds.GetCompressedValues(t).Wide[rows - 1] == before);
+        CHECK(ds.GetValues(t)[rows - 1] == static_cast<Operon::Scalar>(before));
+    }
+
+    SECTION("Statistics read the exact values") {
+        auto const stats = ds.GetColumnStatistics(t, Range{0, rows});
+        CHECK(stats.Min == stamps.front());
+        CHECK(stats.Max == stamps.back()); // no float32 value next to it
+        CHECK(std::abs(stats.Mean - (1.7e9 + ((rows - 1) / 2.0))) < 1e-3); // NOLINT(readability-magic-numbers)
+    }
+
+    SECTION("Normalize skips non-finite values") {
+        auto const nan = std::numeric_limits<Operon::Scalar>::quiet_NaN();
+        ds.SetValues(t, Range{0, 1}, std::array{nan});
+        ds.Normalize(static_cast<std::size_t>(ds.GetVariable(t)->Index), Range{0, rows});
+        auto const wide = ds.GetCompressedValues(t).Wide.first(rows);
+        CHECK(std::isnan(wide[0]));
+        CHECK(wide[1] == 0.0);
+        CHECK(wide[rows - 1] == 1.0);
+    }
+
+    SECTION("Dropping back to native precision") {
+        ds.SetColumnPrecision(t, ColumnPrecision::Float32);
+        CHECK(ds.GetCompressedValues(t).Wide.empty());
+    }
+}
+
+TEST_CASE("Dataset column statistics cache", "[core]")
+{
+    Operon::RandomGenerator rng{0};
+    auto ds = Util::RandomDataset(rng, 100, 3); // NOLINT(readability-magic-numbers)
+    auto const hash = ds.GetVariable("X1")->Hash;
+    Range const range{10, 90}; // NOLINT(readability-magic-numbers)
+
+    auto values = ds.GetValues(hash).subspan(range.Start(), range.Size());
+    auto const expected = vstat::univariate::accumulate<Operon::Scalar>(values.begin(), values.end());
+    auto const [min, max] = std::ranges::minmax(values);
+
+    auto stats = ds.GetColumnStatistics(hash, range);
+    CHECK(stats.Count == range.Size());
+    CHECK(stats.Mean == expected.mean);
+    CHECK(stats.Variance == expected.variance);
+    CHECK(stats.Min == min);
+    CHECK(stats.Max == max);
+    CHECK(ds.CachedStatisticsCount() == 1);
+
+    SECTION("Repeated queries hit the cache") {
+        (void)ds.GetColumnStatistics(hash, range);
+        CHECK(ds.CachedStatisticsCount() == 1);
+        (void)ds.GetColumnStatistics(hash, Range{0, 50}); // NOLINT(readability-magic-numbers)
+        CHECK(ds.CachedStatisticsCount() == 2);
+    }
+
+    SECTION("Mutations invalidate") {
+        std::vector<Operon::Scalar> twos(range.Size(), 2.F);
+        ds.SetValues(hash, range, twos);
+        CHECK(ds.CachedStatisticsCount() == 0);
+        auto after = ds.GetColumnStatistics(hash, range);
+        CHECK(after.Mean == 2.0);
+        CHECK(after.Variance == 0.0);
+
+        std::vector<int> perm(ds.Rows());
+        std::iota(perm.rbegin(), perm.rend(), 0);
+        ds.PermuteRows(perm);
+        CHECK(ds.CachedStatisticsCount() == 0);
+    }
+
+    SECTION("Non-finite values are skipped") {
+        std::vector<Operon::Scalar> v{ 1.F, std::numeric_limits<Operon::Scalar>::quiet_NaN(), 3.F };
+        ds.SetValues(hash, Range{0, 3}, v);
+        auto s = ds.GetColumnStatistics(hash, Range{0, 3});
+        CHECK(s.Count == 2);
+        CHECK(s.Mean == 2.0);
+        CHECK(s.Variance == 1.0);
+        CHECK(s.Min == 1.0);
+        CHECK(s.Max == 3.0);
+    }
+
+    SECTION("Weighted statistics") {
+        std::vector<Operon::Scalar> w(ds.Rows(), 0.F);
+        std::fill_n(w.begin() + static_cast<std::ptrdiff_t>(range.Start()), 2, 1.F);
+        ds.SetWeights(w);
+        auto s = ds.GetColumnStatistics(hash, range, /*weighted=*/true);
+        CHECK(s.Count == 2);
+        CHECK(s.Mean == Catch::Approx((static_cast<double>(values[0]) + values[1]) / 2.0));
+        // the unweighted entry survives SetWeights, the weighted one does not
+        ds.SetWeights(std::vector<Operon::Scalar>(ds.Rows(), 1.F));
+        CHECK(ds.CachedStatisticsCount() == 1);
+        CHECK(ds.GetColumnStatistics(hash, range, /*weighted=*/true).Count == range.Size());
+    }
+}
+
+TEST_CASE("Dataset parallel row permutation", "[core]")
+{
+    // large enough (> 1M values) to take the parallel path, with a column
+    // count that leaves a partial column group
+    constexpr auto rows { (1 << 18) + 3 };
+    constexpr auto cols { 5 };
+    Operon::RandomGenerator rng{0};
+    auto ds = Util::RandomDataset(rng, rows, cols);
+    ds.SetWeights(ds.GetValues(int64_t{0}));
+
+    std::vector<int> perm(rows);
+    std::iota(perm.begin(), perm.end(), 0);
+    std::shuffle(perm.begin(), perm.end(), rng);
+
+    auto serial = ds;
+    auto parallel = ds;
+    serial.PermuteRows(perm, /*nthread=*/1);
+    parallel.PermuteRows(perm, /*nthread=*/4); // NOLINT(readability-magic-numbers)
+
+    for (auto j = 0; j < cols; ++j) {
+        auto const original = ds.GetValues(int64_t{j});
+        auto const s = serial.GetValues(int64_t{j});
+        auto const p = parallel.GetValues(int64_t{j});
+        CHECK(std::ranges::equal(s, p));
+        auto ok { true };
+        for (auto k = 0; k < rows; ++k) { ok = ok && p[k] == original[perm[k]]; }
+        CHECK(ok);
+        auto const* padded = parallel.GetPaddedValues(int64_t{j});
+        CHECK(std::all_of(padded + rows, padded + parallel.PaddedRows(), [](auto v) { return v == 0; }));
+    }
+    // the weights (a copy of X1) move with their rows
+    CHECK(std::ranges::equal(*parallel.Weights(), parallel.GetValues(int64_t{0})));
+
+    SECTION("Shuffle keeps rows and weights together") {
+        auto shuffled = ds;
+        Operon::RandomGenerator r{1};
+        shuffled.Shuffle(r, /*nthread=*/4); // NOLINT(readability-magic-numbers)
+        CHECK(std::ranges::equal(shuffled.GetValues(int64_t{0}), *shuffled.Weights()));
+        CHECK_FALSE(std::ranges::equal(shuffled.GetValues(int64_t{0}), ds.GetValues(int64_t{0})));
+    }
+}
+
+TEST_CASE("Dataset NUMA replication", "[core]")
+{
+    CHECK(Numa::NodeCount() >= 1);
+    CHECK(Numa::CurrentNode() >= 0);
+    CHECK(Numa::CurrentNode() < Numa::NodeCount());
+
+    // contiguous worker blocks per node
+    CHECK(Numa::WorkerNode(0, 8, 2) == 0);
+    CHECK(Numa::WorkerNode(3, 8, 2) == 0);
+    CHECK(Numa::WorkerNode(4, 8, 2) == 1);
+    CHECK(Numa::WorkerNode(7, 8, 2) == 1);
+    CHECK(Numa::WorkerNode(5, 8, 1) == 0);
+
+    Operon::RandomGenerator rng{0};
+    auto ds = Util::RandomDataset(rng, 100, 3); // NOLINT(readability-magic-numbers)
+    auto const reference = ds;
+    auto const replicas = ds.EnableNumaReplication();
+    CHECK(replicas == ds.ReplicaCount());
+    CHECK((replicas == 0 || replicas == Numa::NodeCount()));
+    CHECK(ds == reference);
+
+    // mutations reach whichever replica this thread resolves to
+    auto const hash = ds.GetVariable("X1")->Hash;
+    std::vector<Operon::Scalar> ones(10, 1.F); // NOLINT(readability-magic-numbers)
+    ds.SetValues(hash, Range{0, 10}, ones); // NOLINT(readability-magic-numbers)
+    CHECK(std::ranges::all_of(ds.GetValues(hash).first(10), [](auto v) { return v == 1.F; })); // NOLINT(readability-magic-numbers)
+    CHECK(ds.GetPaddedValues(hash)[0] == 1.F);
+
+    ds.DisableNumaReplication();
+    CHECK(ds.ReplicaCount() == 0);
+    CHECK(ds.GetValues(hash)[0] == 1.F);
+}
+
+TEST_CASE("Float16 conversion", "[core]")
+{
+    CHECK(Float16::ToFloat(Float16::FromFloat(1.0F)) == 1.0F);
+    CHECK(Float16::ToFloat(Float16::FromFloat(-2.5F)) == -2.5F);
+    CHECK(Float16::ToFloat(Float16::FromFloat(65504.F)) == 65504.F); // NOLINT(readability-magic-numbers)
+    CHECK(std::isinf(Float16::ToFloat(Float16::FromFloat(65520.F)))); // NOLINT(readability-magic-numbers)
+    CHECK(std::isnan(Float16::ToFloat(Float16::FromFloat(std::numeric_limits<float>::quiet_NaN()))));
+    auto const tiny = std::ldexp(1.F, -24); // smallest positive subnormal half
+    CHECK(Float16::ToFloat(Float16::FromFloat(tiny)) == tiny);
+    CHECK(BFloat16::ToFloat(BFloat16::FromFloat(1.0F)) == 1.0F);
+    CHECK(BFloat16::FromFloat(1.00390625F) == BFloat16::FromFloat(1.0F)); // ties round to even
+
+    std::vector<std::uint16_t> src(19); // NOLINT(readability-magic-numbers)
+    for (auto i = 0UL; i < src.size(); ++i) { src[i] = Float16::FromFloat(static_cast<float>(i) / 4.F); }
+    std::vector<float> dst(src.size());
+    Widen(ColumnPrecision::Float16, src.data(), dst.data(), src.size());
+    for (auto i = 0UL; i < src.size(); ++i) { CHECK(dst[i] == static_cast<float>(i) / 4.F); }
+}
+
+TEST_CASE("SmallVector inline and heap storage", "[core]")
+{
+    using V = SmallVector<float, 2>;
+
+    V a{1.F, 2.F};
+    CHECK(a.is_inline());
+    CHECK(a.size() == 2);
+
+    a.push_back(3.F); // spills to the heap, keeping the elements
+    CHECK_FALSE(a.is_inline());
+    CHECK(a == V{1.F, 2.F, 3.F});
+
+    V b(std::move(a)); // heap storage changes hands
+    CHECK(b.size() == 3);
+    CHECK(a.empty()); // NOLINT(bugprone-use-after-move,hicpp-invalid-access-moved)
+
+    V c{4.F};
+    V d(std::move(c)); // inline elements are copied
+    CHECK(d == V{4.F});
+
+    std::vector<float> const w{5.F, 6.F, 7.F};
+    V e = w;
+    CHECK(std::ranges::equal(e, w));
+    e.resize(1);
+    CHECK(e.front() == 5.F);
+    e.resize(2, 8.F);
+    CHECK(e == V{5.F, 8.F});
+    CHECK(V{1.F, 2.F} < V{1.F, 3.F});
+
+    // an individual's fitness lives inline for the usual objective counts
+    Individual const ind{FitnessVector::InlineCapacity};
+    CHECK(ind.Fitness.is_inline());
+}
+
 TEST_CASE("PrimitiveSet configuration", "[core]")
 {
     PrimitiveSet pset;
@@ -5,6 +5,8 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 #include "../operon_test.hpp"
 #include "operon/core/dataset.hpp"
@@ -79,6 +81,79 @@ TEST_CASE("Evaluation correctness", "[interpreter]")
     }
 }
 
+TEST_CASE("Evaluation from compressed columns", "[interpreter]")
+{
+    auto ds = Dataset("./data/Poly-10.csv", /*hasHeader=*/true);
+    auto range = Range{3, ds.Rows<std::size_t>()}; // odd start: widening must honour the range offset
+
+    using DTable = DispatchTable<Operon::Scalar>;
+    DTable dtable;
+    auto tree = InfixParser::Parse("X1 * X2 + sin(X3)", ds);
+    auto coeff = tree.GetCoefficients();
+
+    for (auto precision : { ColumnPrecision::Float16, ColumnPrecision::BFloat16 }) {
+        auto compressed = ds;
+        for (auto const* name : { "X1", "X2" }) {
+            compressed.SetColumnPrecision(compressed.GetVariable(name)->Hash, precision);
+        }
+        // the compressed dataset's float32 columns hold the rounded values, so
+        // a copy with the compressed copies dropped is the reference result
+        auto reference = compressed;
+        for (auto const* name : { "X1", "X2" }) {
+            reference.SetColumnPrecision(reference.GetVariable(name)->Hash, ColumnPrecision::Float32);
+        }
+        auto lhs = Interpreter<Operon::Scalar, DTable>(&dtable, &compressed, &tree).Evaluate(coeff, range);
+        auto rhs = Interpreter<Operon::Scalar, DTable>(&dtable, &reference, &tree).Evaluate(coeff, range);
+        CHECK(lhs == rhs);
+    }
+}
+
+TEST_CASE("Evaluation without coefficients uses the tree's own", "[interpreter]")
+{
+    auto ds = Dataset("./data/Poly-10.csv", /*hasHeader=*/true);
+    auto range = Range{0, ds.Rows<std::size_t>()};
+
+    using DTable = DispatchTable<Operon::Scalar>;
+    DTable dtable;
+    auto tree = InfixParser::Parse("X1 * X2 + sin(X3) + 0.5", ds);
+    Interpreter<Operon::Scalar, DTable> const interpreter(&dtable, &ds, &tree);
+    auto const own = interpreter.Evaluate(tree.GetCoefficients(), range);
+
+    // the binding is kept between calls, so an empty coefficient span after
+    // an explicit one must go back to the values in the tree
+    std::vector<Operon::Scalar> other(tree.GetCoefficients().size(), 2);
+    auto const overridden = interpreter.Evaluate(other, range);
+    REQUIRE(overridden != own);
+    CHECK(interpreter.Evaluate(Operon::Span<Operon::Scalar const>{}, range) == own);
+}
+
+TEST_CASE("Evaluation from float64 columns", "[interpreter]")
+{
+    if constexpr (std::is_same_v<Operon::Scalar, double>) { return; }
+    constexpr auto rows { 64 };
+    std::vector<double> x(rows);
+    std::vector<double> y(rows);
+    for (auto k = 0; k < rows; ++k) {
+        x[k] = 1e12 + (0.25 * k); // NOLINT(readability-magic-numbers) not representable in float32
+        y[k] = k;
+    }
+    auto [ds, reports] = Dataset::FromFloat64({ "X", "Y" }, { x, y });
+    REQUIRE(reports[0].Precision == ColumnPrecision::Float64);
+
+    using DTable = DispatchTable<Operon::Scalar>;
+    DTable dtable;
+    auto tree = InfixParser::Parse("X", ds);
+    auto coeff = tree.GetCoefficients();
+    REQUIRE(coeff.size() == 1);
+    coeff[0] = 1e-12F; // NOLINT(readability-magic-numbers) w*x is scaled in double, then rounded once
+
+    auto const range = Range{0, rows};
+    auto out = Interpreter<Operon::Scalar, DTable>(&dtable, &ds, &tree).Evaluate(coeff, range);
+    for (auto k = 0; k < rows; ++k) {
+        CHECK(out[k] == static_cast<Operon::Scalar>(x[k] * static_cast<double>(coeff[0])));
+    }
+}
+
 TEST_CASE("Batch evaluation", "[interpreter]")
 {
     auto ds = Dataset("./data/Poly-10.csv", /*hasHeader=*/true);
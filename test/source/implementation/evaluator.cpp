@@ -5,7 +5,15 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
 #include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include "operon/core/dataset.hpp"
 #include "operon/core/individual.hpp"
@@ -387,6 +395,20 @@ TEST_CASE("FBF evaluator", "[evaluator]")
 // ──────────────────────────────────────────────────────────────────────────────
 // LikelihoodEvaluator
 // ──────────────────────────────────────────────────────────────────────────────
+TEST_CASE("JacobianScratch reuses small buffers only", "[evaluator]")
+{
+    using Operon::detail::JacobianScratch;
+    constexpr std::size_t small { 64 };
+    auto const* shared = JacobianScratch{small}.Values().data();
+    {
+        // above the cap: a buffer of its own, not the per-thread one
+        JacobianScratch const large{JacobianScratch::Cap + 1};
+        CHECK(large.Values().size() == JacobianScratch::Cap + 1);
+        CHECK(large.Values().data() != shared);
+    }
+    CHECK(JacobianScratch{small}.Values().data() == shared);
+}
+
 TEST_CASE("LikelihoodEvaluator", "[evaluator]")
 {
     EvaluatorFixture fix;
@@ -904,6 +926,434 @@ TEST_CASE("Evaluator<DTable>: oversized buffer matches exact-size buffer", "[eva
     }
 }
 
+TEST_CASE("Evaluator<DTable>: early abort with a rejection threshold", "[evaluator]")
+{
+    EvaluatorFixture fix;
+    using DTable = EvaluatorFixture::DTable;
+    constexpr auto blockRows { 16UL };
+    std::vector<Operon::Scalar> buf(EvaluatorFixture::Nrow);
+
+    auto check = [&](Evaluator<DTable>& ev, Operon::Individual const& ind) {
+        ev.SetEarlyAbortRows(blockRows);
+        auto const exact = ev.Evaluate(fix.rng, ind, buf).front();
+        REQUIRE(std::isfinite(exact));
+        REQUIRE(exact > 0);
+
+        // a threshold the individual meets: the exact fitness comes back
+        CHECK(ev.EvaluateBounded(fix.rng, ind, buf, exact).front() == exact);
+        CHECK(ev.EvaluateBounded(fix.rng, ind, buf, 2 * exact).front() == exact);
+        CHECK(ev.RejectedEvaluations == 0);
+
+        // a threshold far below it: rejected before the last block
+        auto const rejected = ev.EvaluateBounded(fix.rng, ind, buf, exact / 100).front();
+        CHECK(rejected == EvaluatorBase::ErrMax);
+        CHECK(ev.RejectedEvaluations == 1);
+        auto const saved = ev.SavedRowEvaluations.load();
+        CHECK(saved > 0);
+        CHECK(std::cmp_less(saved, EvaluatorFixture::Nrow));
+        CHECK(ev.Stats().SavedRowEvaluations == saved);
+
+        // disabled: the threshold is ignored
+        ev.SetEarlyAbortRows(0);
+        CHECK(ev.EvaluateBounded(fix.rng, ind, buf, exact / 100).front() == exact);
+    };
+
+    SECTION("MSE, scaling off") {
+        Evaluator<DTable> ev{&fix.problem, &fix.dtable, MSE{}, /*linearScaling=*/false};
+        check(ev, EvaluatorFixture::MakeIndividual(fix.tree));
+    }
+
+    SECTION("NMSE, scaling on") {
+        // X3 is missing from the model, so no (a, b) can fit the target
+        Evaluator<DTable> ev{&fix.problem, &fix.dtable, NMSE{}, /*linearScaling=*/true};
+        check(ev, EvaluatorFixture::MakeIndividual(InfixParser::Parse("X1 + X2", fix.ds)));
+    }
+
+    SECTION("MAE, scaling off") {
+        Evaluator<DTable> ev{&fix.problem, &fix.dtable, MAE{}, /*linearScaling=*/false};
+        check(ev, EvaluatorFixture::MakeIndividual(fix.tree));
+    }
+
+    SECTION("Metrics without a prefix bound are refused") {
+        Evaluator<DTable> r2{&fix.problem, &fix.dtable, R2{}};
+        CHECK_THROWS_AS(r2.SetEarlyAbortRows(blockRows), std::invalid_argument);
+        Evaluator<DTable> mae{&fix.problem, &fix.dtable, MAE{}, /*linearScaling=*/true};
+        CHECK_THROWS_AS(mae.SetEarlyAbortRows(blockRows), std::invalid_argument);
+        Evaluator<DTable> skip{&fix.problem, &fix.dtable, MSE{}, /*linearScaling=*/true, /*skipNonFinite=*/true};
+        CHECK_THROWS_AS(skip.SetEarlyAbortRows(blockRows), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Evaluator<DTable>: sub-range evaluation for racing", "[evaluator]")
+{
+    EvaluatorFixture fix;
+    using DTable = EvaluatorFixture::DTable;
+    auto ind = EvaluatorFixture::MakeIndividual(InfixParser::Parse("X1 + X2", fix.ds));
+    std::vector<Operon::Scalar> buf(EvaluatorFixture::Nrow);
+
+    Evaluator<DTable> const ev{&fix.problem, &fix.dtable, NMSE{}};
+    auto const calls = ev.CallCount.load();
+
+    auto const full = ev.EvaluateRange(fix.rng, ind, buf, fix.problem.TrainingRange());
+    REQUIRE(full.has_value());
+    CHECK(full->front() == ev.Evaluate(fix.rng, ind, buf).front());
+
+    // a window scores like an evaluator whose training range is that window
+    Range const window{100, 164};
+    Operon::Problem windowed(&fix.ds);
+    windowed.SetTrainingRange(window);
+    windowed.SetTestRange(window);
+    windowed.SetTarget("X4");
+    Evaluator<DTable> const ref{&windowed, &fix.dtable, NMSE{}};
+    auto const partial = ev.EvaluateRange(fix.rng, ind, buf, window);
+    REQUIRE(partial.has_value());
+    CHECK(partial->front() == ref.Evaluate(fix.rng, ind, buf).front());
+
+    // only the full evaluation above counted as a call
+    CHECK(ev.CallCount.load() == calls + 1);
+
+    // evaluators without a sub-range score opt out of racing
+    UserDefinedEvaluator const user{&fix.problem, [](Operon::RandomGenerator& /*rng*/, Operon::Individual const& /*ind*/) { return EvaluatorBase::ReturnType{ 0 }; }};
+    CHECK_FALSE(user.EvaluateRange(fix.rng, ind, buf, window).has_value());
+}
+
+TEST_CASE("MultiEvaluator: sub-evaluators share one forward pass", "[evaluator]")
+{
+    EvaluatorFixture fix;
+    using DTable = EvaluatorFixture::DTable;
+
+    Operon::Evaluator<DTable> r2{&fix.problem, &fix.dtable, Operon::R2{}};
+    MinimumDescriptionLengthEvaluator<DTable, GaussianLikelihood<Operon::Scalar>> mdl{&fix.problem, &fix.dtable};
+    Operon::Evaluator<DTable> mse{&fix.problem, &fix.dtable, Operon::MSE{}};
+    Operon::LengthEvaluator length{&fix.problem};
+
+    // scored on their own, one pass each
+    auto ind = EvaluatorFixture::MakeIndividual(fix.tree);
+    auto const expectedR2     = r2(fix.rng, ind);
+    auto const expectedMdl    = mdl(fix.rng, ind);
+    auto const expectedMse    = mse(fix.rng, ind);
+    auto const expectedLength = length(fix.rng, ind);
+    r2.Reset();
+    mdl.Reset();
+    mse.Reset();
+
+    Operon::MultiEvaluator me{&fix.problem};
+    me.Add(&r2);
+    me.Add(&mdl);
+    me.Add(&mse);
+    me.Add(&length);
+    CHECK(me.UsesJacobian());
+
+    auto const combined = me(fix.rng, ind);
+    REQUIRE(combined.size() == 4);
+    // objectives in insertion order, each identical to the standalone score
+    CHECK(combined[0] == expectedR2[0]);
+    CHECK(combined[1] == expectedMdl[0]);
+    CHECK(combined[2] == expectedMse[0]);
+    CHECK(combined[3] == expectedLength[0]);
+
+    // MDL ran first and interpreted the tree once (output and jacobian);
+    // the two metric evaluators reused its predictions
+    auto const stats = me.Stats();
+    CHECK(stats.ResidualEvaluations == 1);
+    CHECK(stats.JacobianEvaluations == 1);
+    CHECK(r2.ResidualEvaluations == 0);
+    CHECK(mse.ResidualEvaluations == 0);
+
+    // outside a MultiEvaluator nothing is shared
+    (void)mse(fix.rng, ind);
+    CHECK(mse.ResidualEvaluations == 1);
+}
+
+TEST_CASE("EvaluatorBase::EvaluateInto matches Evaluate", "[evaluator]")
+{
+    EvaluatorFixture fix;
+    using DTable = EvaluatorFixture::DTable;
+
+    Operon::Evaluator<DTable> mse{&fix.problem, &fix.dtable, Operon::MSE{}};
+    MinimumDescriptionLengthEvaluator<DTable, GaussianLikelihood<Operon::Scalar>> mdl{&fix.problem, &fix.dtable};
+    Operon::LengthEvaluator length{&fix.problem};
+
+    auto const ind = EvaluatorFixture::MakeIndividual(fix.tree);
+    std::vector<Operon::Scalar> buf(fix.problem.TrainingRange().Size());
+
+    auto into = [&](EvaluatorBase const& evaluator) {
+        Operon::FitnessVector fit(evaluator.ObjectiveCount());
+        evaluator.EvaluateInto(fix.rng, ind, buf, fit);
+        return fit;
+    };
+
+    // the derived criteria must not fall back to the error metric
+    CHECK(into(mse) == FitnessVector(mse(fix.rng, ind)));
+    CHECK(into(mdl) == FitnessVector(mdl(fix.rng, ind)));
+    CHECK(into(length) == FitnessVector(length(fix.rng, ind)));
+
+    Operon::MultiEvaluator me{&fix.problem};
+    me.Add(&mse);
+    me.Add(&mdl);
+    me.Add(&length);
+    CHECK(into(me) == FitnessVector(me(fix.rng, ind)));
+
+    me.SetAggregateType(MultiEvaluator::AggregateType::Sum);
+    CHECK(into(me) == FitnessVector(me(fix.rng, ind)));
+
+    // both paths count one call per scored individual
+    auto const calls = mse.CallCount.load();
+    (void)into(mse);
+    CHECK(mse.CallCount == calls + 1);
+
+    // ScoreIndividual scores into the individual's own inline fitness
+    me.ClearAggregateType();
+    auto scored = EvaluatorFixture::MakeIndividual(fix.tree);
+    ScoreIndividual(fix.rng, scored, me, /*coeffOptimizer=*/nullptr, /*pLocal=*/0.0, /*pLamarck=*/0.0, Operon::Span<Operon::Scalar>{buf});
+    REQUIRE(scored.Fitness.size() == 3);
+    CHECK(scored.Fitness.is_inline());
+    CHECK(scored.Fitness == FitnessVector(me(fix.rng, ind)));
+}
+
+TEST_CASE("EvaluatorBase: evaluators that override Evaluate still score", "[evaluator]")
+{
+    // written against the API before EvaluateInto: only Evaluate is overridden
+    struct Legacy final : public EvaluatorBase {
+        using EvaluatorBase::EvaluatorBase;
+        auto Evaluate(Operon::RandomGenerator& /*rng*/, Individual const& ind, Operon::Span<Operon::Scalar> /*buf*/) const -> ReturnType override
+        {
+            return { static_cast<Operon::Scalar>(ind.Genotype.Length()), Operon::Scalar{2} };
+        }
+        auto ObjectiveCount() const -> std::size_t override { return 2; }
+    };
+    // overrides neither
+    struct Empty final : public EvaluatorBase {
+        using EvaluatorBase::EvaluatorBase;
+    };
+
+    EvaluatorFixture fix;
+    Legacy const legacy{&fix.problem};
+    std::vector<Operon::Scalar> buf(fix.problem.TrainingRange().Size());
+    auto scored = EvaluatorFixture::MakeIndividual(fix.tree);
+    ScoreIndividual(fix.rng, scored, legacy, /*coeffOptimizer=*/nullptr, /*pLocal=*/0.0, /*pLamarck=*/0.0, Operon::Span<Operon::Scalar>{buf});
+    CHECK(scored.Fitness == FitnessVector{ static_cast<Operon::Scalar>(fix.tree.Length()), Operon::Scalar{2} });
+    CHECK(FitnessVector(legacy(fix.rng, scored)) == scored.Fitness);
+
+    Empty const empty{&fix.problem};
+    CHECK_THROWS_AS(empty(fix.rng, scored, buf), std::logic_error);
+    // the failed call leaves nothing behind for the next evaluator
+    CHECK(FitnessVector(legacy(fix.rng, scored, buf)) == scored.Fitness);
+}
+
+TEST_CASE("CrossValidationEvaluator: one pass matches per-fold scoring", "[evaluator]")
+{
+    EvaluatorFixture fix;
+    using DTable = EvaluatorFixture::DTable;
+    constexpr std::size_t folds { 5 };
+
+    auto const ind = EvaluatorFixture::MakeIndividual(InfixParser::Parse("X1 * X2 + X3", fix.ds));
+    auto const range = fix.problem.TrainingRange();
+    auto const n = range.Size();
+
+    std::vector<Operon::Scalar> estimated(n);
+    auto const coeff = ind.Genotype.GetCoefficients();
+    Operon::Interpreter<Operon::Scalar, DTable>{&fix.dtable, &fix.ds, &ind.Genotype}.Evaluate(coeff, range, estimated);
+    auto const target = fix.problem.TargetValues(range);
+
+    // reference: scale on the other folds, score the held-out one
+    auto reference = [&](ErrorMetric const& metric, bool scaling) -> std::pair<double, double> {
+        std::vector<double> errors;
+        for (auto k = 0UL; k < folds; ++k) {
+            auto const begin = k * n / folds;
+            auto const end = (k + 1) * n / folds;
+            std::vector<Operon::Scalar> xs;
+            std::vector<Operon::Scalar> ys;
+            for (auto i = 0UL; i < n; ++i) {
+                if (i < begin || i >= end) { xs.push_back(estimated[i]); ys.push_back(target[i]); }
+            }
+            auto [a, b] = scaling ? FitLeastSquares(xs, ys) : std::pair{1.0, 0.0};
+            std::vector<Operon::Scalar> held(estimated.begin() + begin, estimated.begin() + end);
+            std::ranges::transform(held, held.begin(), [a=a,b=b](auto v) -> auto { return static_cast<Operon::Scalar>((a * v) + b); });
+            errors.push_back(metric(held, target.subspan(begin, end - begin)));
+        }
+        auto const mean = std::reduce(errors.begin(), errors.end()) / folds;
+        auto const var = std::transform_reduce(errors.begin(), errors.end(), 0.0, std::plus{}, [&](auto e) { return (e - mean) * (e - mean); }) / (folds - 1);
+        return { mean, std::sqrt(var) };
+    };
+
+    for (auto type : { ErrorType::SSE, ErrorType::MSE, ErrorType::NMSE, ErrorType::RMSE, ErrorType::R2 }) {
+        for (auto scaling : { false, true }) {
+            CAPTURE(static_cast<int>(type), scaling);
+            CrossValidationEvaluator<DTable> const cv{&fix.problem, &fix.dtable, folds, ErrorMetric{type}, scaling};
+            REQUIRE(cv.ObjectiveCount() == 2);
+
+            auto const fit = cv(fix.rng, ind);
+            auto const [mean, deviation] = reference(ErrorMetric{type}, scaling);
+            CHECK_THAT(static_cast<double>(fit[0]), Catch::Matchers::WithinRel(mean, 1e-3));
+            CHECK_THAT(static_cast<double>(fit[1]), Catch::Matchers::WithinRel(deviation, 1e-2));
+            CHECK(cv.ResidualEvaluations == 1); // a single forward pass
+        }
+    }
+
+    CrossValidationEvaluator<DTable> const meanOnly{&fix.problem, &fix.dtable, folds, MSE{}, true, /*reportDeviation=*/false};
+    CHECK(meanOnly.ObjectiveCount() == 1);
+
+    CHECK_THROWS_AS((CrossValidationEvaluator<DTable>{&fix.problem, &fix.dtable, folds, MAE{}}), std::invalid_argument);
+    CHECK_THROWS_AS((CrossValidationEvaluator<DTable>{&fix.problem, &fix.dtable, 1}), std::invalid_argument);
+}
+
+TEST_CASE("SubsampledEvaluator: stratified sample estimates the full error", "[evaluator]")
+{
+    EvaluatorFixture fix;
+    using DTable = EvaluatorFixture::DTable;
+    constexpr std::size_t rows { 50 };
+
+    auto const ind = EvaluatorFixture::MakeIndividual(InfixParser::Parse("X1 * X2 + X3", fix.ds));
+    auto const range = fix.problem.TrainingRange();
+    auto const n = range.Size();
+    auto const stratum = n / rows;
+
+    std::vector<Operon::Scalar> estimated(n);
+    auto const coeff = ind.Genotype.GetCoefficients();
+    Operon::Interpreter<Operon::Scalar, DTable>{&fix.dtable, &fix.ds, &ind.Genotype}.Evaluate(coeff, range, estimated);
+    auto const target = fix.problem.TargetValues(range);
+    auto const fullSse = SSE{}(estimated, target);
+
+    SubsampledEvaluator<DTable> const sub{&fix.problem, &fix.dtable, rows, SSE{}, /*linearScaling=*/false};
+    REQUIRE(sub.SampleSize() == rows);
+
+    // one row per stratum, weighted by the stratum size
+    auto const sample = sub.SampleRows();
+    for (auto k = 0UL; k < rows; ++k) {
+        CHECK(sample[k] >= k * stratum);
+        CHECK(sample[k] < (k + 1) * stratum);
+    }
+    auto const expected = std::transform_reduce(sample.begin(), sample.end(), 0.0, std::plus{}, [&](auto r) {
+        auto const e = static_cast<double>(estimated[r]) - static_cast<double>(target[r]);
+        return static_cast<double>(stratum) * e * e;
+    });
+    CHECK_THAT(static_cast<double>(sub(fix.rng, ind)[0]), Catch::Matchers::WithinRel(expected, 1e-4));
+
+    // unbiased: averaged over many samples it approaches the full-range SSE
+    constexpr auto draws { 400 };
+    auto const epoch = sub.Epoch();
+    double mean{0};
+    for (auto i = 0; i < draws; ++i) {
+        sub.Prepare({}); // redraws the sample
+        mean += static_cast<double>(sub(fix.rng, ind)[0]) / draws;
+    }
+    CHECK(sub.SampleSize() == rows); // nothing to grow on without a population
+    CHECK(sub.Epoch() == epoch + draws);
+    CHECK_THAT(mean, Catch::Matchers::WithinRel(fullSse, 0.05));
+
+    // evaluations are charged as full-range equivalents
+    auto const calls = static_cast<std::size_t>(draws + 1);
+    CHECK(sub.CallCount == calls);
+    CHECK(sub.ResidualEvaluations == calls * rows / n);
+    CHECK(sub.SavedRowEvaluations == calls * (n - rows));
+
+    // a spread-out population keeps the sample, a converged one grows it
+    std::vector<Individual> pop(10);
+    for (auto i = 0UL; i < pop.size(); ++i) { pop[i].Fitness = { static_cast<Operon::Scalar>(i + 1) }; }
+    sub.Prepare(pop);
+    CHECK(sub.SampleSize() == rows);
+    for (auto& p : pop) { p.Fitness = { Operon::Scalar{1} }; }
+    sub.Prepare(pop);
+    CHECK(sub.SampleSize() == n);
+    auto const last = sub.Epoch();
+    sub.Prepare(pop);
+    CHECK(sub.Epoch() == last); // the full range does not change any more
+
+    // the whole range is not copied but scored in place, as Evaluator does
+    CHECK(sub.SampleRows().empty());
+    Evaluator<DTable> const full{&fix.problem, &fix.dtable, SSE{}, /*linearScaling=*/false};
+    auto const residuals = sub.ResidualEvaluations.load();
+    auto const saved = sub.SavedRowEvaluations.load();
+    CHECK(sub(fix.rng, ind)[0] == full(fix.rng, ind)[0]);
+    CHECK(sub.ResidualEvaluations == residuals + 1);
+    CHECK(sub.SavedRowEvaluations == saved);
+
+    SubsampledEvaluator<DTable> const whole{&fix.problem, &fix.dtable, 2 * n, SSE{}, /*linearScaling=*/false};
+    CHECK(whole.SampleSize() == n);
+    CHECK(whole.SampleRows().empty());
+    CHECK(whole(fix.rng, ind)[0] == full(fix.rng, ind)[0]);
+
+    CHECK_THROWS_AS((SubsampledEvaluator<DTable>{&fix.problem, &fix.dtable, 0}), std::invalid_argument);
+}
+
+TEST_CASE("FitLeastSquares against a float64 target", "[evaluator]")
+{
+    // y = 1e9 + x / 2: float32 spacing at 1e9 is 64, so the narrowed target
+    // is a staircase and only the exact values give back the line
+    constexpr auto n { 256 };
+    std::vector<float> x(n);
+    std::vector<double> y(n);
+    for (auto k = 0; k < n; ++k) {
+        x[k] = static_cast<float>(k);
+        y[k] = 1e9 + (0.5 * k); // NOLINT(readability-magic-numbers)
+    }
+    auto const [a, b] = FitLeastSquares(x, y, Operon::Span<float const>{});
+    CHECK_THAT(a, Catch::Matchers::WithinRel(0.5, 1e-9));
+    CHECK_THAT(b, Catch::Matchers::WithinRel(1e9, 1e-12));
+
+    std::vector<float> narrowed(n);
+    std::ranges::transform(y, narrowed.begin(), [](auto v) { return static_cast<float>(v); });
+    auto const [an, bn] = FitLeastSquares(x, narrowed);
+    CHECK(std::abs(an - 0.5) > 1e-3);
+}
+
+TEST_CASE("FusedScaledError matches scale-then-metric", "[evaluator]")
+{
+    constexpr auto n { 1000 };
+    Operon::RandomGenerator rng{42};
+    std::uniform_real_distribution<Operon::Scalar> dist(-1.F, +1.F);
+    std::vector<Operon::Scalar> x(n);
+    std::vector<Operon::Scalar> y(n);
+    std::vector<Operon::Scalar> w(n);
+    std::ranges::generate(x, [&]() -> Operon::Scalar { return dist(rng); });
+    std::ranges::transform(x, y.begin(), [&](auto v) -> Operon::Scalar { return (3 * v) - 1 + dist(rng); });
+    std::ranges::generate(w, [&]() -> Operon::Scalar { return std::abs(dist(rng)) + 0.1F; });
+
+    auto reference = [&](ErrorMetric const& metric, bool weighted) -> double {
+        std::vector<Operon::Scalar> scaled(x);
+        auto [a, b] = weighted ? FitLeastSquares(scaled, y, w) : FitLeastSquares(scaled, y);
+        std::ranges::transform(scaled, scaled.begin(), [a=a,b=b](auto v) -> auto { return static_cast<Operon::Scalar>((a * v) + b); });
+        return weighted ? metric(scaled, y, w) : metric(scaled, y);
+    };
+
+    for (auto type : { ErrorType::SSE, ErrorType::MSE, ErrorType::NMSE, ErrorType::RMSE, ErrorType::R2, ErrorType::C2 }) {
+        for (auto weighted : { false, true }) {
+            CAPTURE(static_cast<int>(type), weighted);
+            auto const fused = weighted ? FusedScaledError(type, x, y, w) : FusedScaledError(type, x, y);
+            if (type == ErrorType::SSE && weighted) {
+                CHECK_FALSE(fused.has_value());
+                continue;
+            }
+            REQUIRE(fused.has_value());
+            CHECK_THAT(*fused, Catch::Matchers::WithinRel(reference(ErrorMetric{type}, weighted), 1e-4));
+        }
+    }
+
+    SECTION("No closed form or no precision: fall back") {
+        CHECK_FALSE(FusedScaledError(ErrorType::MAE, x, y).has_value());
+        std::vector<Operon::Scalar> exact(y);
+        std::ranges::transform(y, exact.begin(), [](auto v) -> auto { return (2 * v) + 1; }); // perfect after scaling
+        CHECK_FALSE(FusedScaledError(ErrorType::MSE, exact, y).has_value());
+        std::vector<Operon::Scalar> nan(x);
+        nan[3] = std::numeric_limits<Operon::Scalar>::quiet_NaN();
+        CHECK_FALSE(FusedScaledError(ErrorType::MSE, nan, y).has_value());
+    }
+
+    SECTION("Evaluator scores through the fused kernel") {
+        EvaluatorFixture fix;
+        using DTable = EvaluatorFixture::DTable;
+        auto ind = EvaluatorFixture::MakeIndividual(InfixParser::Parse("X1 + X2", fix.ds));
+        std::vector<Operon::Scalar> buf(EvaluatorFixture::Nrow);
+        Evaluator<DTable> const ev{&fix.problem, &fix.dtable, MSE{}, /*linearScaling=*/true};
+        auto const fit = ev.Evaluate(fix.rng, ind, buf).front();
+        // the fused path leaves the unscaled predictions in the buffer
+        auto const expected = FusedScaledError(ErrorType::MSE, buf, fix.problem.TargetValues(fix.problem.TrainingRange()));
+        REQUIRE(expected.has_value());
+        CHECK(fit == static_cast<Operon::Scalar>(*expected));
+    }
+}
+
 // ──────────────────────────────────────────────────────────────────────────────
 // EvaluatorBase::Evaluate (deducing-this) dispatch
 //
@@ -3,6 +3,7 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <numeric>
@@ -25,10 +26,12 @@
 #include "operon/operators/evaluator.hpp"
 #include "operon/operators/generator.hpp"
 #include "operon/operators/initializer.hpp"
+#include "operon/operators/local_search.hpp"
 #include "operon/operators/mutation.hpp"
 #include "operon/operators/non_dominated_sorter.hpp"
 #include "operon/operators/reinserter.hpp"
 #include "operon/operators/selector.hpp"
+#include "operon/optimizer/optimizer.hpp"
 
 namespace Operon::Test {
 namespace {
@@ -99,6 +102,40 @@ struct GaBaseFixture {
     }
 };
 
+// Declares itself batched and records the size of every OptimizeBatch call;
+// the fits themselves are `inner`'s, one tree at a time.
+struct BatchRecorder final : public Operon::OptimizerBase {
+    BatchRecorder(Operon::OptimizerBase const* inner, Operon::Problem const* problem)
+        : OptimizerBase{problem}, inner_{inner}
+    {
+    }
+
+    [[nodiscard]] auto Optimize(Operon::RandomGenerator& rng, Operon::Tree const& tree) const -> FitOutcome override { return inner_->Optimize(rng, tree); }
+
+    [[nodiscard]] auto OptimizeBatch(Operon::Span<Operon::RandomGenerator> rngs, Operon::Span<Operon::Tree const* const> trees) const -> std::vector<FitOutcome> override
+    {
+        Batches.push_back(trees.size());
+        return OptimizerBase::OptimizeBatch(rngs, trees);
+    }
+
+    [[nodiscard]] auto Batched() const -> bool override { return true; }
+
+    [[nodiscard]] auto ComputeLikelihood(Operon::Span<Operon::Scalar const> x, Operon::Span<Operon::Scalar const> y, Operon::Span<Operon::Scalar const> w) const -> Operon::Scalar override
+    {
+        return inner_->ComputeLikelihood(x, y, w);
+    }
+
+    [[nodiscard]] auto ComputeFisherMatrix(Operon::Span<Operon::Scalar const> pred, Operon::Span<Operon::Scalar const> jac, Operon::Span<Operon::Scalar const> sigma) const -> Eigen::Matrix<Operon::Scalar, -1, -1> override
+    {
+        return inner_->ComputeFisherMatrix(pred, jac, sigma);
+    }
+
+    mutable std::vector<std::size_t> Batches;
+
+private:
+    Operon::OptimizerBase const* inner_;
+};
+
 } // namespace
 
 TEST_CASE("RestoreIndividuals maps parents and offspring spans correctly", "[algorithms]")
@@ -313,6 +350,49 @@ TEST_CASE("NSGA2: keep-best and replace-worst reinserters produce different resu
     CHECK(keepBestFitness != replaceWorstFitness);
 }
 
+TEST_CASE("A block of offspring is optimized in one batch and scored as one at a time", "[algorithms]")
+{
+    GaBaseFixture f;
+    Operon::RandomGenerator rng{42};
+
+    std::vector<Operon::Individual> pop(GaBaseFixture::PopSize);
+    std::vector<Operon::Scalar> buf(f.Problem.TrainingRange().Size());
+    for (auto& ind : pop) {
+        ind.Genotype = f.TreeInit(rng);
+        f.CoeffInit(rng, ind.Genotype);
+        ind.Fitness = f.Evaluator(rng, ind, buf);
+    }
+
+    Operon::LevenbergMarquardtOptimizer<DTable, Operon::OptimizerType::Tiny> const lm{&f.Dtable, &f.Problem};
+    BatchRecorder const recorder{&lm, &f.Problem};
+    lm.SetIterations(10);       // NOLINT
+    recorder.SetIterations(10); // NOLINT
+    Operon::CoefficientOptimizer const single{&lm};
+    Operon::CoefficientOptimizer const batched{&recorder};
+    Operon::BasicOffspringGenerator const one{ &f.Evaluator, &f.Crossover, &f.Mutator, &f.FemSel, &f.MaleSel, &single };
+    Operon::BasicOffspringGenerator const block{ &f.Evaluator, &f.Crossover, &f.Mutator, &f.FemSel, &f.MaleSel, &batched };
+    one.Prepare(pop);
+    block.Prepare(pop);
+
+    constexpr auto n { GaBaseFixture::PopSize };
+    std::vector<Operon::RandomGenerator> rngs;
+    for (auto i = 0UL; i < n; ++i) { rngs.emplace_back(rng()); }
+    auto copies = rngs;
+
+    std::vector<Operon::Individual> offspring(n);
+    auto const filled = block.GenerateBatch(rngs, /*pCrossover=*/0.9, /*pMutation=*/0.5, /*pLocal=*/1.0, /*pLamarck=*/1.0, buf, offspring);
+    CHECK(std::ranges::all_of(filled, [](auto f) { return f != 0; }));
+    CHECK(recorder.Batches == std::vector<std::size_t>{ n });
+
+    for (auto i = 0UL; i < n; ++i) {
+        auto const expected = one(copies[i], 0.9, 0.5, 1.0, 1.0, buf);
+        REQUIRE(expected.has_value());
+        CHECK(offspring[i].Genotype.Nodes().size() == expected->Genotype.Nodes().size());
+        CHECK(offspring[i].Genotype.GetCoefficients() == expected->Genotype.GetCoefficients());
+        CHECK(offspring[i].Fitness == expected->Fitness);
+    }
+}
+
 TEST_CASE("Generation/Elapsed/IsFitted return by value for const objects, by reference for mutable, regardless of value category", "[algorithms]")
 {
     // The pre-deducing-this overloads were never ref-qualified, so the const
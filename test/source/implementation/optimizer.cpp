@@ -2,15 +2,32 @@
 // SPDX-FileCopyrightText: Copyright 2019-2025 Heal Research
 // SPDX-FileCopyrightText: Copyright 2025-present Bogdan Burlacu and contributors
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <taskflow/taskflow.hpp>
 
+#include "../operon_test.hpp"
 #include "operon/core/dataset.hpp"
 #include "operon/core/types.hpp"
 #include "operon/operators/local_search.hpp"
 #include "operon/optimizer/likelihood/gaussian_likelihood.hpp"
 #include "operon/optimizer/likelihood/poisson_likelihood.hpp"
 #include "operon/optimizer/optimizer.hpp"
+#include "operon/optimizer/robust_loss.hpp"
 #include "operon/optimizer/solvers/sgd.hpp"
 #include "operon/parser/infix.hpp"
 #include "operon/random/random.hpp"
@@ -154,6 +171,21 @@ TEST_CASE("Parameter optimization", "[optimizer]") // NOLINT(readability-functio
         checkExact(optimizer);
     }
 
+    SECTION("batched solver") {
+        BatchedLevenbergMarquardtOptimizer<DTable> optimizer{&dtable, &problem};
+        checkExact(optimizer);
+    }
+
+    SECTION("variable projection") {
+        VariableProjectionOptimizer<DTable> optimizer{&dtable, &problem};
+        checkExact(optimizer);
+    }
+
+    SECTION("newton") {
+        NewtonOptimizer<DTable> optimizer{&dtable, &problem};
+        checkExact(optimizer);
+    }
+
     SECTION("lbfgs / gaussian") {
         LBFGSOptimizer<DTable, GaussianLoss<Operon::Scalar>> optimizer{&dtable, &problem};
         checkExact(optimizer);
@@ -257,6 +289,672 @@ struct WeightedOptimizerFixture {
     }
 };
 
+TEST_CASE("Batched Levenberg-Marquardt", "[optimizer]")
+{
+    OptimizerFixture fix;
+    auto& rng = fix.rng;
+    using DTable = OptimizerFixture::DTable;
+
+    SECTION("batched Cholesky agrees with Eigen") {
+        constexpr std::size_t p { 4 };
+        constexpr std::size_t batch { 7 };
+        std::vector<Eigen::MatrixXd> systems;
+        std::vector<Eigen::VectorXd> rhs;
+        std::vector<double> a(p * p * batch);
+        std::vector<double> y(p * batch);
+        std::vector<std::uint8_t> ok(batch, 1);
+        for (auto b = 0UL; b < batch; ++b) {
+            Eigen::MatrixXd m(p, p);
+            Eigen::VectorXd v(p);
+            std::generate_n(m.data(), m.size(), [&]() { return Operon::Random::Uniform(rng, -1.0, +1.0); });
+            std::generate_n(v.data(), v.size(), [&]() { return Operon::Random::Uniform(rng, -1.0, +1.0); });
+            auto const& s = systems.emplace_back((m.transpose() * m) + Eigen::MatrixXd::Identity(p, p));
+            auto const& r = rhs.emplace_back(v);
+            for (auto i = 0UL; i < p; ++i) {
+                for (auto j = 0UL; j < p; ++j) { a[(((i * p) + j) * batch) + b] = s(i, j); }
+                y[(i * batch) + b] = r(i);
+            }
+        }
+        // an indefinite system is flagged without affecting its neighbours
+        a[(((1 * p) + 1) * batch) + 3] = -1.0;
+
+        BatchCholeskySolve<double>(p, batch, a, y, ok);
+        for (auto b = 0UL; b < batch; ++b) {
+            if (b == 3) { CHECK(ok[b] == 0); continue; }
+            REQUIRE(ok[b] == 1);
+            Eigen::VectorXd const x = systems[b].ldlt().solve(rhs[b]);
+            for (auto i = 0UL; i < p; ++i) {
+                CHECK_THAT(y[(i * batch) + b], Catch::Matchers::WithinAbs(x(i), 1e-10));
+            }
+        }
+    }
+
+    SECTION("a batch fits every tree as the tiny solver fits it alone") {
+        // different coefficient counts, so the batch is solved in groups
+        std::vector<Operon::Tree> trees;
+        for (auto const* expr : { "X1 + X2 + X3", "X1 * X2 + X3", "sin(X1) + X2 * X3", "X1 + X2", "X1 * X1 + X2 + X3 + X1 * X3" }) {
+            trees.push_back(InfixParser::Parse(expr, fix.ds));
+        }
+        // the same shapes with other coefficients share an interpreter
+        for (auto i : { 1UL, 2UL }) {
+            auto copy = trees[i];
+            auto coeff = copy.GetCoefficients();
+            std::ranges::transform(coeff, coeff.begin(), [](auto c) { return -2 * c; });
+            copy.SetCoefficients(coeff);
+            trees.push_back(std::move(copy));
+        }
+        std::vector<Operon::Tree const*> pointers;
+        std::vector<Operon::RandomGenerator> rngs;
+        for (auto const& t : trees) {
+            pointers.push_back(&t);
+            rngs.emplace_back(rng());
+        }
+
+        BatchedLevenbergMarquardtOptimizer<DTable> const batched{&fix.dtable, &fix.problem};
+        LevenbergMarquardtOptimizer<DTable, OptimizerType::Tiny> const tiny{&fix.dtable, &fix.problem};
+        batched.SetIterations(50); // NOLINT
+        tiny.SetIterations(50);    // NOLINT
+
+        auto const outcomes = batched.OptimizeBatch(rngs, pointers);
+        REQUIRE(outcomes.size() == trees.size());
+        for (auto i = 0UL; i < trees.size(); ++i) {
+            auto const& diag = Diagnostics(outcomes[i]);
+            auto const alone = tiny.Optimize(rng, trees[i]);
+            auto const& reference = Diagnostics(alone);
+            CHECK(diag.FinalCost <= diag.InitialCost);
+            CHECK_THAT(diag.InitialCost, Catch::Matchers::WithinRel(reference.InitialCost, 1e-4F));
+            CHECK_THAT(diag.FinalCost, Catch::Matchers::WithinRel(reference.FinalCost, 1e-2F) || Catch::Matchers::WithinAbs(reference.FinalCost, 1e-5F));
+            CHECK(diag.Iterations <= 50);
+            CHECK(diag.JacobianEvaluations == diag.Iterations + 1);
+        }
+
+        // CoefficientOptimizer writes the fitted coefficients back
+        CoefficientOptimizer const coeffOptimizer{&batched};
+        auto const fitted = coeffOptimizer.OptimizeBatch(rngs, trees);
+        for (auto i = 0UL; i < trees.size(); ++i) {
+            if (fitted[i]) { CHECK(trees[i].GetCoefficients() == fitted[i]->FinalParameters); }
+        }
+    }
+}
+
+TEST_CASE("Variable projection", "[optimizer]")
+{
+    OptimizerFixture fix;
+    auto& rng = fix.rng;
+    using DTable = OptimizerFixture::DTable;
+
+    VariableProjectionOptimizer<DTable> const varpro{&fix.dtable, &fix.problem};
+    LevenbergMarquardtOptimizer<DTable, OptimizerType::Tiny> const tiny{&fix.dtable, &fix.problem};
+    varpro.SetIterations(50); // NOLINT
+    tiny.SetIterations(50);   // NOLINT
+
+    SECTION("linear coefficients are found structurally") {
+        // one of the two weights in the product scales it linearly, the
+        // other then multiplies it; the weight of X3 sits inside exp
+        auto const tree = InfixParser::Parse("X1 * X2 + exp(X3)", fix.ds);
+        CHECK(LinearCoefficients(tree).size() == 1);
+        CHECK(LinearCoefficients(fix.tree) == Operon::Vector<std::size_t>{ 0, 1, 2 });
+    }
+
+    SECTION("a model linear in its coefficients is solved without iterating") {
+        auto const outcome = varpro.Optimize(rng, fix.tree);
+        auto const reference = tiny.Optimize(rng, fix.tree);
+        auto const& diag = Diagnostics(outcome);
+        auto const& ref = Diagnostics(reference);
+        CHECK(diag.Iterations == 0);
+        CHECK(diag.FunctionEvaluations == 1);
+        CHECK(diag.JacobianEvaluations == 1);
+        CHECK(diag.Iterations < ref.Iterations);
+        CHECK(diag.FunctionEvaluations < ref.FunctionEvaluations);
+        CHECK(diag.JacobianEvaluations < ref.JacobianEvaluations);
+        CHECK(diag.FinalCost < 1e-3F);
+    }
+
+    SECTION("only the nonlinear coefficients are iterated on") {
+        auto const tree = InfixParser::Parse("X1 + X2 + exp(X3)", fix.ds);
+        REQUIRE(LinearCoefficients(tree).size() == 2);
+        auto const outcome = varpro.Optimize(rng, tree);
+        auto const reference = tiny.Optimize(rng, tree);
+        auto const& diag = Diagnostics(outcome);
+        auto const& ref = Diagnostics(reference);
+        CHECK(diag.FinalCost < diag.InitialCost);
+        CHECK(diag.FinalCost <= ref.FinalCost * 1.01F + 1e-5F); // NOLINT
+        CHECK(diag.Iterations <= ref.Iterations);
+        // every pass, trial points included, is a Jacobian pass (Phi is
+        // needed to project), so the pass counts are compared against all of
+        // Tiny's, residual-only ones included
+        CHECK(diag.JacobianEvaluations == diag.FunctionEvaluations);
+        CHECK(diag.JacobianEvaluations <= ref.FunctionEvaluations);
+    }
+
+    SECTION("collinear linear terms") {
+        // 50 rows and three linear terms of which two are the same column:
+        // Phi is 50 x 3 of rank 2, and the least-squares solve must still
+        // give finite coefficients and the nonlinear fit go ahead
+        Operon::Problem problem{&fix.ds};
+        problem.SetTrainingRange({0, 50}); // NOLINT
+        problem.SetTestRange({0, 50}); // NOLINT
+        problem.SetTarget("X4");
+        VariableProjectionOptimizer<DTable> const small{&fix.dtable, &problem};
+        LevenbergMarquardtOptimizer<DTable, OptimizerType::Tiny> const reference{&fix.dtable, &problem};
+        small.SetIterations(50); // NOLINT
+        reference.SetIterations(50); // NOLINT
+
+        auto const tree = InfixParser::Parse("X1 + X2 + X1 + exp(X3)", fix.ds);
+        REQUIRE(LinearCoefficients(tree).size() == 3);
+        auto const diag = Diagnostics(small.Optimize(rng, tree));
+        auto const ref = Diagnostics(reference.Optimize(rng, tree));
+        CHECK(diag.FinalCost < diag.InitialCost);
+        CHECK(std::ranges::all_of(diag.FinalParameters, [](auto c) { return std::isfinite(c); }));
+        CHECK(diag.FinalCost <= ref.FinalCost * 1.01F + 1e-5F); // NOLINT
+    }
+}
+
+TEST_CASE("Newton trust region", "[optimizer]")
+{
+    OptimizerFixture fix;
+    auto& rng = fix.rng;
+    using DTable = OptimizerFixture::DTable;
+
+    NewtonOptimizer<DTable> const newton{&fix.dtable, &fix.problem};
+    LevenbergMarquardtOptimizer<DTable, OptimizerType::Tiny> const tiny{&fix.dtable, &fix.problem};
+    newton.SetIterations(50); // NOLINT
+    tiny.SetIterations(50);   // NOLINT
+
+    SECTION("coupled coefficients with a large residual") {
+        // the two weights inside exp are coupled and the model cannot fit
+        // the target, so the Gauss-Newton Hessian is a poor approximation
+        auto const tree = InfixParser::Parse("exp(X1 + X2) + X3", fix.ds);
+        REQUIRE(HasSymbolicDerivatives(tree));
+        auto const outcome = newton.Optimize(rng, tree);
+        auto const reference = tiny.Optimize(rng, tree);
+        auto const& diag = Diagnostics(outcome);
+        auto const& ref = Diagnostics(reference);
+        CHECK(diag.FinalCost < diag.InitialCost);
+        CHECK_THAT(diag.FinalCost, Catch::Matchers::WithinRel(ref.FinalCost, 1e-3F));
+        CHECK(diag.Iterations < ref.Iterations);
+        CHECK(diag.FunctionEvaluations < ref.FunctionEvaluations);
+        CHECK(diag.HessianEvaluations == diag.Iterations + 1);
+        CHECK(ref.HessianEvaluations == 0);
+    }
+
+    SECTION("trees without symbolic derivatives fall back to Gauss-Newton") {
+        auto const tree = InfixParser::Parse("abs(X1) + X2 + X3", fix.ds);
+        CHECK_FALSE(HasSymbolicDerivatives(tree));
+        auto const outcome = newton.Optimize(rng, tree);
+        auto const& diag = Diagnostics(outcome);
+        CHECK(diag.FinalCost < diag.InitialCost);
+        CHECK(diag.JacobianEvaluations == diag.Iterations + 1);
+        CHECK(diag.HessianEvaluations == 0);
+    }
+}
+
+TEST_CASE("Early stopping and local search budget", "[optimizer]")
+{
+    OptimizerFixture fix;
+    auto& rng = fix.rng;
+    using DTable = OptimizerFixture::DTable;
+
+    auto const tree = InfixParser::Parse("exp(X1 + X2) + X3", fix.ds);
+
+    auto stopsEarly = [&](OptimizerBase const& optimizer) {
+        optimizer.SetIterations(50); // NOLINT
+        auto const full = Diagnostics(optimizer.Optimize(rng, tree));
+        optimizer.SetStopping({ .RelativeImprovement = 1e-2 }); // NOLINT
+        auto const early = Diagnostics(optimizer.Optimize(rng, tree));
+        CHECK(early.FinalCost < early.InitialCost);
+        CHECK(early.FinalCost >= full.FinalCost);
+        CHECK(early.JacobianEvaluations <= full.JacobianEvaluations);
+        CHECK(early.Iterations <= full.Iterations);
+    };
+
+    SECTION("relative improvement / tiny") {
+        stopsEarly(LevenbergMarquardtOptimizer<DTable, OptimizerType::Tiny>{&fix.dtable, &fix.problem});
+    }
+
+    SECTION("relative improvement / eigen") {
+        stopsEarly(LevenbergMarquardtOptimizer<DTable, OptimizerType::Eigen>{&fix.dtable, &fix.problem});
+    }
+
+    SECTION("relative improvement / newton") {
+        stopsEarly(NewtonOptimizer<DTable>{&fix.dtable, &fix.problem});
+    }
+
+    SECTION("a scope overrides the iteration budget on its thread") {
+        LevenbergMarquardtOptimizer<DTable, OptimizerType::Tiny> const tiny{&fix.dtable, &fix.problem};
+        tiny.SetIterations(10); // NOLINT
+        {
+            LocalSearchBudget::Scope const outer{3};
+            CHECK(tiny.Iterations() == 3);
+            {
+                LocalSearchBudget::Scope const inner{1};
+                CHECK(tiny.Iterations() == 1);
+                CHECK(Diagnostics(tiny.Optimize(rng, tree)).Iterations <= 1);
+            }
+            CHECK(tiny.Iterations() == 3);
+        }
+        CHECK(tiny.Iterations() == 10);
+        CHECK(tiny.ConfiguredIterations() == 10);
+    }
+
+    SECTION("offspring of better parents get more iterations") {
+        LevenbergMarquardtOptimizer<DTable, OptimizerType::Tiny> const tiny{&fix.dtable, &fix.problem};
+        tiny.SetIterations(20); // NOLINT
+        LocalSearchBudget const budget{&tiny};
+        CHECK(budget.Iterations(0) == 20); // not prepared: the static budget
+
+        std::vector<Individual> population(10); // NOLINT
+        for (auto i = 0UL; i < population.size(); ++i) { population[i][0] = static_cast<Operon::Scalar>(i); }
+        budget.Prepare(population);
+
+        // raw scales 1.75, 1 and 0.4, each divided by the running mean with
+        // the prior 1 as one more draw: 1.375, 1.25 and 1.0375
+        auto const best = budget.Iterations(0);
+        auto const median = budget.Iterations(5); // NOLINT
+        auto const worst = budget.Iterations(9);  // NOLINT
+        CHECK(best == 25); // NOLINT 20 * 1.75 / 1.375
+        CHECK(median == 16); // NOLINT 20 / 1.25
+        CHECK(worst == 8); // NOLINT 20 * 0.4 / 1.0375
+        CHECK(budget.Allotted() == 20 + best + median + worst);
+        CHECK(budget.Baseline() == 4 * 20);
+
+        CHECK_THROWS_AS((LocalSearchBudget{&tiny, { .MinScale = 0 }}), std::invalid_argument);
+        CHECK_THROWS_AS((LocalSearchBudget{&tiny, { .MinScale = 2, .MaxScale = 1 }}), std::invalid_argument);
+    }
+
+    SECTION("under selection the budget costs what the static setting does") {
+        LevenbergMarquardtOptimizer<DTable, OptimizerType::Tiny> const tiny{&fix.dtable, &fix.problem};
+        tiny.SetIterations(10); // NOLINT
+        auto const fixed = Diagnostics(tiny.Optimize(rng, tree)).JacobianEvaluations;
+        LocalSearchBudget const budget{&tiny};
+
+        std::vector<Individual> population(100); // NOLINT
+        for (auto i = 0UL; i < population.size(); ++i) { population[i][0] = static_cast<Operon::Scalar>(i); }
+
+        // the better of two parents, each the winner of a binary tournament:
+        // the parent quantile crowds towards 0
+        std::uniform_int_distribution<std::size_t> pick(0, population.size() - 1);
+        auto parent = [&]() { return static_cast<Operon::Scalar>(std::min({ pick(rng), pick(rng), pick(rng), pick(rng) })); };
+
+        constexpr auto generations{4};
+        constexpr auto offspring{100};
+        std::size_t allotted{0};
+        std::size_t baseline{0};
+        std::size_t jacobians{0};
+        for (auto g = 0; g < generations; ++g) {
+            budget.Prepare(population);
+            for (auto k = 0; k < offspring; ++k) {
+                auto const iterations = budget.Iterations(parent());
+                LocalSearchBudget::Scope const scope{iterations};
+                auto const evaluations = Diagnostics(tiny.Optimize(rng, tree)).JacobianEvaluations;
+                allotted += iterations;
+                baseline += tiny.ConfiguredIterations();
+                jacobians += evaluations;
+            }
+        }
+        // the first generation included: it is normalized by its own draws
+        auto const fits = static_cast<double>(generations * offspring);
+        CHECK_THAT(static_cast<double>(allotted) / static_cast<double>(baseline), Catch::Matchers::WithinAbs(1.0, 0.1));
+        CHECK(static_cast<double>(jacobians) <= 1.1 * fits * static_cast<double>(fixed)); // NOLINT
+    }
+}
+
+TEST_CASE("Row-parallel Levenberg-Marquardt", "[optimizer]")
+{
+    OptimizerFixture fix;
+    auto& rng = fix.rng;
+    using DTable = OptimizerFixture::DTable;
+
+    auto const tree = InfixParser::Parse("exp(X1 + X2) + X3", fix.ds);
+    tf::Executor executor(4); // NOLINT
+
+    // the blocks evaluate the same rows as the serial path, so the fits agree
+    auto agrees = [&](OptimizerBase const& optimizer) {
+        optimizer.SetIterations(20); // NOLINT
+        auto const serial = Diagnostics(optimizer.Optimize(rng, tree));
+        optimizer.SetRowParallelism({ .Executor = &executor, .MinBlockRows = 64 }); // NOLINT
+        {
+            // the fits below are split, or they would agree trivially
+            detail::RowBlockFit<DTable> const rowBlocks{optimizer, &fix.dtable, &fix.ds, &tree};
+            Interpreter<Operon::Scalar, DTable> interpreter{&fix.dtable, &fix.ds, &tree};
+            LMCostFunction<Operon::Scalar> cf{&interpreter, fix.problem.TargetValues(), fix.problem.TrainingRange()};
+            rowBlocks.Bind(cf);
+            REQUIRE(cf.RowBlockCount() > 1);
+        }
+
+        auto const parallel = Diagnostics(optimizer.Optimize(rng, tree));
+        CHECK(parallel.Iterations == serial.Iterations);
+        CHECK_THAT(parallel.FinalCost, Catch::Matchers::WithinRel(serial.FinalCost, 1e-5F));
+
+        // from inside a worker, the blocks are co-run on the same executor
+        FitDiagnostics nested;
+        tf::Taskflow taskflow;
+        taskflow.emplace([&]() { nested = Diagnostics(optimizer.Optimize(rng, tree)); });
+        executor.run(taskflow).get();
+        CHECK(nested.Iterations == serial.Iterations);
+        CHECK_THAT(nested.FinalCost, Catch::Matchers::WithinRel(serial.FinalCost, 1e-5F));
+        CHECK(optimizer.FitsInFlight().load() == 0);
+    };
+
+    SECTION("tiny") {
+        agrees(LevenbergMarquardtOptimizer<DTable, OptimizerType::Tiny>{&fix.dtable, &fix.problem});
+    }
+
+    SECTION("eigen") {
+        agrees(LevenbergMarquardtOptimizer<DTable, OptimizerType::Eigen>{&fix.dtable, &fix.problem});
+    }
+
+    SECTION("row blocks evaluate what the serial path does") {
+        std::atomic<std::size_t> busy{1};
+        Interpreter<Operon::Scalar, DTable> interpreter{&fix.dtable, &fix.ds, &tree};
+        std::vector<Interpreter<Operon::Scalar, DTable>> pool;
+        LMRowBlocks<Operon::Scalar> blocks{ .Executor = &executor, .Interpreters = {}, .Busy = &busy, .MinBlockRows = 64 }; // NOLINT
+        pool.reserve(executor.num_workers());
+        for (auto i = 0UL; i < executor.num_workers(); ++i) { blocks.Interpreters.push_back(&pool.emplace_back(&fix.dtable, &fix.ds, &tree)); }
+
+        LMCostFunction<Operon::Scalar> serial{&interpreter, fix.problem.TargetValues(), fix.problem.TrainingRange()};
+        LMCostFunction<Operon::Scalar> split{&interpreter, fix.problem.TargetValues(), fix.problem.TrainingRange()};
+        split.SetRowBlocks(std::move(blocks));
+        REQUIRE(split.RowBlockCount() > 1);
+
+        auto const x = tree.GetCoefficients();
+        auto const size = serial.NumResiduals() * (serial.NumParameters() + 1);
+        std::vector<Operon::Scalar> expected(size);
+        std::vector<Operon::Scalar> actual(size);
+        serial.Evaluate(x.data(), expected.data(), expected.data() + serial.NumResiduals());
+        auto close = [](auto a, auto b) { return std::abs(a - b) <= 1e-5F * (1 + std::abs(b)); }; // NOLINT
+        // the second evaluation reruns the taskflow the first one built
+        for (auto i = 0; i < 2; ++i) {
+            std::ranges::fill(actual, Operon::Scalar{0});
+            split.Evaluate(x.data(), actual.data(), actual.data() + split.NumResiduals());
+            CHECK(std::ranges::equal(actual, expected, close));
+        }
+    }
+
+    SECTION("a busy executor keeps fits serial") {
+        std::atomic<std::size_t> busy{4};
+        Interpreter<Operon::Scalar, DTable> interpreter{&fix.dtable, &fix.ds, &tree};
+        LMCostFunction<Operon::Scalar> cf{&interpreter, fix.problem.TargetValues(), fix.problem.TrainingRange()};
+        cf.SetRowBlocks({ .Executor = &executor, .Interpreters = { &interpreter, &interpreter, &interpreter, &interpreter }, .Busy = &busy, .MinBlockRows = 64 }); // NOLINT
+        CHECK(cf.RowBlockCount() == 1);
+        busy = 2;
+        CHECK(cf.RowBlockCount() == 3);
+        busy = 1;
+        CHECK(cf.RowBlockCount() == 4);
+    }
+}
+
+TEST_CASE("Coefficient warm start", "[optimizer]")
+{
+    OptimizerFixture fix;
+    auto& rng = fix.rng;
+    using DTable = OptimizerFixture::DTable;
+
+    auto withValues = [](Tree tree, Operon::Scalar first) {
+        for (auto& node : tree.Nodes()) {
+            if (node.Optimize) { node.Value = first++; }
+        }
+        return tree;
+    };
+
+    SECTION("subtrees inherit their parents' coefficients") {
+        auto const parent1 = withValues(InfixParser::Parse("X1 * X2 + sin(X3)", fix.ds), 10); // NOLINT
+        auto const parent2 = withValues(InfixParser::Parse("exp(X1) - X2", fix.ds), 20); // NOLINT
+        auto child = withValues(InfixParser::Parse("X1 * X2 + exp(X1)", fix.ds), 0);
+        CHECK(InheritCoefficients(child, parent1, parent2) == 3);
+
+        // parent1's coefficients are numbered from 10, parent2's from 20
+        auto const coefficients = child.GetCoefficients();
+        CHECK(std::ranges::count_if(coefficients, [](auto c) { return c >= 10 && c < 20; }) == 2); // NOLINT
+        CHECK(std::ranges::count_if(coefficients, [](auto c) { return c >= 20; }) == 1); // NOLINT
+    }
+
+    SECTION("a child laid out like its parent keeps its coefficients") {
+        auto const parent = withValues(InfixParser::Parse("X1 * X2 + sin(X3)", fix.ds), 10); // NOLINT
+        auto child = withValues(parent, 0);
+        CHECK(InheritCoefficients(child, parent, parent) == 0);
+        CHECK(child.GetCoefficients() == withValues(parent, 0).GetCoefficients());
+    }
+
+    SECTION("the linear coefficients start at their least-squares values") {
+        LevenbergMarquardtOptimizer<DTable, OptimizerType::Tiny> const tiny{&fix.dtable, &fix.problem};
+        tiny.SetIterations(50); // NOLINT
+        auto const cold = Diagnostics(tiny.Optimize(rng, fix.tree));
+        tiny.SetLinearWarmStart(true);
+        auto const warm = Diagnostics(tiny.Optimize(rng, fix.tree));
+        // a linear model is solved by the projection alone
+        CHECK(warm.InitialCost == cold.InitialCost);
+        CHECK(warm.Iterations < cold.Iterations);
+        CHECK(warm.FinalCost < 1e-3F);
+        for (auto const c : warm.FinalParameters) {
+            CHECK_THAT(c, Catch::Matchers::WithinAbs(1.0F, 0.01F));
+        }
+    }
+
+    SECTION("the projection never raises the cost") {
+        auto const tree = InfixParser::Parse("exp(X1 + X2) + X3", fix.ds);
+        Interpreter<Operon::Scalar, DTable> interpreter{&fix.dtable, &fix.ds, &tree};
+        LMCostFunction<Operon::Scalar> cf{&interpreter, fix.problem.TargetValues(), fix.problem.TrainingRange()};
+        auto const cost = [&](std::vector<Operon::Scalar> const& x) {
+            std::vector<Operon::Scalar> r(cf.NumResiduals());
+            cf.Evaluate(x.data(), r.data(), nullptr);
+            return 0.5 * std::transform_reduce(r.begin(), r.end(), 0.0, std::plus{}, [](auto v) { return static_cast<double>(v) * v; }); // NOLINT
+        };
+
+        // X3's weight, the only linear coefficient, far from its optimum
+        auto start = tree.GetCoefficients();
+        start.back() = 10; // NOLINT
+        auto x = start;
+        auto const before = detail::ProjectLinearCoefficients(cf, tree, x);
+        REQUIRE(before.has_value());
+        CHECK_THAT(*before, Catch::Matchers::WithinRel(cost(start), 1e-4)); // NOLINT
+        CHECK(x != start);
+        CHECK(cost(x) < *before);
+
+        // nothing to project, nothing evaluated
+        auto const nonlinear = InfixParser::Parse("exp(X1 + X2)", fix.ds);
+        Interpreter<Operon::Scalar, DTable> other{&fix.dtable, &fix.ds, &nonlinear};
+        LMCostFunction<Operon::Scalar> none{&other, fix.problem.TargetValues(), fix.problem.TrainingRange()};
+        auto y = nonlinear.GetCoefficients();
+        CHECK_FALSE(detail::ProjectLinearCoefficients(none, nonlinear, y).has_value());
+        CHECK(y == nonlinear.GetCoefficients());
+        CHECK(none.ResidualCalls() == 0);
+        CHECK(none.JacobianCalls() == 0);
+    }
+
+    SECTION("the batched and Newton optimizers project the first linearization") {
+        BatchedLevenbergMarquardtOptimizer<DTable> const batched{&fix.dtable, &fix.problem};
+        NewtonOptimizer<DTable> const newton{&fix.dtable, &fix.problem};
+        for (OptimizerBase const* optimizer : std::array<OptimizerBase const*, 2>{ &batched, &newton }) {
+            REQUIRE(optimizer->LinearWarmStartSupported());
+            optimizer->SetIterations(50); // NOLINT
+            auto const cold = Diagnostics(optimizer->Optimize(rng, fix.tree));
+            optimizer->SetLinearWarmStart(true);
+            auto const warm = Diagnostics(optimizer->Optimize(rng, fix.tree));
+            // a linear model is solved by the projection alone
+            CHECK(warm.InitialCost == cold.InitialCost);
+            CHECK(warm.Iterations < cold.Iterations);
+            CHECK(warm.FinalCost < 1e-3F);
+        }
+        RobustLevenbergMarquardtOptimizer<DTable> const robust{&fix.dtable, &fix.problem};
+        CHECK_FALSE(robust.LinearWarmStartSupported());
+    }
+
+    SECTION("inherited coefficients save iterations after crossover") {
+        // y = exp(0.5 X1 - 0.3 X2) + 2 X3: a parent fitting the exp term
+        // exactly and another with the linear terms, and the child crossover
+        // makes of the two
+        std::vector<std::vector<Operon::Scalar>> columns(OptimizerFixture::Ncol, std::vector<Operon::Scalar>(OptimizerFixture::Nrow));
+        for (auto i = 0; i < OptimizerFixture::Nrow; ++i) {
+            for (auto j = 0; j < OptimizerFixture::Ncol - 1; ++j) { columns[j][i] = fix.data(i, j); }
+            columns.back()[i] = std::exp((0.5F * fix.data(i, 0)) - (0.3F * fix.data(i, 1))) + (2 * fix.data(i, 2)); // NOLINT
+        }
+        Operon::Dataset ds(columns);
+        Operon::Problem problem{&ds};
+        problem.SetTrainingRange({0, OptimizerFixture::Nrow});
+        problem.SetTestRange({0, OptimizerFixture::Nrow});
+        problem.SetTarget("X4");
+
+        LevenbergMarquardtOptimizer<DTable, OptimizerType::Tiny> const tiny{&fix.dtable, &problem};
+        tiny.SetIterations(50); // NOLINT
+        auto fitted = [&](std::string const& infix) {
+            auto tree = InfixParser::Parse(infix, ds);
+            auto const diag = Diagnostics(tiny.Optimize(rng, tree));
+            tree.SetCoefficients(diag.FinalParameters);
+            return tree;
+        };
+        auto const parent1 = fitted("exp(X1 + X2) + X3");
+        auto const parent2 = fitted("X3 + X1");
+
+        // parent1 with its X3 leaf replaced by parent2
+        auto const fresh = InfixParser::Parse("exp(X1 + X2) + (X3 + X1)", ds);
+        auto child = fresh;
+        REQUIRE(InheritCoefficients(child, parent1, parent2) == 4);
+
+        tiny.SetLinearWarmStart(true);
+        auto const cold = Diagnostics(tiny.Optimize(rng, fresh));
+        auto const warm = Diagnostics(tiny.Optimize(rng, child));
+        CHECK(warm.Iterations < cold.Iterations);
+        CHECK(warm.FinalCost < 1e-3F);
+    }
+}
+
+TEST_CASE("Levenberg-Marquardt workspace reuse", "[optimizer]")
+{
+    OptimizerFixture fix;
+    auto& rng = fix.rng;
+    using DTable = OptimizerFixture::DTable;
+
+    SECTION("a reused solver fits as a fresh one") {
+        LevenbergMarquardtOptimizer<DTable, OptimizerType::Tiny> const tiny{&fix.dtable, &fix.problem};
+        tiny.SetIterations(20); // NOLINT
+        auto const small = InfixParser::Parse("exp(X1 + X2) + X3", fix.ds);
+        auto const large = InfixParser::Parse("exp(X1 + X2) * sin(X3 - X1) + X2 * X3 + 0.5", fix.ds);
+
+        auto const first = Diagnostics(tiny.Optimize(rng, small));
+        (void)tiny.Optimize(rng, large); // grows the thread's solver
+        auto const again = Diagnostics(tiny.Optimize(rng, small));
+        CHECK(again.Iterations == first.Iterations);
+        CHECK(again.FinalCost == first.FinalCost);
+        CHECK(again.FinalParameters == first.FinalParameters);
+    }
+
+    SECTION("a fit allocates nothing per iteration") {
+        // Optimize allocates once per fit (the coefficients, the diagnostics,
+        // the interpreter's binding), but once the thread's solver is sized a
+        // long fit allocates exactly as much as a short one
+        LevenbergMarquardtOptimizer<DTable, OptimizerType::Tiny> const tiny{&fix.dtable, &fix.problem};
+        auto const tree = InfixParser::Parse("exp(X1 + X2) + X3", fix.ds);
+        auto fit = [&](std::size_t iterations) {
+            tiny.SetIterations(iterations);
+            Util::AllocationCounter const counter;
+            auto const iterationsTaken = Diagnostics(tiny.Optimize(rng, tree)).Iterations;
+            return std::pair{ iterationsTaken, counter.Count() };
+        };
+
+        (void)fit(1); // sizes the thread's solver
+        auto const [shortIterations, shortCount] = fit(1);
+        auto const [longIterations, longCount] = fit(20); // NOLINT
+        REQUIRE(longIterations > shortIterations);
+        CHECK(shortCount > 0);
+        CHECK(longCount == shortCount);
+
+        // with the thread's solver leased elsewhere the fit sizes a fresh
+        // one, and the count sees it
+        detail::ThreadWorkspace<ceres::TinySolver<LMCostFunction<Operon::Scalar>>> const held;
+        auto const [freshIterations, freshCount] = fit(1);
+        CHECK(freshIterations == shortIterations);
+        CHECK(freshCount > shortCount);
+    }
+
+    SECTION("a nested lease gets a workspace of its own") {
+        {
+            detail::ThreadWorkspace<std::vector<int>> const outer;
+            outer->push_back(1);
+            detail::ThreadWorkspace<std::vector<int>> const inner;
+            CHECK(outer.Shared());
+            CHECK_FALSE(inner.Shared());
+            CHECK(inner->empty());
+        }
+        detail::ThreadWorkspace<std::vector<int>> const next;
+        CHECK(next.Shared());
+        CHECK(next->size() == 1);
+    }
+}
+
+TEST_CASE("Robust least squares", "[optimizer]")
+{
+    // y = 2 x + 1 with a little noise, every tenth row thrown off by +20
+    constexpr auto nrow{500};
+    Operon::RandomGenerator rng{0};
+    std::vector<Operon::Scalar> x(nrow);
+    std::vector<Operon::Scalar> y(nrow);
+    for (auto i = 0; i < nrow; ++i) {
+        x[i] = Operon::Random::Uniform(rng, -1.0F, +1.0F);
+        y[i] = (2 * x[i]) + 1 + Operon::Random::Uniform(rng, -0.05F, +0.05F);
+        if (i % 10 == 0) { y[i] += 20; } // NOLINT
+    }
+    Operon::Dataset ds(std::vector<std::vector<Operon::Scalar>>{x, y});
+    Operon::Problem problem(&ds);
+    problem.SetTrainingRange({0, nrow});
+    problem.SetTestRange({0, nrow});
+    problem.SetTarget("X2");
+    using DTable = DispatchTable<Operon::Scalar>;
+    DTable dtable;
+    auto const tree = InfixParser::Parse("X1 + 0.5", ds);
+
+    // largest deviation of the fitted line from the clean one
+    auto deviation = [&](FitDiagnostics const& fit) {
+        auto const pred = Interpreter<Operon::Scalar, DTable>::Evaluate(tree, ds, problem.TrainingRange(), fit.FinalParameters);
+        Operon::Scalar worst{0};
+        for (auto i = 0; i < nrow; ++i) { worst = std::max(worst, std::abs(pred[i] - ((2 * x[i]) + 1))); }
+        return worst;
+    };
+
+    LevenbergMarquardtOptimizer<DTable, OptimizerType::Tiny> const plain{&dtable, &problem};
+    plain.SetIterations(50); // NOLINT
+    auto const pulled = deviation(Diagnostics(plain.Optimize(rng, tree)));
+    CHECK(pulled > 1.0F);
+
+    for (auto const loss : { RobustLoss::Huber, RobustLoss::Cauchy, RobustLoss::Tukey }) {
+        RobustLevenbergMarquardtOptimizer<DTable> const robust{&dtable, &problem, {.Loss = loss}};
+        robust.SetIterations(50); // NOLINT
+        auto const outcome = robust.Optimize(rng, tree);
+        REQUIRE(outcome.has_value());
+        CHECK(outcome->Iterations <= 50);
+        CHECK(deviation(*outcome) < 0.2F);
+    }
+
+    SECTION("outliers with zero data weight are left to the data weights") {
+        std::vector<Operon::Scalar> weights(nrow, 1.0F);
+        for (auto i = 0; i < nrow; i += 10) { weights[i] = 0; } // NOLINT
+        ds.SetWeights(weights);
+        auto const weighted = Diagnostics(plain.Optimize(rng, tree));
+        RobustLevenbergMarquardtOptimizer<DTable> const robust{&dtable, &problem};
+        robust.SetIterations(50); // NOLINT
+        auto const both = Diagnostics(robust.Optimize(rng, tree));
+        CHECK(deviation(weighted) < 0.1F);
+        CHECK(deviation(both) < 0.1F);
+    }
+
+    SECTION("loss functions") {
+        RobustLossFunction const huber{};
+        CHECK(huber.Weight(0.5) == 1.0);
+        CHECK_THAT(huber.Weight(2 * huber.C()), Catch::Matchers::WithinRel(0.5));
+        CHECK_THAT(huber(0.5), Catch::Matchers::WithinRel(0.125));
+        RobustLossFunction const tukey{.Loss = RobustLoss::Tukey};
+        CHECK(tukey.Weight(tukey.C()) == 0.0);
+        CHECK(tukey(10 * tukey.C()) == tukey(tukey.C()));
+
+        std::vector<Operon::Scalar> residuals(10001); // NOLINT
+        std::normal_distribution<Operon::Scalar> noise{0, 2}; // NOLINT
+        for (auto& r : residuals) { r = noise(rng); }
+        residuals.front() = 1e6F; // NOLINT
+        std::vector<Operon::Scalar> scratch;
+        CHECK_THAT(RobustLossFunction::Scale(residuals, scratch), Catch::Matchers::WithinRel(2.0, 0.05));
+    }
+}
+
 TEST_CASE("Weighted parameter optimization", "[optimizer]")
 {
     WeightedOptimizerFixture fix;
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright 2019-2025 Heal Research
+// SPDX-FileCopyrightText: Copyright 2025-present Bogdan Burlacu and contributors
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../operon_test.hpp"
+#include "operon/core/dataset.hpp"
+#include "operon/core/dispatch.hpp"
+#include "operon/operators/evaluator.hpp"
+#include "operon/operators/generator.hpp"
+#include "operon/random/random.hpp"
+
+namespace Operon::Test {
+
+TEST_CASE("Racing - finalists are the best on the full range and the others are never scored", "[racing]")
+{
+    // X2 = X1: a candidate X1 + k is off by exactly k on every row, so its
+    // MSE is k^2 on any window and the race is separable
+    constexpr std::size_t nrow { 512 };
+    Operon::RandomGenerator rng(1234);
+    std::vector<Operon::Scalar> x(nrow);
+    std::ranges::generate(x, [&]() { return Operon::Random::Uniform(rng, -1.0F, +1.0F); });
+    GeneratorFixture<> fix{Operon::Dataset(std::vector<std::vector<Operon::Scalar>>{x, x}), "X2", {0, nrow}, Operon::MSE{}, /*linearScaling=*/false};
+    auto const& evaluator = fix.Evaluator;
+    auto& generator = fix.Generator;
+    Operon::Evaluator<ScalarDispatch> const reference{&fix.Problem, &fix.Dtable, Operon::MSE{}, /*linearScaling=*/false};
+
+    // 8 candidates -> 4 on 16 rows, 4 -> 2 on 32 rows
+    constexpr std::size_t finalists { 2 };
+    constexpr std::size_t initialRows { 16 };
+    generator.SetRacing({ .InitialRows = initialRows, .HalvingRatio = 2.0, .Finalists = finalists });
+
+    // the offsets in breeding order, not sorted, so the finalists are not
+    // simply the first candidates
+    constexpr std::array offsets { 5, 2, 7, 0, 6, 3, 1, 4 };
+    constexpr Operon::Scalar unscored { -1 };
+    std::vector<RecombinationResult> candidates(offsets.size());
+    std::vector<Operon::Scalar> full(offsets.size());
+    auto& buf = fix.Buf;
+    for (auto i = 0UL; i < offsets.size(); ++i) {
+        auto& child = candidates[i].Child.emplace(1);
+        child.Genotype = fix.Parse("X1 + " + std::to_string(offsets[i]));
+        child.Fitness = { unscored };
+        full[i] = reference.Evaluate(rng, child, buf).front();
+    }
+
+    auto const winners = generator.Race(rng, /*pLocal=*/0, /*pLamarck=*/0, buf, candidates);
+
+    // the full-range ranking's top two, in breeding order
+    std::vector<std::size_t> ranking(offsets.size());
+    std::iota(ranking.begin(), ranking.end(), 0UL);
+    std::ranges::stable_sort(ranking, std::less{}, [&](auto i) { return full[i]; });
+    ranking.resize(finalists);
+    std::ranges::sort(ranking);
+    CHECK(winners == ranking);
+
+    for (auto i = 0UL; i < candidates.size(); ++i) {
+        auto const fitness = candidates[i].Child->Fitness.front();
+        if (std::ranges::find(winners, i) != winners.end()) {
+            CHECK(fitness == full[i]);
+        } else {
+            CHECK(fitness == unscored);
+        }
+    }
+
+    // every candidate is an attempt, but only the finalists were scored in
+    // full: the race itself used 8 * 16 + 4 * 32 rows, under one full pass
+    CHECK(evaluator.CallCount == offsets.size());
+    CHECK(evaluator.ResidualEvaluations == finalists + 1);
+    CHECK(evaluator.SavedRowEvaluations == (offsets.size() * nrow) - (finalists * nrow) - ((8 * 16) + (4 * 32)));
+}
+
+} // namespace Operon::Test
@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright 2019-2025 Heal Research
+// SPDX-FileCopyrightText: Copyright 2025-present Bogdan Burlacu and contributors
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "../operon_test.hpp"
+#include "operon/core/dispatch.hpp"
+#include "operon/operators/evaluator.hpp"
+#include "operon/operators/generator.hpp"
+#include "operon/operators/surrogate.hpp"
+
+namespace Operon::Test {
+
+namespace {
+    // random features with the bias term set, as Describe produces them
+    auto RandomFeatures(Operon::RandomGenerator& rng) -> FitnessSurrogate::Features
+    {
+        std::uniform_real_distribution<double> dist(0, 1);
+        FitnessSurrogate::Features x{};
+        x[0] = 1.0;
+        for (auto i = 1UL; i < x.size(); ++i) { x[i] = dist(rng); }
+        return x;
+    }
+} // namespace
+
+TEST_CASE("FitnessSurrogate - recursive least squares recovers a linear model", "[surrogate]")
+{
+    Operon::RandomGenerator rng(1234);
+    FitnessSurrogate const surrogate({ .Warmup = 50 });
+
+    FitnessSurrogate::Features weights{};
+    std::ranges::generate(weights, [&]() { return std::uniform_real_distribution<double>(-1, 1)(rng); });
+    auto truth = [&](auto const& x) { return std::inner_product(x.begin(), x.end(), weights.begin(), 0.0); };
+
+    auto const probe = RandomFeatures(rng);
+    CHECK_FALSE(surrogate.Predict(probe).has_value()); // not warm yet
+
+    for (auto i = 0; i < 200; ++i) {
+        auto const x = RandomFeatures(rng);
+        surrogate.Observe(x, static_cast<Operon::Scalar>(truth(x)));
+    }
+    // unusable fitness values are ignored
+    surrogate.Observe(probe, EvaluatorBase::ErrMax);
+    CHECK(surrogate.Observations() == 200);
+
+    auto const prediction = surrogate.Predict(probe);
+    REQUIRE(prediction.has_value());
+    CHECK_THAT(*prediction, Catch::Matchers::WithinAbs(truth(probe), 1e-3));
+}
+
+TEST_CASE("FitnessSurrogate - screening and margin adaptation", "[surrogate]")
+{
+    Operon::RandomGenerator rng(1234);
+    SurrogateConfig const config{ .Warmup = 20, .AuditRate = 0, .TargetMissRate = 0.1, .InitialMargin = 1.0 };
+    FitnessSurrogate const surrogate(config);
+
+    // fitness is (mostly) the better parent's, which is feature 1
+    auto const good = [&]() { auto x = RandomFeatures(rng); x[1] = 0.1; return x; }();
+    auto const bad  = [&]() { auto x = RandomFeatures(rng); x[1] = 0.9; return x; }();
+    CHECK(surrogate.Screen(rng, bad, 0.5) == FitnessSurrogate::Decision::Evaluate); // not warm yet
+
+    for (auto i = 0; i < 100; ++i) {
+        auto const x = RandomFeatures(rng);
+        surrogate.Observe(x, static_cast<Operon::Scalar>(x[1]));
+    }
+    CHECK(surrogate.Screen(rng, good, 0.5) == FitnessSurrogate::Decision::Evaluate);
+    CHECK(surrogate.Screen(rng, bad, 0.5) == FitnessSurrogate::Decision::Reject);
+    CHECK(surrogate.Rejected() == 1);
+
+    // a miss widens the margin far more than a correct rejection narrows it,
+    // so the margin is stable where misses are TargetMissRate of the audits
+    auto const margin = surrogate.Margin();
+    surrogate.Audit(/*accepted=*/true);
+    auto const widened = surrogate.Margin();
+    surrogate.Audit(/*accepted=*/false);
+    auto const narrowed = surrogate.Margin();
+    CHECK(widened > margin);
+    CHECK(narrowed < widened);
+    CHECK_THAT((widened - margin) / (widened - narrowed), Catch::Matchers::WithinRel((1 - config.TargetMissRate) / config.TargetMissRate, 1e-9));
+    CHECK(surrogate.Audited() == 2);
+    CHECK(surrogate.Missed() == 1);
+
+    CHECK_THROWS(FitnessSurrogate({ .Forgetting = 0 }));
+    CHECK_THROWS(FitnessSurrogate({ .TargetMissRate = 1 }));
+}
+
+TEST_CASE("FitnessSurrogate - a generator skips offspring predicted to be rejected", "[surrogate]")
+{
+    using Fixture = GeneratorFixture<Operon::Evaluator<ScalarDispatch>, Operon::OffspringSelectionGenerator>;
+    Fixture fix{Fixture::Poly10(), "Y", {0, 250}, Operon::MSE{}};
+    auto const& evaluator = fix.Evaluator;
+    auto const& generator = fix.Generator;
+
+    Individual parent{1};
+    parent.Genotype = fix.Parse("X1 + X2");
+    parent.Fitness = { 0.5 };
+
+    auto const child = fix.Parse("X1 * X2 + X3");
+    auto const features = FitnessSurrogate::Describe(child, parent[0], parent[0], static_cast<double>(parent.Genotype.Length()));
+    REQUIRE(features.has_value());
+    CHECK_FALSE(FitnessSurrogate::Describe(child, EvaluatorBase::ErrMax, parent[0], 1.0).has_value());
+
+    auto score = [&]() { return fix.Score(child, /*pLamarck=*/0, parent).Fitness.front(); };
+
+    // a surrogate that has only seen this child score far worse than its
+    // parents: no margin, so it rejects it outright
+    FitnessSurrogate const surrogate({ .Warmup = 1, .AuditRate = 0, .InitialMargin = 0 });
+    surrogate.Observe(*features, Operon::Scalar{1e6});
+    generator.SetSurrogate(&surrogate);
+
+    CHECK(score() == EvaluatorBase::ErrMax);
+    CHECK(surrogate.Rejected() == 1);
+    CHECK(evaluator.CallCount == 1);           // counted as an attempt ...
+    CHECK(evaluator.ResidualEvaluations == 0); // ... but never evaluated
+
+    // a surrogate that is not warm yet lets the child be scored and learns
+    // from the result
+    FitnessSurrogate const learner({ .Warmup = 10 });
+    generator.SetSurrogate(&learner);
+    CHECK(score() < EvaluatorBase::ErrMax);
+    CHECK(evaluator.ResidualEvaluations == 1);
+    CHECK(learner.Observations() == 1);
+}
+
+} // namespace Operon::Test
@@ -12,10 +12,19 @@
 #include "operon/core/dataset.hpp"
 #include "operon/core/node.hpp"
 #include "operon/core/pset.hpp"
+#include "operon/core/dispatch.hpp"
+#include "operon/core/problem.hpp"
 #include "operon/core/tree.hpp"
+#include "operon/hash/semantic.hpp"
 #include "operon/hash/zobrist.hpp"
 #include "operon/operators/creator.hpp"
+#include "operon/operators/crossover.hpp"
+#include "operon/operators/evaluator.hpp"
+#include "operon/operators/generator.hpp"
 #include "operon/operators/initializer.hpp"
+#include "operon/operators/mutation.hpp"
+#include "operon/operators/selector.hpp"
+#include "operon/parser/infix.hpp"
 
 namespace Operon::Test {
 
@@ -23,10 +32,16 @@ namespace {
     constexpr auto Seed      = 42UL;
     constexpr auto MaxLength = 50;
 
-    auto MakeSetup() {
-        auto ds = Dataset("./data/Poly-10.csv", /*hasHeader=*/true);
+    // every variable but the target
+    auto Inputs(Dataset const& ds) {
         auto inputs = ds.VariableHashes();
         std::erase(inputs, ds.GetVariable("Y").value().Hash);
+        return inputs;
+    }
+
+    auto MakeSetup() {
+        auto ds = Dataset("./data/Poly-10.csv", /*hasHeader=*/true);
+        auto inputs = Inputs(ds);
         PrimitiveSet pset;
         pset.SetConfig(PrimitiveSet::Arithmetic);
         return std::make_tuple(std::move(ds), std::move(inputs), std::move(pset));
@@ -521,4 +536,139 @@ TEST_CASE("Zobrist - concurrent readers racing an expiry-erase-then-reinsert nev
     REQUIRE(cache.TryGet(hash, final));
 }
 
+TEST_CASE("Zobrist - a coefficient-carrying cache restores the scored coefficients on a hit", "[zobrist]")
+{
+    GeneratorFixture<> fix{GeneratorFixture<>::Poly10(), "Y", {0, 250}, Operon::MSE{}};
+    auto const inputs = Inputs(fix.Ds);
+    auto const& evaluator = fix.Evaluator;
+    auto score = [&](Operon::Scalar weight) {
+        auto tree = fix.Parse("X1 + X2");
+        std::vector<Operon::Scalar> const coefficients(static_cast<std::size_t>(tree.CoefficientsCount()), weight);
+        tree.SetCoefficients(coefficients);
+        return fix.Score(std::move(tree));
+    };
+
+    SECTION("with coefficients") {
+        Zobrist cache(fix.Rng, MaxLength, inputs, /*maxAge=*/0, /*storeCoefficients=*/true);
+        fix.Generator.SetCache(&cache);
+        REQUIRE(cache.StoresCoefficients());
+
+        auto const first = score(2);
+        CHECK(evaluator.CallCount == 1);
+        CHECK(cache.CoefficientBytes() >= 2 * sizeof(Operon::Scalar));
+
+        // same structure, other coefficients: a hit that hands back the
+        // coefficients the cached fitness belongs to
+        auto const second = score(1);
+        CHECK(evaluator.CallCount == 1);
+        CHECK(second.Fitness == first.Fitness);
+        CHECK(second.Genotype.GetCoefficients() == first.Genotype.GetCoefficients());
+
+        cache.Clear();
+        CHECK(cache.CoefficientBytes() == 0);
+    }
+
+    SECTION("without coefficients") {
+        Zobrist cache(fix.Rng, MaxLength, inputs);
+        fix.Generator.SetCache(&cache);
+
+        auto const first = score(2);
+        auto const second = score(1);
+        CHECK(evaluator.CallCount == 1);
+        CHECK(second.Fitness == first.Fitness);
+        CHECK(second.Genotype.GetCoefficients() != first.Genotype.GetCoefficients());
+        CHECK(cache.CoefficientBytes() == 0);
+    }
+}
+
+TEST_CASE("Zobrist - a redrawn evaluator sample invalidates the caches", "[zobrist]")
+{
+    using Fixture = GeneratorFixture<Operon::SubsampledEvaluator<ScalarDispatch>>;
+    Fixture fix{Fixture::Poly10(), "Y", {0, 250}, /*rows=*/50, Operon::MSE{}, /*linearScaling=*/true, /*growth=*/1.0};
+    Zobrist cache(fix.Rng, MaxLength, Inputs(fix.Ds));
+    SemanticCache semantic(fix.Rng, fix.Problem, fix.Dtable);
+    fix.Generator.SetCache(&cache);
+    fix.Generator.SetFingerprintCache(&semantic);
+    auto const& evaluator = fix.Evaluator;
+
+    fix.Generator.Prepare({});
+    (void)fix.Score("X1 + X2");
+    (void)fix.Score("X1 + X2");
+    CHECK(evaluator.CallCount == 1);
+    CHECK(cache.Hits() == 1);
+
+    // a redraw drops the entries scored on the old sample
+    auto const epoch = evaluator.Epoch();
+    fix.Generator.Prepare({});
+    REQUIRE(evaluator.Epoch() != epoch);
+    CHECK(cache.Size() == 0);
+    CHECK(semantic.Size() == 0);
+    CHECK(cache.Hits() == 1); // the counters span the run
+
+    // the next duplicate is scored on the new sample
+    (void)fix.Score("X1 + X2");
+    CHECK(evaluator.CallCount == 2);
+    CHECK(cache.Size() == 1);
+}
+
+TEST_CASE("SemanticCache - semantically equal trees share a fingerprint", "[zobrist]")
+{
+    auto [ds, inputs, pset] = MakeSetup();
+    Operon::Problem problem{gsl::not_null<Operon::Dataset*>(&ds)};
+    problem.SetTrainingRange({0, 250});
+    problem.SetTarget("Y");
+
+    Operon::RandomGenerator rng(Seed);
+    ScalarDispatch const dtable;
+    SemanticCache const cache(rng, problem, dtable);
+    REQUIRE(cache.ProbeRows() == SemanticCache::DefaultProbeRows);
+
+    auto fingerprint = [&](std::string const& expr) { return cache.Fingerprint(InfixParser::Parse(expr, ds)); };
+
+    auto const sum = fingerprint("X1 + X2");
+    REQUIRE(sum.has_value());
+    CHECK(fingerprint("X2 + X1") == sum); // commuted operands, different Zobrist hash
+    CHECK(fingerprint("X1 * X2") != sum);
+    CHECK(fingerprint("X1 + X2 + 0.001") != sum); // well above the quantization step
+
+    // no fingerprint for models with a non-finite probe output
+    CHECK_FALSE(fingerprint("log(X1 - X1)").has_value());
+}
+
+TEST_CASE("SemanticCache - a generator reuses the fitness of a semantic duplicate", "[zobrist]")
+{
+    GeneratorFixture<> fix{GeneratorFixture<>::Poly10(), "Y", {0, 250}, Operon::MSE{}};
+    SemanticCache cache(fix.Rng, fix.Problem, fix.Dtable);
+    fix.Generator.SetFingerprintCache(&cache);
+    auto const& evaluator = fix.Evaluator;
+    auto score = [&](std::string const& expr, double pLamarck = 1) { return fix.Score(expr, pLamarck).Fitness; };
+
+    auto const first = score("X1 + X2");
+    CHECK(evaluator.CallCount == 1);
+    CHECK(cache.Size() == 1);
+
+    auto const second = score("X2 + X1");
+    CHECK(evaluator.CallCount == 1); // not evaluated
+    CHECK(second == first);
+    CHECK(cache.Hits() == 1);
+    CHECK(cache.Lookups() == 2);
+
+    auto const product = score("X1 * X2");
+    CHECK(evaluator.CallCount == 2);
+    CHECK(cache.Size() == 2);
+
+    // without the Lamarckian draw the fitness is still reused, Baldwin-style
+    auto const baldwinian = score("X2 * X1", /*pLamarck=*/0);
+    CHECK(evaluator.CallCount == 2);
+    CHECK(cache.Hits() == 2);
+    CHECK(baldwinian == product);
+
+    // a fingerprint match whose coefficients don't fit is no hit: the
+    // candidate is scored as usual
+    (void)score("X1 + X2 + 0");
+    CHECK(evaluator.CallCount == 3);
+    CHECK(cache.Hits() == 2);
+    CHECK(cache.Lookups() == 5);
+}
+
 } // namespace Operon::Test
@@ -4,3 +4,110 @@
 //
 #define ANKERL_NANOBENCH_IMPLEMENT
 #include <nanobench.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "operon_test.hpp"
+
+// Allocation counting for Util::AllocationCounter. Only the thread a
+// counter lives on is counted, and only while it lives; every other test
+// allocates as usual. With glibc the counter sees malloc and its relatives,
+// through which operator new, Eigen and the C libraries all allocate; the
+// replacements forward to glibc's own implementations, so free() needs no
+// replacement. Elsewhere, and under AddressSanitizer (which brings its own
+// malloc), it falls back to counting the global operator new.
+namespace {
+    thread_local std::size_t Allocations{0}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    thread_local std::size_t Counters{0};    // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+    inline auto Note() -> void
+    {
+        if (Counters > 0) { ++Allocations; }
+    }
+} // namespace
+
+namespace Operon::Test::Util {
+    AllocationCounter::AllocationCounter()
+        : start_{Allocations}
+    {
+        ++Counters;
+    }
+
+    AllocationCounter::~AllocationCounter()
+    {
+        --Counters;
+    }
+
+    auto AllocationCounter::Count() const -> std::size_t
+    {
+        return Allocations - start_;
+    }
+} // namespace Operon::Test::Util
+
+#if defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__)
+extern "C" {
+    auto __libc_malloc(std::size_t size) -> void*;                      // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    auto __libc_calloc(std::size_t count, std::size_t size) -> void*;   // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    auto __libc_realloc(void* p, std::size_t size) -> void*;            // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    auto __libc_memalign(std::size_t alignment, std::size_t size) -> void*; // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+
+    auto malloc(std::size_t size) noexcept -> void* // NOLINT(cert-dcl58-cpp)
+    {
+        Note();
+        return __libc_malloc(size);
+    }
+
+    auto calloc(std::size_t count, std::size_t size) noexcept -> void* // NOLINT(cert-dcl58-cpp)
+    {
+        Note();
+        return __libc_calloc(count, size);
+    }
+
+    auto realloc(void* p, std::size_t size) noexcept -> void* // NOLINT(cert-dcl58-cpp)
+    {
+        Note();
+        return __libc_realloc(p, size);
+    }
+
+    auto aligned_alloc(std::size_t alignment, std::size_t size) noexcept -> void* // NOLINT(cert-dcl58-cpp)
+    {
+        Note();
+        return __libc_memalign(alignment, size);
+    }
+
+    auto memalign(std::size_t alignment, std::size_t size) noexcept -> void* // NOLINT(cert-dcl58-cpp)
+    {
+        Note();
+        return __libc_memalign(alignment, size);
+    }
+
+    auto posix_memalign(void** result, std::size_t alignment, std::size_t size) noexcept -> int // NOLINT(cert-dcl58-cpp)
+    {
+        Note();
+        auto* p = __libc_memalign(alignment, size);
+        if (p == nullptr) { return ENOMEM; }
+        *result = p;
+        return 0;
+    }
+} // extern "C"
+#else
+auto operator new(std::size_t size) -> void*
+{
+    Note();
+    if (auto* p = std::malloc(size == 0 ? 1 : size)) { return p; } // NOLINT(cppcoreguidelines-no-malloc,hicpp-no-malloc)
+    throw std::bad_alloc{};
+}
+
+auto operator delete(void* p) noexcept -> void
+{
+    std::free(p); // NOLINT(cppcoreguidelines-no-malloc,hicpp-no-malloc)
+}
+
+auto operator delete(void* p, std::size_t /*size*/) noexcept -> void
+{
+    std::free(p); // NOLINT(cppcoreguidelines-no-malloc,hicpp-no-malloc)
+}
+#endif
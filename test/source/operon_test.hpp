@@ -10,11 +10,22 @@
 
 #include <fmt/core.h>
 #include <fmt/ranges.h>
+#include <optional>
 #include <random>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "operon/core/dataset.hpp"
+#include "operon/core/problem.hpp"
 #include "operon/core/tree.hpp"
 #include "operon/core/dispatch.hpp"
+#include "operon/operators/crossover.hpp"
+#include "operon/operators/evaluator.hpp"
+#include "operon/operators/generator.hpp"
+#include "operon/operators/mutation.hpp"
+#include "operon/operators/selector.hpp"
+#include "operon/parser/infix.hpp"
 // #include "operon/interpreter/backend/backend.hpp"
 #include "operon/interpreter/dual.hpp"
 
@@ -284,6 +295,89 @@ namespace Operon::Test::Util {
 
         return std::tuple{std::move(resid), std::move(jacob)};
     }
+
+    // Counts the heap allocations the calling thread makes while the
+    // counter lives: malloc and its relatives, which operator new and Eigen
+    // allocate through (see operon_test.cpp for the platforms where only
+    // operator new is seen). Other threads, and code running outside any
+    // counter, are not counted.
+    class AllocationCounter {
+    public:
+        AllocationCounter();
+        ~AllocationCounter();
+
+        AllocationCounter(AllocationCounter const&) = delete;
+        AllocationCounter(AllocationCounter&&) = delete;
+        auto operator=(AllocationCounter const&) -> AllocationCounter& = delete;
+        auto operator=(AllocationCounter&&) -> AllocationCounter& = delete;
+
+        // allocations since construction
+        [[nodiscard]] auto Count() const -> std::size_t;
+
+    private:
+        std::size_t start_;
+    };
 } // namespace Operon::Test::Util
 
+namespace Operon::Test {
+    // A problem training and testing on `range` of `ds`, with `target` as
+    // the target variable.
+    struct ProblemFixture {
+        Operon::Dataset Ds;
+        Operon::Problem Problem;
+
+        ProblemFixture(Operon::Dataset ds, std::string const& target, Operon::Range range)
+            : Ds(std::move(ds))
+            , Problem(gsl::not_null<Operon::Dataset*>(&Ds))
+        {
+            Problem.SetTrainingRange(range);
+            Problem.SetTestRange(range);
+            Problem.SetTarget(target);
+        }
+    };
+
+    // The operators and offspring generator the generator tests score
+    // hand-built children with. The evaluator is constructed from the
+    // problem, the dispatch table and `args`.
+    template<typename TEvaluator = Operon::Evaluator<ScalarDispatch>, typename TGenerator = Operon::BasicOffspringGenerator>
+    struct GeneratorFixture : ProblemFixture {
+        static constexpr std::uint64_t Seed { 42 };
+        static constexpr int MaxLength { 50 };
+
+        Operon::RandomGenerator Rng { Seed };
+        ScalarDispatch Dtable;
+        TEvaluator Evaluator;
+        Operon::SubtreeCrossover Crossover { 0.9, /*maxDepth=*/10, MaxLength };
+        Operon::MultiMutation Mutator;
+        Operon::TournamentSelector Selector { Operon::SingleObjectiveComparison{0} };
+        TGenerator Generator { &Evaluator, &Crossover, &Mutator, &Selector, &Selector };
+        std::vector<Operon::Scalar> Buf;
+
+        template<typename... Args>
+        GeneratorFixture(Operon::Dataset ds, std::string const& target, Operon::Range range, Args&&... args)
+            : ProblemFixture(std::move(ds), target, range)
+            , Evaluator(&Problem, &Dtable, std::forward<Args>(args)...)
+            , Buf(range.Size())
+        {
+        }
+
+        // The Poly-10 benchmark most of the generator tests train on.
+        static auto Poly10() -> Operon::Dataset { return Operon::Dataset("./data/Poly-10.csv", /*hasHeader=*/true); }
+
+        auto Parse(std::string const& expr) const -> Operon::Tree { return InfixParser::Parse(expr, Ds); }
+
+        // Scores `tree` through OffspringGeneratorBase::Score, without local
+        // search, as the child of `parent` (both parents) if given.
+        auto Score(Operon::Tree tree, double pLamarck = 1, std::optional<Individual> const& parent = std::nullopt) -> Individual
+        {
+            RecombinationResult res{ .Child = Individual{Evaluator.ObjectiveCount()}, .Parent1 = parent, .Parent2 = parent };
+            res.Child->Genotype = std::move(tree);
+            Generator.Score(Rng, /*pLocal=*/0, pLamarck, Buf, res);
+            return *std::move(res.Child);
+        }
+
+        auto Score(std::string const& expr, double pLamarck = 1) -> Individual { return Score(Parse(expr), pLamarck); }
+    };
+} // namespace Operon::Test
+
 #endif
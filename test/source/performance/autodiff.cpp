@@ -267,4 +267,53 @@ TEST_CASE("Optimizer performance", "[performance]")
     b.render(nb::templates::csv(), std::cout);
 }
 
+// SGD steps per second on mini-batches. Every step draws a new sub-range;
+// the interpreter keeps its binding across ranges, so a small batch should
+// cost proportionally less than the full training range instead of being
+// dominated by per-step setup.
+TEST_CASE("Mini-batch optimizer performance", "[performance]")
+{
+    auto ds = Dataset("./data/Poly-10.csv", /*hasHeader=*/true);
+    auto range = Range{0, ds.Rows<std::size_t>()};
+
+    Operon::Problem problem{&ds};
+    problem.SetTrainingRange(range);
+    problem.SetTestRange(range);
+    problem.SetTarget("Y");
+
+    Operon::RandomGenerator rng(0);
+
+    using DTable = DispatchTable<Operon::Scalar>;
+    DTable const dtable;
+
+    Operon::PrimitiveSet pset;
+    pset.SetConfig(Operon::PrimitiveSet::Arithmetic | Operon::BuiltinOp::Exp | Operon::BuiltinOp::Log | Operon::BuiltinOp::Sin | Operon::BuiltinOp::Cos);
+    constexpr size_t maxLength = 50;
+    Operon::BalancedTreeCreator const creator(&pset, ds.VariableHashes(), /* bias= */ 0.0, maxLength);
+
+    constexpr auto n{100};
+    constexpr auto iterations{50};
+    std::vector<Operon::Tree> trees(n);
+    std::uniform_int_distribution<size_t> dist(1, maxLength);
+    std::generate(trees.begin(), trees.end(), [&]() { return creator(rng, dist(rng), 1, 1000); }); // NOLINT
+
+    auto const rule = UpdateRule::Constant<Operon::Scalar>(Operon::Scalar{0.01});
+    SGDOptimizer<DTable, GaussianLoss<Operon::Scalar>> const optimizer{&dtable, &problem, rule};
+    optimizer.SetIterations(iterations);
+
+    nb::Bench b;
+    b.unit("step").batch(n * iterations);
+    for (auto batchSize : { 0UL, 256UL, 32UL }) {
+        optimizer.SetBatchSize(batchSize);
+        b.run(fmt::format("sgd;batch={}", batchSize == 0 ? range.Size() : batchSize), [&]() {
+            std::size_t sz{0};
+            for (auto const& tree : trees) {
+                auto summary = optimizer.Optimize(rng, tree);
+                sz += Operon::Diagnostics(summary).FinalParameters.size();
+            }
+            return sz;
+        });
+    }
+}
+
 } // namespace Operon::Test
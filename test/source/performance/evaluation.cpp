@@ -5,6 +5,8 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <random>
 #include <taskflow/algorithm/for_each.hpp>
 #include <taskflow/algorithm/reduce.hpp>
 #include <taskflow/taskflow.hpp>
@@ -242,6 +244,122 @@ TEST_CASE("Evaluator performance", "[performance]")
     test("mse", Operon::Evaluator<DTable>(&problem, &dtable, Operon::MSE{}, /*linearScaling=*/false));
 }
 
+TEST_CASE("Allocations per generation", "[performance]")
+{
+    constexpr size_t populationSize = 1000;
+    constexpr size_t maxLength = 50;
+    constexpr size_t maxDepth = 10;
+
+    constexpr size_t nrow = 1000;
+    constexpr size_t ncol = 10;
+
+    Operon::RandomGenerator rd(1234);
+    auto ds = Util::RandomDataset(rd, nrow, ncol);
+
+    auto target = ds.GetVariables().back().Name;
+    auto inputs = ds.VariableHashes();
+    std::erase(inputs, ds.GetVariable(target).value().Hash);
+    Range range = {0, ds.Rows<std::size_t>()};
+
+    Operon::Problem problem{&ds};
+    problem.SetTrainingRange(range);
+    problem.SetTestRange(range);
+    problem.GetPrimitiveSet().SetConfig(Operon::PrimitiveSet::Arithmetic);
+    problem.SetTarget(target);
+
+    using DTable = ScalarDispatch;
+    DTable dtable;
+    Operon::Evaluator<DTable> evaluator{&problem, &dtable, Operon::MSE{}};
+    evaluator.SetBudget(std::numeric_limits<size_t>::max());
+
+    std::uniform_int_distribution<size_t> sizeDistribution(1, maxLength);
+    auto creator = BalancedTreeCreator{&problem.GetPrimitiveSet(), inputs, /* bias= */ 0.0, maxLength};
+    std::vector<Operon::Scalar> buf(range.Size());
+
+    Operon::Vector<Individual> population(populationSize);
+    for (auto& ind : population) {
+        ind.Genotype = creator(rd, sizeDistribution(rd), 0, maxDepth);
+        ScoreIndividual(rd, ind, evaluator, /*coeffOptimizer=*/nullptr, /*pLocal=*/0.0, /*pLamarck=*/0.0, buf);
+    }
+
+    SubtreeCrossover const crossover{0.9, maxDepth, maxLength};
+    MultiMutation const mutator;
+    TournamentSelector const selector{SingleObjectiveComparison{0}};
+    selector.Prepare(population);
+    BasicOffspringGenerator const generator{&evaluator, &crossover, &mutator, &selector, &selector};
+
+    // one generation's worth of offspring, bred once so that scoring them is
+    // measured on its own (breeding copies trees and always allocates)
+    std::vector<RecombinationResult> offspring(populationSize);
+    auto const breeding = [&]() {
+        Util::AllocationCounter const counter;
+        for (auto& res : offspring) { generator.Breed(rd, /*pCrossover=*/1.0, /*pMutation=*/0.0, res); }
+        return counter.Count();
+    }();
+
+    // the fitness is written in place (EvaluatorBase::EvaluateInto) ...
+    auto scoreInto = [&]() -> void {
+        for (auto& res : offspring) { generator.Score(rd, /*pLocal=*/0.0, /*pLamarck=*/0.0, buf, res); }
+    };
+    // ... versus returned as a vector and copied into the individual
+    auto scoreReturn = [&]() -> void {
+        for (auto& res : offspring) { res.Child->Fitness = evaluator(rd, *res.Child, buf); }
+    };
+
+    auto count = [](auto&& f) -> std::size_t {
+        Util::AllocationCounter const counter;
+        f();
+        return counter.Count();
+    };
+    auto const into = count(scoreInto);
+    auto const returned = count(scoreReturn);
+    fmt::print("allocations per generation ({} offspring): breeding {}, scoring in place {}, scoring by return {}\n",
+        populationSize, breeding, into, returned);
+    CHECK(into + populationSize <= returned);
+
+    nb::Bench b;
+    b.title("Offspring scoring").relative(true).performanceCounters(true).minEpochIterations(10);
+    b.batch(populationSize).run("in place", scoreInto);
+    b.batch(populationSize).run("by return", scoreReturn);
+}
+
+TEST_CASE("Fused scaled metric performance", "[performance]")
+{
+    // metric-only comparison on a fixed prediction buffer: the fused kernel
+    // (one bivariate pass) against fit + in-place transform + metric
+    constexpr size_t nrow = 100'000;
+    Operon::RandomGenerator rd(1234);
+    std::uniform_real_distribution<Operon::Scalar> dist(-1.F, +1.F);
+    std::vector<Operon::Scalar> x(nrow);
+    std::vector<Operon::Scalar> y(nrow);
+    std::vector<Operon::Scalar> w(nrow);
+    std::vector<Operon::Scalar> scaled(nrow);
+    std::ranges::generate(x, [&]() -> Operon::Scalar { return dist(rd); });
+    std::ranges::transform(x, y.begin(), [&](auto v) -> Operon::Scalar { return (2 * v) + (0.5F * dist(rd)); });
+    std::ranges::generate(w, [&]() -> Operon::Scalar { return std::abs(dist(rd)) + 0.1F; });
+
+    nb::Bench b;
+    b.title("Fused scaled metric").relative(true).performanceCounters(true).minEpochIterations(100);
+
+    for (auto const& [name, metric] : { std::pair{"mse", Operon::ErrorMetric{Operon::ErrorType::MSE}},
+                                        std::pair{"nmse", Operon::ErrorMetric{Operon::ErrorType::NMSE}},
+                                        std::pair{"r2", Operon::ErrorMetric{Operon::ErrorType::R2}} }) {
+        for (auto weighted : { false, true }) {
+            auto const wspan = weighted ? Operon::Span<Operon::Scalar const>{w} : Operon::Span<Operon::Scalar const>{};
+            auto const suffix = weighted ? " weighted" : "";
+            b.batch(nrow).run(fmt::format("{}{} three-pass", name, suffix), [&]() -> double {
+                std::ranges::copy(x, scaled.begin());
+                auto [a, c] = weighted ? Operon::FitLeastSquares(scaled, y, w) : Operon::FitLeastSquares(scaled, y);
+                std::ranges::transform(scaled, scaled.begin(), [a=a,c=c](auto v) -> auto { return static_cast<Operon::Scalar>((a * v) + c); });
+                return weighted ? metric(scaled, y, w) : metric(scaled, y);
+            });
+            b.batch(nrow).run(fmt::format("{}{} fused", name, suffix), [&]() -> double {
+                return Operon::FusedScaledError(metric.Type(), x, y, wspan).value_or(0.0);
+            });
+        }
+    }
+}
+
 TEST_CASE("skipNonFinite_ evaluator performance", "[performance]")
 {
     // Stage 4 benchmark checkpoint: compares default vs skipNonFinite_ mode
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright 2019-2025 Heal Research
+// SPDX-FileCopyrightText: Copyright 2025-present Bogdan Burlacu and contributors
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/core.h>
+
+#include "../operon_test.hpp"
+#include "operon/core/dataset.hpp"
+#include "operon/core/problem.hpp"
+#include "operon/core/tree_diff.hpp"
+#include "operon/optimizer/optimizer.hpp"
+#include "operon/parser/infix.hpp"
+#include "operon/random/random.hpp"
+
+namespace nb = ankerl::nanobench;
+
+namespace Operon::Test {
+
+// exp(X1 + X2) + X3 fitted to X1 + X2 + X3: the two weights inside exp are
+// coupled and the residual stays large, the case the exact Hessian is for.
+// Reports the fit statistics of both optimizers next to their timings, since
+// a Newton iteration costs a Hessian pass over p (p + 1) / 2 extra roots.
+TEST_CASE("Newton vs Levenberg-Marquardt", "[performance]")
+{
+    constexpr auto nrow{500};
+    constexpr auto ncol{4};
+
+    Operon::RandomGenerator rng{0};
+    std::vector<std::vector<Operon::Scalar>> columns(ncol, std::vector<Operon::Scalar>(nrow));
+    for (auto i = 0; i < ncol - 1; ++i) {
+        std::ranges::generate(columns[i], [&]() { return Operon::Random::Uniform(rng, -1.0F, +1.0F); });
+    }
+    for (auto r = 0; r < nrow; ++r) { columns[ncol - 1][r] = columns[0][r] + columns[1][r] + columns[2][r]; }
+    Operon::Dataset ds(columns);
+
+    Operon::Problem problem{&ds};
+    problem.SetTrainingRange({0, nrow});
+    problem.SetTestRange({0, nrow});
+    problem.SetTarget("X4");
+
+    using DTable = DispatchTable<Operon::Scalar>;
+    DTable const dtable;
+    auto const tree = InfixParser::Parse("exp(X1 + X2) + X3", ds);
+    REQUIRE(HasSymbolicDerivatives(tree));
+
+    constexpr auto iterations{50};
+    NewtonOptimizer<DTable> const newton{&dtable, &problem};
+    LevenbergMarquardtOptimizer<DTable, OptimizerType::Tiny> const tiny{&dtable, &problem};
+    newton.SetIterations(iterations);
+    tiny.SetIterations(iterations);
+
+    auto const exact = Diagnostics(newton.Optimize(rng, tree));
+    auto const reference = Diagnostics(tiny.Optimize(rng, tree));
+    for (auto const& [name, diag] : { std::pair{"newton", exact}, std::pair{"tiny", reference} }) {
+        fmt::print("{}: cost {} -> {}, {} iterations, {} residual, {} jacobian and {} hessian passes\n", name,
+            diag.InitialCost, diag.FinalCost, diag.Iterations, diag.FunctionEvaluations, diag.JacobianEvaluations, diag.HessianEvaluations);
+    }
+    CHECK(exact.Iterations < reference.Iterations);
+
+    nb::Bench b;
+    b.timeUnit(std::chrono::microseconds(1), "us");
+    b.run("newton", [&]() { return newton.Optimize(rng, tree); });
+    b.run("tiny", [&]() { return tiny.Optimize(rng, tree); });
+    b.render(nb::templates::csv(), std::cout);
+}
+
+} // namespace Operon::Test